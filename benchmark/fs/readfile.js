@@ -1,6 +1,9 @@
 // Call fs.readFile over and over again really fast.
 // Then see how many times it got called.
 // Yes, this is a silly benchmark.  Most benchmarks are silly.
+//
+// With files > 1, the reads cycle over that many distinct files, which is
+// what loaders that read lots of small config or template files look like.
 
 var path = require('path');
 var common = require('../common.js');
@@ -9,27 +12,35 @@ var fs = require('fs');
 
 var bench = common.createBenchmark(main, {
   dur: [5],
-  len: [1024, 16 * 1024 * 1024],
+  len: [16, 1024, 16 * 1024 * 1024],
+  files: [1, 100],
   concurrent: [1, 10]
 });
 
 function main(conf) {
   var len = +conf.len;
-  try { fs.unlinkSync(filename); } catch (e) {}
+  var files = +conf.files;
+  var filenames = [];
   var data = new Buffer(len);
   data.fill('x');
-  fs.writeFileSync(filename, data);
+  for (var i = 0; i < files; i++) {
+    filenames.push(filename + '-' + i);
+    try { fs.unlinkSync(filenames[i]); } catch (e) {}
+    fs.writeFileSync(filenames[i], data);
+  }
   data = null;
 
   var reads = 0;
   bench.start();
   setTimeout(function() {
+    filenames.forEach(function(filename) {
+      try { fs.unlinkSync(filename); } catch (e) {}
+    });
     bench.end(reads);
-    try { fs.unlinkSync(filename); } catch (e) {}
   }, +conf.dur * 1000);
 
   function read() {
-    fs.readFile(filename, afterRead);
+    fs.readFile(filenames[reads % files], afterRead);
   }
 
   function afterRead(er, data) {
@@ -0,0 +1,29 @@
+// Call fs.statSync over and over again, with and without lazy stats.
+// The lazy variant leaves the Dates alone, like most callers that only
+// want to know whether something is a file or how big it is.
+
+var common = require('../common.js');
+var fs = require('fs');
+
+var bench = common.createBenchmark(main, {
+  lazy: ['true', 'false'],
+  dates: ['true', 'false'],
+  n: [1e5]
+});
+
+function main(conf) {
+  var n = +conf.n;
+  var options = { lazy: conf.lazy === 'true' };
+  var dates = conf.dates === 'true';
+  var ms = 0;
+
+  bench.start();
+  for (var i = 0; i < n; i++) {
+    var stats = fs.statSync(__filename, options);
+    if (!stats.isFile())
+      throw new Error('expected a file');
+    if (dates)
+      ms += stats.mtime.getTime();
+  }
+  bench.end(n);
+}
@@ -0,0 +1,41 @@
+// Call fs.writeFile over and over again really fast and see how many
+// times it got called, the counterpart of readfile.js.
+
+var path = require('path');
+var common = require('../common.js');
+var filename = path.resolve(__dirname, '.removeme-benchmark-garbage');
+var fs = require('fs');
+
+var bench = common.createBenchmark(main, {
+  dur: [5],
+  len: [16, 1024, 1024 * 1024],
+  concurrent: [1, 10]
+});
+
+function main(conf) {
+  var len = +conf.len;
+  var cur = +conf.concurrent;
+  var data = new Buffer(len);
+  data.fill('x');
+
+  var writes = 0;
+  bench.start();
+  setTimeout(function() {
+    for (var i = 0; i < +conf.concurrent; i++) {
+      try { fs.unlinkSync(filename + '-' + i); } catch (e) {}
+    }
+    bench.end(writes);
+  }, +conf.dur * 1000);
+
+  function write(i) {
+    fs.writeFile(filename + '-' + i, data, function(er) {
+      if (er)
+        throw er;
+
+      writes++;
+      write(i);
+    });
+  }
+
+  while (cur--) write(cur);
+}
@@ -0,0 +1,52 @@
+// Measure how fast the HTTP parser gets requests with many headers into
+// JS land, including the kOnHeaders flushes for overly long header lists.
+
+var common = require('../common.js');
+var HTTPParser = process.binding('http_parser').HTTPParser;
+
+var kOnHeaders = HTTPParser.kOnHeaders | 0;
+var kOnHeadersComplete = HTTPParser.kOnHeadersComplete | 0;
+
+var bench = common.createBenchmark(main, {
+  headers: [10, 30, 60, 100],
+  n: [1e5]
+});
+
+// A request as sent by a typical mobile client, padded with custom headers.
+function createRequest(count) {
+  var request = 'GET /api/v1/feed?cursor=abcdef HTTP/1.1\r\n' +
+                'Host: api.example.com\r\n' +
+                'Accept: application/json\r\n' +
+                'Accept-Encoding: gzip, deflate\r\n' +
+                'Accept-Language: en-US,en;q=0.8\r\n' +
+                'Connection: keep-alive\r\n' +
+                'User-Agent: ExampleApp/4.2.0 (iPhone; iOS 8.4)\r\n';
+  for (var i = 6; i < count; i++)
+    request += 'X-Client-Field-' + i + ': ' + (i * 7919).toString(36) + '\r\n';
+  return new Buffer(request + '\r\n');
+}
+
+function main(conf) {
+  var n = +conf.n;
+  var request = createRequest(+conf.headers);
+  var parser = new HTTPParser(HTTPParser.REQUEST);
+  var received = [];
+
+  parser[kOnHeaders] = function(headers, url) {
+    received = received.concat(headers);
+  };
+
+  parser[kOnHeadersComplete] = function(major, minor, headers) {
+    received = headers || received;
+  };
+
+  bench.start();
+  for (var i = 0; i < n; i++) {
+    received = [];
+    parser.reinitialize(HTTPParser.REQUEST);
+    parser.execute(request);
+  }
+  bench.end(n);
+
+  parser.close();
+}
@@ -0,0 +1,44 @@
+// Open a burst of connections against a server and measure how fast they are
+// accepted, with and without batched accept.
+
+var common = require('../common.js');
+var net = require('net');
+var PORT = common.PORT;
+
+var bench = common.createBenchmark(main, {
+  batch: [0, 16, 64],
+  conns: [1000],
+  n: [20]
+});
+
+function main(conf) {
+  var batch = +conf.batch;
+  var conns = +conf.conns;
+  var rounds = +conf.n;
+  var accepted = 0;
+  var round = 0;
+
+  var server = net.createServer({ acceptBatchSize: batch }, function(c) {
+    c.destroy();
+    if (++accepted === conns)
+      next();
+  });
+
+  server.listen(PORT, function() {
+    bench.start();
+    storm();
+  });
+
+  function storm() {
+    accepted = 0;
+    for (var i = 0; i < conns; i++)
+      net.connect(PORT).on('error', function() {}).resume();
+  }
+
+  function next() {
+    if (++round < rounds)
+      return storm();
+    bench.end(conns * rounds);
+    server.close();
+  }
+}
@@ -0,0 +1,121 @@
+// Calls handle.writev() with many small buffers, either as a plain list of
+// buffers or as chunk/encoding pairs, and reports writev() calls per second.
+// Small chunks keep the cost of the binding ahead of the cost of the bytes.
+
+var common = require('../common.js');
+var util = require('util');
+
+var bench = common.createBenchmark(main, {
+  format: ['buffers', 'pairs'],
+  chunks: [4, 16, 64],
+  dur: [5]
+});
+
+var TCP = process.binding('tcp_wrap').TCP;
+var TCPConnectWrap = process.binding('tcp_wrap').TCPConnectWrap;
+var WriteWrap = process.binding('stream_wrap').WriteWrap;
+var PORT = common.PORT;
+
+var dur;
+var chunks;
+var format;
+
+function main(conf) {
+  dur = +conf.dur;
+  chunks = +conf.chunks;
+  format = conf.format;
+  server();
+}
+
+
+function fail(err, syscall) {
+  throw util._errnoException(err, syscall);
+}
+
+function server() {
+  var serverHandle = new TCP();
+  var err = serverHandle.bind('127.0.0.1', PORT);
+  if (err)
+    fail(err, 'bind');
+
+  err = serverHandle.listen(511);
+  if (err)
+    fail(err, 'listen');
+
+  serverHandle.onconnection = function(err, clientHandle) {
+    if (err)
+      fail(err, 'connect');
+
+    clientHandle.onread = function(nread, buffer) {
+      if (nread < 0)
+        fail(nread, 'read');
+    };
+
+    clientHandle.readStart();
+  };
+
+  client();
+}
+
+function client() {
+  var allBuffers = format === 'buffers';
+  var list = [];
+  for (var i = 0; i < chunks; i++) {
+    var chunk = new Buffer(16);
+    chunk.fill('x');
+    if (allBuffers) {
+      list.push(chunk);
+    } else {
+      list.push(chunk, 'buffer');
+    }
+  }
+
+  var clientHandle = new TCP();
+  var connectReq = new TCPConnectWrap();
+  var err = clientHandle.connect(connectReq, '127.0.0.1', PORT);
+
+  if (err)
+    fail(err, 'connect');
+
+  clientHandle.readStart();
+
+  connectReq.oncomplete = function(err) {
+    if (err)
+      fail(err, 'connect');
+
+    var calls = 0;
+    var running = true;
+
+    bench.start();
+
+    setTimeout(function() {
+      running = false;
+      bench.end(calls);
+    }, dur * 1000);
+
+    write();
+
+    // Keep up to 64 KB queued, the rest completes synchronously.
+    function write() {
+      while (running && clientHandle.writeQueueSize < 64 * 1024) {
+        var req = new WriteWrap();
+        req.async = false;
+        req.oncomplete = afterWrite;
+        var err = clientHandle.writev(req, list, allBuffers);
+        if (err)
+          fail(err, 'write');
+        calls++;
+        if (req.async)
+          return;
+      }
+      if (running)
+        setImmediate(write);
+    }
+
+    function afterWrite(err, handle, req) {
+      if (err)
+        fail(err, 'write');
+      write();
+    }
+  };
+}
@@ -0,0 +1,92 @@
+// Serve a static file over plain HTTP, either with fs.createReadStream().pipe()
+// or with the handle's native sendFile().
+//
+// Usage: node benchmark/static_file_server.js [pipe|sendfile] [kilobytes]
+
+var fs = require('fs');
+var http = require('http');
+var net = require('net');
+var path = require('path');
+
+var WriteWrap = process.binding('stream_wrap').WriteWrap;
+
+var mode = process.argv[2] || 'sendfile';
+var kilobytes = +process.argv[3] || 1024;
+var concurrency = 30;
+var port = 12346;
+var n = 700;
+
+var filename = path.resolve(__dirname, '.static_file_server.' + process.pid);
+var chunk = new Buffer(1024);
+chunk.fill('C');
+var fd = fs.openSync(filename, 'w');
+for (var i = 0; i < kilobytes; i++)
+  fs.writeSync(fd, chunk, 0, chunk.length);
+fs.closeSync(fd);
+
+var size = kilobytes * 1024;
+var head = 'HTTP/1.1 200 OK\r\n' +
+           'Content-Type: text/plain\r\n' +
+           'Content-Length: ' + size + '\r\n' +
+           'Connection: close\r\n\r\n';
+
+var server = net.createServer(function(socket) {
+  socket.once('data', function() {
+    socket.write(head);
+    if (mode === 'pipe')
+      fs.createReadStream(filename).pipe(socket);
+    else
+      sendFile(socket);
+  });
+});
+
+function sendFile(socket) {
+  fs.open(filename, 'r', function(err, fd) {
+    if (err)
+      throw err;
+
+    var req = new WriteWrap();
+    req.async = false;
+    req.oncomplete = function(status) {
+      fs.close(fd);
+      if (status < 0)
+        throw new Error('sendFile failed: ' + status);
+      socket.end();
+    };
+
+    err = socket._handle.sendFile(req, fd, 0, size);
+    if (err)
+      throw new Error('sendFile failed: ' + err);
+    if (!req.async)
+      req.oncomplete(0);
+  });
+}
+
+server.listen(port, function() {
+  var agent = new http.Agent();
+  agent.maxSockets = concurrency;
+
+  var responses = 0;
+  var start = process.hrtime();
+
+  for (var i = 0; i < n; i++) {
+    http.get({
+      port: port,
+      path: '/',
+      agent: agent
+    }, function(res) {
+      res.resume();
+      res.on('end', function() {
+        if (++responses !== n)
+          return;
+        var elapsed = process.hrtime(start);
+        var seconds = elapsed[0] + elapsed[1] / 1e9;
+        console.log('%s: %d KB x %d responses in %d s (%d MB/s)',
+                    mode, kilobytes, n, seconds.toFixed(3),
+                    (n * size / seconds / (1024 * 1024)).toFixed(1));
+        server.close();
+        fs.unlinkSync(filename);
+      });
+    });
+  }
+});
@@ -0,0 +1,79 @@
+// event loop lag of a server that is flooded with full handshakes. Reports
+// the 99th percentile of the delay of a 10ms interval timer in milliseconds,
+// lower is better. The clients run in a child process.
+var fs = require('fs'),
+    path = require('path'),
+    tls = require('tls'),
+    child_process = require('child_process');
+
+var common = require('../common.js');
+var PORT = common.PORT;
+var INTERVAL = 10;
+
+if (process.argv[2] === 'client') {
+  client(+process.argv[3]);
+} else {
+  var bench = common.createBenchmark(main, {
+    asyncPrivateKey: ['false', 'true'],
+    concurrency: [10, 50],
+    dur: [5]
+  });
+}
+
+function main(conf) {
+  var dur = +conf.dur;
+  var keys = path.resolve(__dirname, '../../test/fixtures/keys');
+  var options = {
+    key: fs.readFileSync(keys + '/0-dns-key.pem'),
+    cert: fs.readFileSync(keys + '/0-dns-cert.pem'),
+    asyncPrivateKey: conf.asyncPrivateKey === 'true',
+    // Every connection does a full handshake
+    sessionCache: false,
+    secureOptions: require('constants').SSL_OP_NO_TICKET
+  };
+
+  var server = tls.createServer(options, function(conn) {
+    conn.end();
+  });
+  server.listen(PORT, function() {
+    var child = child_process.fork(__filename,
+                                   ['client', conf.concurrency]);
+    var lags = [];
+    var last;
+
+    // Let the clients get going first
+    setTimeout(function() {
+      last = Date.now();
+      var timer = setInterval(function() {
+        var now = Date.now();
+        lags.push(now - last - INTERVAL);
+        last = now;
+      }, INTERVAL);
+
+      setTimeout(function() {
+        clearInterval(timer);
+        child.kill();
+        lags.sort(function(a, b) {
+          return a - b;
+        });
+        bench.report(Math.max(0, lags[Math.floor(lags.length * 0.99)]));
+      }, dur * 1000);
+    }, 500);
+  });
+}
+
+function client(concurrency) {
+  for (var i = 0; i < concurrency; i++)
+    connect();
+
+  function connect() {
+    var conn = tls.connect({
+      port: PORT,
+      rejectUnauthorized: false
+    }, function() {
+      conn.end();
+    });
+    conn.on('error', function() {});
+    conn.on('close', connect);
+  }
+}
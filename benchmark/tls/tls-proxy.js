@@ -0,0 +1,95 @@
+// throughput of a TLS terminating proxy that passes what a client sends on to
+// a backend, with socket.pipe() or socket.pipeNative(). Reports Mbit/s. The
+// client and the backend run in a child process.
+var fs = require('fs'),
+    path = require('path'),
+    net = require('net'),
+    tls = require('tls'),
+    child_process = require('child_process');
+
+var common = require('../common.js');
+var PORT = common.PORT;
+var keys = path.resolve(__dirname, '../../test/fixtures/keys');
+
+if (process.argv[2] === 'child') {
+  child(process.argv[3]);
+} else {
+  var bench = common.createBenchmark(main, {
+    method: ['pipe', 'pipeNative'],
+    backend: ['tcp', 'tls'],
+    dur: [5]
+  });
+}
+
+function main(conf) {
+  var dur = +conf.dur;
+  var options = {
+    key: fs.readFileSync(keys + '/agent1-key.pem'),
+    cert: fs.readFileSync(keys + '/agent1-cert.pem'),
+    ciphers: 'AES128-GCM-SHA256'
+  };
+
+  var server = tls.createServer(options, function(conn) {
+    var upstream;
+    if (conf.backend === 'tls')
+      upstream = tls.connect({ port: PORT, rejectUnauthorized: false });
+    else
+      upstream = net.connect(PORT);
+    conn[conf.method](upstream);
+  });
+
+  server.listen(PORT + 1, function() {
+    var child = child_process.fork(__filename, ['child', conf.backend]);
+    child.on('message', function(msg) {
+      if (msg === 'start') {
+        bench.start();
+        setTimeout(function() {
+          child.send('stop');
+        }, dur * 1000);
+        return;
+      }
+
+      // end() exits the process
+      child.kill();
+      bench.end(msg * 8 / (1024 * 1024));
+    });
+  });
+}
+
+function child(backend) {
+  var received = 0;
+  var options = {
+    key: fs.readFileSync(keys + '/agent1-key.pem'),
+    cert: fs.readFileSync(keys + '/agent1-cert.pem')
+  };
+
+  function onConnection(conn) {
+    conn.on('data', function(data) {
+      received += data.length;
+    });
+  }
+
+  var server = backend === 'tls' ? tls.createServer(options, onConnection) :
+                                   net.createServer(onConnection);
+  server.listen(PORT, function() {
+    var chunk = new Buffer(64 * 1024);
+    chunk.fill('x');
+    var conn = tls.connect({
+      port: PORT + 1,
+      rejectUnauthorized: false
+    }, function() {
+      received = 0;
+      process.send('start');
+      conn.on('drain', write);
+      write();
+    });
+
+    function write() {
+      while (conn.write(chunk));
+    }
+  });
+
+  process.on('message', function() {
+    process.send(received);
+  });
+}
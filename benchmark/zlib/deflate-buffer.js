@@ -0,0 +1,46 @@
+// throughput of the convenience methods for payloads of the size of an API
+// response up to large documents
+var common = require('../common.js');
+var zlib = require('zlib');
+
+var bench = common.createBenchmark(main, {
+  method: ['gzip', 'gunzip', 'gzipSync', 'gunzipSync'],
+  len: [2 * 1024, 32 * 1024, 200 * 1024, 4 * 1024 * 1024],
+  n: [500]
+});
+
+function main(conf) {
+  var len = +conf.len;
+  var n = +conf.n;
+  // large payloads take long enough without many iterations.
+  if (len > 1024 * 1024)
+    n = Math.ceil(n / 50);
+
+  var record = '{"id":12345,"name":"some name","tags":["a","bc","def"]},';
+  var input = new Buffer(new Array(Math.ceil(len / record.length) + 1)
+                             .join(record).slice(0, len));
+  var method = conf.method;
+  if (/^gunzip/.test(method))
+    input = zlib.gzipSync(input);
+
+  if (/Sync$/.test(method)) {
+    bench.start();
+    for (var i = 0; i < n; i++)
+      zlib[method](input);
+    return bench.end(n);
+  }
+
+  var done = 0;
+  bench.start();
+  next();
+
+  function next() {
+    if (done++ === n)
+      return bench.end(n);
+    zlib[method](input, function(err) {
+      if (err)
+        throw err;
+      next();
+    });
+  }
+}
@@ -0,0 +1,45 @@
+// throughput benchmark for zlib streams that produce a lot of output per
+// input chunk
+var common = require('../common.js');
+var zlib = require('zlib');
+
+var bench = common.createBenchmark(main, {
+  type: ['inflate', 'gunzip'],
+  len: [64 * 1024, 10 * 1024 * 1024],
+  n: [20]
+});
+
+function main(conf) {
+  var n = +conf.n;
+  var input = new Buffer(+conf.len);
+  for (var i = 0; i < input.length; i++)
+    input[i] = i % 64 + 32;
+
+  var compressed;
+  var create;
+  if (conf.type === 'inflate') {
+    compressed = zlib.deflateSync(input);
+    create = zlib.createInflate;
+  } else {
+    compressed = zlib.gzipSync(input);
+    create = zlib.createGunzip;
+  }
+
+  var bytes = 0;
+  var done = 0;
+  bench.start();
+  next();
+
+  function next() {
+    if (done++ === n) {
+      var gbits = (bytes * 8) / (1024 * 1024 * 1024);
+      return bench.end(gbits);
+    }
+    var stream = create();
+    stream.on('data', function(chunk) {
+      bytes += chunk.length;
+    });
+    stream.on('end', next);
+    stream.end(compressed);
+  }
+}
@@ -32,6 +32,9 @@ struct uv__work {
   void (*done)(struct uv__work *w, int status);
   struct uv_loop_s* loop;
   void* wq[2];
+  unsigned int work_class;
+  uint64_t queued_at;
+  void* owner;
 };
 
 #endif /* UV_THREADPOOL_H_ */
@@ -217,6 +217,9 @@ typedef struct {
   void* wq[2];                                                                \
   uv_mutex_t wq_mutex;                                                        \
   uv_async_t wq_async;                                                        \
+  uv_work_batch_cb work_batch_begin_cb;                                       \
+  uv_work_batch_cb work_batch_end_cb;                                         \
+  void* work_batch_arg;                                                       \
   uv_rwlock_t cloexec_lock;                                                   \
   uv_handle_t* closing_handles;                                               \
   void* process_handles[2];                                                   \
@@ -337,7 +337,10 @@ RB_HEAD(uv_timer_tree_s, uv_timer_s);
   /* Threadpool */                                                            \
   void* wq[2];                                                                \
   uv_mutex_t wq_mutex;                                                        \
-  uv_async_t wq_async;
+  uv_async_t wq_async;                                                        \
+  uv_work_batch_cb work_batch_begin_cb;                                       \
+  uv_work_batch_cb work_batch_end_cb;                                         \
+  void* work_batch_arg;
 
 #define UV_REQ_TYPE_PRIVATE                                                   \
   /* TODO: remove the req suffix */                                           \
@@ -298,6 +298,9 @@ typedef void (*uv_walk_cb)(uv_handle_t* handle, void* arg);
 typedef void (*uv_fs_cb)(uv_fs_t* req);
 typedef void (*uv_work_cb)(uv_work_t* req);
 typedef void (*uv_after_work_cb)(uv_work_t* req, int status);
+typedef void (*uv_work_batch_cb)(uv_loop_t* loop,
+                                 unsigned int count,
+                                 void* arg);
 typedef void (*uv_getaddrinfo_cb)(uv_getaddrinfo_t* req,
                                   int status,
                                   struct addrinfo* res);
@@ -951,6 +954,61 @@ UV_EXTERN int uv_queue_work(uv_loop_t* loop,
                             uv_work_cb work_cb,
                             uv_after_work_cb after_work_cb);
 
+/*
+ * Classes of threadpool work. Each class has its own queue; idle workers
+ * take work from the first class in this list that has work queued and is
+ * below its concurrency limit.
+ */
+typedef enum {
+  UV_WORK_FS,
+  UV_WORK_USER,
+  UV_WORK_CPU,
+  UV_WORK_DNS,
+  UV_WORK_CLASS_MAX
+} uv_work_class;
+
+typedef struct {
+  unsigned int limit;
+  unsigned int queued;
+  unsigned int running;
+  uint64_t submitted;
+  uint64_t completed;
+  uint64_t cancelled;
+  uint64_t queue_time;
+  uint64_t max_queue_time;
+} uv_threadpool_stats_t;
+
+UV_EXTERN int uv_queue_work_class(uv_loop_t* loop,
+                                  uv_work_t* req,
+                                  uv_work_class work_class,
+                                  uv_work_cb work_cb,
+                                  uv_after_work_cb after_work_cb);
+UV_EXTERN int uv_threadpool_set_limit(uv_work_class work_class,
+                                      unsigned int limit);
+UV_EXTERN int uv_threadpool_get_stats(uv_work_class work_class,
+                                      uv_threadpool_stats_t* stats);
+
+typedef struct {
+  unsigned int threads;
+  unsigned int idle_threads;
+  unsigned int min_threads;
+  unsigned int max_threads;
+  unsigned int queued;
+  unsigned int running;
+  uint64_t threads_created;
+  uint64_t threads_exited;
+  uint64_t p50_queue_time;
+  uint64_t p99_queue_time;
+} uv_threadpool_info_t;
+
+UV_EXTERN int uv_threadpool_set_size(unsigned int min, unsigned int max);
+UV_EXTERN int uv_threadpool_get_info(uv_threadpool_info_t* info);
+UV_EXTERN void uv_threadpool_reset_percentiles(void);
+UV_EXTERN void uv_loop_set_work_batch_cb(uv_loop_t* loop,
+                                         uv_work_batch_cb begin_cb,
+                                         uv_work_batch_cb end_cb,
+                                         void* arg);
+
 UV_EXTERN int uv_cancel(uv_req_t* req);
 
 
@@ -38,76 +38,533 @@ static void uv__req_init(uv_loop_t* loop,
 #endif
 
 #include <stdlib.h>
+#include <string.h>
 
 #define MAX_THREADPOOL_SIZE 128
 
+/* The pool grows by a thread when work has been waiting for longer than this
+ * and no thread is idle, and an extra thread exits after having been idle
+ * for THREADPOOL_IDLE_TIMEOUT. Both are in nanoseconds.
+ */
+#define THREADPOOL_GROW_WAIT ((uint64_t) 1e6)
+#define THREADPOOL_IDLE_TIMEOUT ((uint64_t) 5e9)
+
+/* Work classes are served in priority order, but a request that has been
+ * queued for longer than this runs ahead of higher priority classes, so that
+ * a flood of file system requests can't hold back everything else forever.
+ * In nanoseconds.
+ */
+#define THREADPOOL_MAX_WAIT ((uint64_t) 50e6)
+
+/* Upper bound on the number of requests that a worker moves from the shared
+ * queue to its own queue in one go.
+ */
+#define THREADPOOL_BATCH_SIZE 8
+
+/* Queue times are counted in power-of-two buckets of nanoseconds. */
+#define QUEUE_TIME_BUCKETS 48
+
+enum worker_state {
+  WORKER_UNUSED,
+  WORKER_RUNNING,
+  WORKER_EXITED  /* Needs a uv_thread_join(). */
+};
+
+/* Requests of classes without a concurrency limit are handed out to the
+ * workers in batches. A worker runs its own queue under its own mutex, and
+ * only goes back to the global mutex when it has run dry, to take a new batch
+ * or to steal half of another worker's queue. The counters for requests in a
+ * worker's queue live in the worker slot, uv_threadpool_get_stats() and
+ * uv_threadpool_get_info() add them up.
+ *
+ * Lock order is global mutex, then worker mutex, then the loop's wq_mutex.
+ * A worker that holds its own mutex never takes another lock.
+ */
+struct worker_slot {
+  uv_thread_t thread;
+  enum worker_state state;
+  uv_mutex_t mutex;
+  QUEUE wq;
+  uv_threadpool_stats_t stats[UV_WORK_CLASS_MAX];
+  uint64_t queue_time_histogram[QUEUE_TIME_BUCKETS];
+};
+
 static uv_once_t once = UV_ONCE_INIT;
 static uv_cond_t cond;
 static uv_mutex_t mutex;
 static unsigned int nthreads;
-static uv_thread_t* threads;
-static uv_thread_t default_threads[4];
-static QUEUE exit_message;
-static QUEUE wq;
+static unsigned int min_threads;
+static unsigned int max_threads;
+static unsigned int idle_threads;
+static unsigned int pending_wakeups;
+static unsigned int steal_start;
+static uint64_t threads_created;
+static uint64_t threads_exited;
+static struct worker_slot workers[MAX_THREADPOOL_SIZE];
+static QUEUE wq[UV_WORK_CLASS_MAX];
+static uv_threadpool_stats_t stats[UV_WORK_CLASS_MAX];
+static int limit_set[UV_WORK_CLASS_MAX];  /* By uv_threadpool_set_limit(). */
+static int exiting;
 static volatile int initialized;
 
+static void worker(void* arg);
+
 
 static void uv__cancelled(struct uv__work* w) {
   abort();
 }
 
 
+/* Returns the work item that should run next, or NULL if there is none that
+ * may run right now. That is the head of the first class in priority order
+ * that is under its limit, unless the head of another class has waited for
+ * longer than THREADPOOL_MAX_WAIT, in which case the request that has waited
+ * longest goes first. Must be called with the global mutex held.
+ */
+static QUEUE* next_work(void) {
+  struct uv__work* w;
+  uint64_t oldest;
+  uint64_t now;
+  unsigned int i;
+  QUEUE* next;
+  QUEUE* q;
+
+  next = NULL;
+  oldest = 0;
+  now = 0;
+
+  for (i = 0; i < UV_WORK_CLASS_MAX; i++) {
+    if (QUEUE_EMPTY(&wq[i]))
+      continue;
+    if (stats[i].limit != 0 && stats[i].running >= stats[i].limit)
+      continue;
+
+    q = QUEUE_HEAD(&wq[i]);
+    w = QUEUE_DATA(q, struct uv__work, wq);
+
+    if (next == NULL) {
+      next = q;
+      oldest = w->queued_at;
+      continue;
+    }
+
+    /* Only look at the clock when there is a choice to make. */
+    if (now == 0)
+      now = uv_hrtime();
+    if (w->queued_at < oldest && now - w->queued_at >= THREADPOOL_MAX_WAIT) {
+      next = q;
+      oldest = w->queued_at;
+    }
+  }
+
+  return next;
+}
+
+
+/* Wakes up as many as n idle workers, not counting the ones that have been
+ * signalled already but haven't woken up yet. Must be called with the global
+ * mutex held.
+ */
+static void wake_workers(unsigned int n) {
+  while (n > 0 && idle_threads > pending_wakeups) {
+    pending_wakeups++;
+    uv_cond_signal(&cond);
+    n--;
+  }
+}
+
+
+/* Starts one more worker. Must be called with the global mutex held. */
+static int spawn_worker(void) {
+  struct worker_slot* slot;
+  unsigned int i;
+
+  for (i = 0; i < ARRAY_SIZE(workers); i++)
+    if (workers[i].state != WORKER_RUNNING)
+      break;
+
+  if (i == ARRAY_SIZE(workers))
+    return UV_EAGAIN;
+
+  slot = workers + i;
+  if (slot->state == WORKER_EXITED)
+    if (uv_thread_join(&slot->thread))
+      abort();
+
+  slot->state = WORKER_UNUSED;
+  if (uv_thread_create(&slot->thread, worker, slot))
+    return UV_EAGAIN;
+
+  slot->state = WORKER_RUNNING;
+  nthreads++;
+  threads_created++;
+  return 0;
+}
+
+
+/* Adds a thread if the oldest runnable request has been queued for too long
+ * and every thread is busy. Must be called with the global mutex held.
+ */
+static void maybe_grow(uint64_t now) {
+  struct uv__work* w;
+  QUEUE* q;
+
+  if (idle_threads > 0 || nthreads >= max_threads)
+    return;
+
+  q = next_work();
+  if (q == NULL)
+    return;
+
+  w = QUEUE_DATA(q, struct uv__work, wq);
+  if (now - w->queued_at >= THREADPOOL_GROW_WAIT)
+    spawn_worker();
+}
+
+
+/* Must be called with the slot's mutex held. */
+static void record_queue_time(struct worker_slot* slot,
+                              unsigned int work_class,
+                              uint64_t queue_time) {
+  unsigned int bucket;
+
+  slot->stats[work_class].queue_time += queue_time;
+  if (queue_time > slot->stats[work_class].max_queue_time)
+    slot->stats[work_class].max_queue_time = queue_time;
+
+  for (bucket = 0; bucket < QUEUE_TIME_BUCKETS - 1; bucket++)
+    if ((queue_time >> (bucket + 1)) == 0)
+      break;
+
+  slot->queue_time_histogram[bucket]++;
+}
+
+
+/* Returns the upper bound of the bucket that holds the given percentile of
+ * the recorded queue times.
+ */
+static uint64_t queue_time_percentile(const uint64_t* histogram,
+                                      uint64_t total,
+                                      unsigned int percent) {
+  uint64_t rank;
+  uint64_t seen;
+  unsigned int i;
+
+  if (total == 0)
+    return 0;
+
+  rank = (total * percent + 99) / 100;
+  seen = 0;
+  for (i = 0; i < QUEUE_TIME_BUCKETS - 1; i++) {
+    seen += histogram[i];
+    if (seen >= rank)
+      break;
+  }
+
+  return ((uint64_t) 1 << (i + 1)) - 1;
+}
+
+
+/* Moves a batch of requests of the given class from the global queue to the
+ * worker's own queue. The batch is sized so that the other workers still get
+ * their share. Must be called with the global mutex held.
+ */
+static unsigned int take_batch(struct worker_slot* slot,
+                               unsigned int work_class) {
+  struct uv__work* w;
+  unsigned int n;
+  unsigned int i;
+  QUEUE* q;
+
+  n = stats[work_class].queued / nthreads;
+  if (n < 1)
+    n = 1;
+  if (n > THREADPOOL_BATCH_SIZE)
+    n = THREADPOOL_BATCH_SIZE;
+
+  uv_mutex_lock(&slot->mutex);
+  for (i = 0; i < n && !QUEUE_EMPTY(&wq[work_class]); i++) {
+    q = QUEUE_HEAD(&wq[work_class]);
+    QUEUE_REMOVE(q);
+    QUEUE_INSERT_TAIL(&slot->wq, q);
+    w = QUEUE_DATA(q, struct uv__work, wq);
+    w->owner = slot;
+  }
+  stats[work_class].queued -= i;
+  slot->stats[work_class].queued += i;
+  uv_mutex_unlock(&slot->mutex);
+
+  return i;
+}
+
+
+/* Moves the newer half of another worker's queue, rounded up, to the given
+ * worker's queue. The owner is busy running a request, so a lone request
+ * left in its queue would wait for that one to finish, however long it
+ * takes. Returns the number of requests that were moved. Must be called
+ * with the global mutex held, which also makes sure that only one thread at
+ * a time holds two worker mutexes.
+ */
+static unsigned int steal_work(struct worker_slot* slot) {
+  struct worker_slot* victim;
+  struct uv__work* w;
+  unsigned int n;
+  unsigned int i;
+  unsigned int j;
+  QUEUE* q;
+
+  for (i = 0; i < ARRAY_SIZE(workers); i++) {
+    victim = workers + (steal_start + i) % ARRAY_SIZE(workers);
+    if (victim == slot || victim->state != WORKER_RUNNING)
+      continue;
+
+    uv_mutex_lock(&victim->mutex);
+
+    n = 0;
+    QUEUE_FOREACH(q, &victim->wq)
+      n++;
+    n = (n + 1) / 2;
+
+    if (n == 0) {
+      uv_mutex_unlock(&victim->mutex);
+      continue;
+    }
+
+    steal_start += i + 1;
+
+    uv_mutex_lock(&slot->mutex);
+    for (j = 0; j < n; j++) {
+      q = QUEUE_PREV(&victim->wq);
+      QUEUE_REMOVE(q);
+      QUEUE_INSERT_HEAD(&slot->wq, q);
+      w = QUEUE_DATA(q, struct uv__work, wq);
+      w->owner = slot;
+      victim->stats[w->work_class].queued--;
+      slot->stats[w->work_class].queued++;
+    }
+    uv_mutex_unlock(&slot->mutex);
+    uv_mutex_unlock(&victim->mutex);
+
+    return n;
+  }
+
+  return 0;
+}
+
+
+static void post_done(struct uv__work* w) {
+  uv_mutex_lock(&w->loop->wq_mutex);
+  w->work = NULL;  /* Signal uv_cancel() that the work req is done
+                      executing. */
+  QUEUE_INSERT_TAIL(&w->loop->wq, &w->wq);
+  uv_async_send(&w->loop->wq_async);
+  uv_mutex_unlock(&w->loop->wq_mutex);
+}
+
+
+/* Gets another thread to steal from a worker whose own queue isn't moving,
+ * either by waking up an idle thread or by growing the pool.
+ */
+static void get_help(void) {
+  uv_mutex_lock(&mutex);
+  if (idle_threads > 0)
+    wake_workers(1);
+  else if (nthreads < max_threads)
+    spawn_worker();
+  uv_mutex_unlock(&mutex);
+}
+
+
+/* Runs the requests in the worker's own queue. */
+static void run_batch(struct worker_slot* slot) {
+  struct uv__work* w;
+  unsigned int work_class;
+  uint64_t queue_time;
+  QUEUE* q;
+  int more;
+
+  uv_mutex_lock(&slot->mutex);
+
+  while (!QUEUE_EMPTY(&slot->wq)) {
+    q = QUEUE_HEAD(&slot->wq);
+    QUEUE_REMOVE(q);
+    QUEUE_INIT(q);  /* Signal uv_cancel() that the work req is
+                       executing. */
+
+    w = QUEUE_DATA(q, struct uv__work, wq);
+    work_class = w->work_class;
+    queue_time = uv_hrtime() - w->queued_at;
+    slot->stats[work_class].queued--;
+    slot->stats[work_class].running++;
+    record_queue_time(slot, work_class, queue_time);
+    more = !QUEUE_EMPTY(&slot->wq);
+    uv_mutex_unlock(&slot->mutex);
+
+    /* The rest of the batch has been waiting at least as long. */
+    if (more && queue_time >= THREADPOOL_GROW_WAIT)
+      get_help();
+
+    w->work(w);
+
+    uv_mutex_lock(&slot->mutex);
+    slot->stats[work_class].running--;
+    slot->stats[work_class].completed++;
+    uv_mutex_unlock(&slot->mutex);
+
+    post_done(w);
+
+    uv_mutex_lock(&slot->mutex);
+  }
+
+  uv_mutex_unlock(&slot->mutex);
+}
+
+
 /* To avoid deadlock with uv_cancel() it's crucial that the worker
  * never holds the global mutex and the loop-local mutex at the same time.
  */
 static void worker(void* arg) {
+  struct worker_slot* slot;
   struct uv__work* w;
+  unsigned int work_class;
+  unsigned int n;
+  uint64_t queue_time;
+  uint64_t now;
   QUEUE* q;
+  int err;
 
-  (void) arg;
+  slot = arg;
 
-  for (;;) {
-    uv_mutex_lock(&mutex);
+  uv_mutex_lock(&mutex);
 
-    while (QUEUE_EMPTY(&wq))
-      uv_cond_wait(&cond, &mutex);
+  for (;;) {
+    q = NULL;
+    n = 0;
+    while (!exiting &&
+           nthreads <= max_threads &&
+           (q = next_work()) == NULL &&
+           (n = steal_work(slot)) == 0) {
+      idle_threads++;
+      if (nthreads > min_threads) {
+        err = uv_cond_timedwait(&cond, &mutex, THREADPOOL_IDLE_TIMEOUT);
+      } else {
+        uv_cond_wait(&cond, &mutex);
+        err = 0;
+      }
+      idle_threads--;
+      if (pending_wakeups > 0)
+        pending_wakeups--;
+
+      if (err == UV_ETIMEDOUT && nthreads > min_threads && next_work() == NULL)
+        break;
+    }
 
-    q = QUEUE_HEAD(&wq);
+    if (exiting)
+      break;
 
-    if (q == &exit_message)
-      uv_cond_signal(&cond);
-    else {
-      QUEUE_REMOVE(q);
-      QUEUE_INIT(q);  /* Signal uv_cancel() that the work req is
-                             executing. */
+    /* Stolen work. Leave the rest to the others. */
+    if (n > 0) {
+      uv_mutex_unlock(&mutex);
+      run_batch(slot);
+      uv_mutex_lock(&mutex);
+      continue;
     }
 
-    uv_mutex_unlock(&mutex);
-
-    if (q == &exit_message)
+    /* Idle for too long, or the pool was made smaller. */
+    if (nthreads > max_threads || q == NULL) {
+      slot->state = WORKER_EXITED;
+      nthreads--;
+      threads_exited++;
       break;
+    }
 
     w = QUEUE_DATA(q, struct uv__work, wq);
+    work_class = w->work_class;
+    now = uv_hrtime();
+    queue_time = now - w->queued_at;
+
+    if (stats[work_class].limit == 0) {
+      if (queue_time >= THREADPOOL_GROW_WAIT)
+        maybe_grow(now);
+      n = take_batch(slot, work_class);
+      /* The rest of the batch is there for the taking as well. */
+      wake_workers(n - 1 + (next_work() != NULL));
+      uv_mutex_unlock(&mutex);
+      run_batch(slot);
+      uv_mutex_lock(&mutex);
+      continue;
+    }
+
+    /* Classes with a concurrency limit run straight from the global queue,
+     * the running count has to be right at all times.
+     */
+    QUEUE_REMOVE(q);
+    QUEUE_INIT(q);  /* Signal uv_cancel() that the work req is
+                           executing. */
+
+    stats[work_class].queued--;
+    stats[work_class].running++;
+    uv_mutex_lock(&slot->mutex);
+    record_queue_time(slot, work_class, queue_time);
+    uv_mutex_unlock(&slot->mutex);
+
+    /* Work that was held back by a concurrency limit doesn't get a wake-up
+     * of its own when it becomes runnable, pass it on.
+     */
+    if (next_work() != NULL)
+      wake_workers(1);
+    if (queue_time >= THREADPOOL_GROW_WAIT)
+      maybe_grow(now);
+
+    uv_mutex_unlock(&mutex);
+
     w->work(w);
 
-    uv_mutex_lock(&w->loop->wq_mutex);
-    w->work = NULL;  /* Signal uv_cancel() that the work req is done
-                        executing. */
-    QUEUE_INSERT_TAIL(&w->loop->wq, &w->wq);
-    uv_async_send(&w->loop->wq_async);
-    uv_mutex_unlock(&w->loop->wq_mutex);
+    /* Update the counters before the loop thread gets to see the request
+     * so they are current by the time the done callback runs.
+     */
+    uv_mutex_lock(&mutex);
+    stats[work_class].running--;
+    stats[work_class].completed++;
+    uv_mutex_unlock(&mutex);
+
+    post_done(w);
+
+    uv_mutex_lock(&mutex);
   }
+
+  uv_mutex_unlock(&mutex);
 }
 
 
-static void post(QUEUE* q) {
+static void post(struct uv__work* w) {
+  w->queued_at = uv_hrtime();
+  w->owner = NULL;
   uv_mutex_lock(&mutex);
-  QUEUE_INSERT_TAIL(&wq, q);
-  uv_cond_signal(&cond);
+  QUEUE_INSERT_TAIL(&wq[w->work_class], &w->wq);
+  stats[w->work_class].queued++;
+  stats[w->work_class].submitted++;
+  if (idle_threads > 0)
+    wake_workers(1);
+  else
+    maybe_grow(w->queued_at);
   uv_mutex_unlock(&mutex);
 }
 
 
+/* Slow DNS lookups may use no more than half of the pool and CPU-bound work
+ * always leaves a thread free, so neither can starve file I/O. Limits that
+ * were set explicitly are left alone. Must be called with the global mutex
+ * held, or before the pool has started.
+ */
+static void default_limits(void) {
+  if (!limit_set[UV_WORK_DNS])
+    stats[UV_WORK_DNS].limit = (min_threads + 1) / 2;
+  if (!limit_set[UV_WORK_CPU])
+    stats[UV_WORK_CPU].limit = min_threads > 1 ? min_threads - 1 : 1;
+}
+
+
 #ifndef _WIN32
 UV_DESTRUCTOR(static void cleanup(void)) {
   unsigned int i;
@@ -115,19 +572,22 @@ UV_DESTRUCTOR(static void cleanup(void)) {
   if (initialized == 0)
     return;
 
-  post(&exit_message);
-
-  for (i = 0; i < nthreads; i++)
-    if (uv_thread_join(threads + i))
-      abort();
+  uv_mutex_lock(&mutex);
+  exiting = 1;
+  uv_cond_broadcast(&cond);
+  uv_mutex_unlock(&mutex);
 
-  if (threads != default_threads)
-    free(threads);
+  for (i = 0; i < ARRAY_SIZE(workers); i++) {
+    if (workers[i].state != WORKER_UNUSED)
+      if (uv_thread_join(&workers[i].thread))
+        abort();
+    workers[i].state = WORKER_UNUSED;
+    uv_mutex_destroy(&workers[i].mutex);
+  }
 
   uv_mutex_destroy(&mutex);
   uv_cond_destroy(&cond);
 
-  threads = NULL;
   nthreads = 0;
   initialized = 0;
 }
@@ -138,23 +598,24 @@ static void init_once(void) {
   unsigned int i;
   const char* val;
 
-  nthreads = ARRAY_SIZE(default_threads);
+  min_threads = 4;
   val = getenv("UV_THREADPOOL_SIZE");
   if (val != NULL)
-    nthreads = atoi(val);
-  if (nthreads == 0)
-    nthreads = 1;
-  if (nthreads > MAX_THREADPOOL_SIZE)
-    nthreads = MAX_THREADPOOL_SIZE;
-
-  threads = default_threads;
-  if (nthreads > ARRAY_SIZE(default_threads)) {
-    threads = malloc(nthreads * sizeof(threads[0]));
-    if (threads == NULL) {
-      nthreads = ARRAY_SIZE(default_threads);
-      threads = default_threads;
-    }
-  }
+    min_threads = atoi(val);
+  if (min_threads == 0)
+    min_threads = 1;
+  if (min_threads > MAX_THREADPOOL_SIZE)
+    min_threads = MAX_THREADPOOL_SIZE;
+
+  /* The pool only grows past UV_THREADPOOL_SIZE when asked to. */
+  max_threads = min_threads;
+  val = getenv("UV_THREADPOOL_MAX_SIZE");
+  if (val != NULL)
+    max_threads = atoi(val);
+  if (max_threads < min_threads)
+    max_threads = min_threads;
+  if (max_threads > MAX_THREADPOOL_SIZE)
+    max_threads = MAX_THREADPOOL_SIZE;
 
   if (uv_cond_init(&cond))
     abort();
@@ -162,11 +623,22 @@ static void init_once(void) {
   if (uv_mutex_init(&mutex))
     abort();
 
-  QUEUE_INIT(&wq);
+  for (i = 0; i < UV_WORK_CLASS_MAX; i++)
+    QUEUE_INIT(&wq[i]);
+
+  for (i = 0; i < ARRAY_SIZE(workers); i++) {
+    if (uv_mutex_init(&workers[i].mutex))
+      abort();
+    QUEUE_INIT(&workers[i].wq);
+  }
+
+  default_limits();
 
-  for (i = 0; i < nthreads; i++)
-    if (uv_thread_create(threads + i, worker, NULL))
+  uv_mutex_lock(&mutex);
+  for (i = 0; i < min_threads; i++)
+    if (spawn_worker())
       abort();
+  uv_mutex_unlock(&mutex);
 
   initialized = 1;
 }
@@ -174,27 +646,42 @@ static void init_once(void) {
 
 void uv__work_submit(uv_loop_t* loop,
                      struct uv__work* w,
+                     uv_work_class work_class,
                      void (*work)(struct uv__work* w),
                      void (*done)(struct uv__work* w, int status)) {
   uv_once(&once, init_once);
   w->loop = loop;
   w->work = work;
   w->done = done;
-  post(&w->wq);
+  w->work_class = work_class;
+  post(w);
 }
 
 
 static int uv__work_cancel(uv_loop_t* loop, uv_req_t* req, struct uv__work* w) {
+  struct worker_slot* slot;
   int cancelled;
 
+  /* The owner only changes while the global mutex is held. */
   uv_mutex_lock(&mutex);
+  slot = w->owner;
+  if (slot != NULL)
+    uv_mutex_lock(&slot->mutex);
   uv_mutex_lock(&w->loop->wq_mutex);
 
   cancelled = !QUEUE_EMPTY(&w->wq) && w->work != NULL;
-  if (cancelled)
+  if (cancelled) {
     QUEUE_REMOVE(&w->wq);
+    if (slot != NULL)
+      slot->stats[w->work_class].queued--;
+    else
+      stats[w->work_class].queued--;
+    stats[w->work_class].cancelled++;
+  }
 
   uv_mutex_unlock(&w->loop->wq_mutex);
+  if (slot != NULL)
+    uv_mutex_unlock(&slot->mutex);
   uv_mutex_unlock(&mutex);
 
   if (!cancelled)
@@ -213,6 +700,7 @@ static int uv__work_cancel(uv_loop_t* loop, uv_req_t* req, struct uv__work* w) {
 void uv__work_done(uv_async_t* handle) {
   struct uv__work* w;
   uv_loop_t* loop;
+  unsigned int count;
   QUEUE* q;
   QUEUE wq;
   int err;
@@ -227,6 +715,16 @@ void uv__work_done(uv_async_t* handle) {
   }
   uv_mutex_unlock(&loop->wq_mutex);
 
+  if (QUEUE_EMPTY(&wq))
+    return;
+
+  count = 0;
+  QUEUE_FOREACH(q, &wq)
+    count++;
+
+  if (loop->work_batch_begin_cb != NULL)
+    loop->work_batch_begin_cb(loop, count, loop->work_batch_arg);
+
   while (!QUEUE_EMPTY(&wq)) {
     q = QUEUE_HEAD(&wq);
     QUEUE_REMOVE(q);
@@ -235,6 +733,19 @@ void uv__work_done(uv_async_t* handle) {
     err = (w->work == uv__cancelled) ? UV_ECANCELED : 0;
     w->done(w, err);
   }
+
+  if (loop->work_batch_end_cb != NULL)
+    loop->work_batch_end_cb(loop, count, loop->work_batch_arg);
+}
+
+
+void uv_loop_set_work_batch_cb(uv_loop_t* loop,
+                               uv_work_batch_cb begin_cb,
+                               uv_work_batch_cb end_cb,
+                               void* arg) {
+  loop->work_batch_begin_cb = begin_cb;
+  loop->work_batch_end_cb = end_cb;
+  loop->work_batch_arg = arg;
 }
 
 
@@ -262,14 +773,162 @@ int uv_queue_work(uv_loop_t* loop,
                   uv_work_t* req,
                   uv_work_cb work_cb,
                   uv_after_work_cb after_work_cb) {
+  return uv_queue_work_class(loop, req, UV_WORK_USER, work_cb, after_work_cb);
+}
+
+
+int uv_queue_work_class(uv_loop_t* loop,
+                        uv_work_t* req,
+                        uv_work_class work_class,
+                        uv_work_cb work_cb,
+                        uv_after_work_cb after_work_cb) {
   if (work_cb == NULL)
     return UV_EINVAL;
 
+  if ((unsigned int) work_class >= UV_WORK_CLASS_MAX)
+    return UV_EINVAL;
+
   uv__req_init(loop, req, UV_WORK);
   req->loop = loop;
   req->work_cb = work_cb;
   req->after_work_cb = after_work_cb;
-  uv__work_submit(loop, &req->work_req, uv__queue_work, uv__queue_done);
+  uv__work_submit(loop,
+                  &req->work_req,
+                  work_class,
+                  uv__queue_work,
+                  uv__queue_done);
+  return 0;
+}
+
+
+int uv_threadpool_set_limit(uv_work_class work_class, unsigned int limit) {
+  if ((unsigned int) work_class >= UV_WORK_CLASS_MAX)
+    return UV_EINVAL;
+
+  uv_once(&once, init_once);
+  uv_mutex_lock(&mutex);
+  stats[work_class].limit = limit;
+  limit_set[work_class] = 1;
+  /* Raising the limit may have made queued work runnable. */
+  uv_cond_broadcast(&cond);
+  uv_mutex_unlock(&mutex);
+
+  return 0;
+}
+
+
+int uv_threadpool_set_size(unsigned int min, unsigned int max) {
+  if (min == 0 || min > max || max > MAX_THREADPOOL_SIZE)
+    return UV_EINVAL;
+
+  uv_once(&once, init_once);
+  uv_mutex_lock(&mutex);
+  min_threads = min;
+  max_threads = max;
+  default_limits();
+  while (nthreads < min_threads)
+    if (spawn_worker())
+      break;
+  /* Superfluous threads exit the next time they look for work. */
+  uv_cond_broadcast(&cond);
+  uv_mutex_unlock(&mutex);
+
+  return 0;
+}
+
+
+int uv_threadpool_get_info(uv_threadpool_info_t* info) {
+  uint64_t histogram[QUEUE_TIME_BUCKETS];
+  struct worker_slot* slot;
+  uint64_t total;
+  unsigned int i;
+  unsigned int j;
+
+  uv_once(&once, init_once);
+  uv_mutex_lock(&mutex);
+
+  info->threads = nthreads;
+  info->idle_threads = idle_threads;
+  info->min_threads = min_threads;
+  info->max_threads = max_threads;
+  info->queued = 0;
+  info->running = 0;
+  for (i = 0; i < UV_WORK_CLASS_MAX; i++) {
+    info->queued += stats[i].queued;
+    info->running += stats[i].running;
+  }
+  info->threads_created = threads_created;
+  info->threads_exited = threads_exited;
+
+  memset(histogram, 0, sizeof(histogram));
+  for (i = 0; i < ARRAY_SIZE(workers); i++) {
+    slot = workers + i;
+    uv_mutex_lock(&slot->mutex);
+    for (j = 0; j < UV_WORK_CLASS_MAX; j++) {
+      info->queued += slot->stats[j].queued;
+      info->running += slot->stats[j].running;
+    }
+    for (j = 0; j < QUEUE_TIME_BUCKETS; j++)
+      histogram[j] += slot->queue_time_histogram[j];
+    uv_mutex_unlock(&slot->mutex);
+  }
+
+  total = 0;
+  for (i = 0; i < QUEUE_TIME_BUCKETS; i++)
+    total += histogram[i];
+  info->p50_queue_time = queue_time_percentile(histogram, total, 50);
+  info->p99_queue_time = queue_time_percentile(histogram, total, 99);
+
+  uv_mutex_unlock(&mutex);
+
+  return 0;
+}
+
+
+void uv_threadpool_reset_percentiles(void) {
+  struct worker_slot* slot;
+  unsigned int i;
+
+  uv_once(&once, init_once);
+  uv_mutex_lock(&mutex);
+
+  for (i = 0; i < ARRAY_SIZE(workers); i++) {
+    slot = workers + i;
+    uv_mutex_lock(&slot->mutex);
+    memset(slot->queue_time_histogram, 0, sizeof(slot->queue_time_histogram));
+    uv_mutex_unlock(&slot->mutex);
+  }
+
+  uv_mutex_unlock(&mutex);
+}
+
+
+int uv_threadpool_get_stats(uv_work_class work_class,
+                            uv_threadpool_stats_t* out) {
+  uv_threadpool_stats_t* s;
+  unsigned int i;
+
+  if ((unsigned int) work_class >= UV_WORK_CLASS_MAX)
+    return UV_EINVAL;
+
+  uv_once(&once, init_once);
+  uv_mutex_lock(&mutex);
+
+  *out = stats[work_class];
+  for (i = 0; i < ARRAY_SIZE(workers); i++) {
+    uv_mutex_lock(&workers[i].mutex);
+    s = &workers[i].stats[work_class];
+    out->queued += s->queued;
+    out->running += s->running;
+    out->completed += s->completed;
+    out->queue_time += s->queue_time;
+    if (s->max_queue_time > out->max_queue_time)
+      out->max_queue_time = s->max_queue_time;
+    uv_mutex_unlock(&workers[i].mutex);
+  }
+
+  uv_mutex_unlock(&mutex);
+
   return 0;
 }
 
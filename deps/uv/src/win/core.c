@@ -174,6 +174,10 @@ int uv_loop_init(uv_loop_t* loop) {
   uv__handle_unref(&loop->wq_async);
   loop->wq_async.flags |= UV__HANDLE_INTERNAL;
 
+  loop->work_batch_begin_cb = NULL;
+  loop->work_batch_end_cb = NULL;
+  loop->work_batch_arg = NULL;
+
   return 0;
 }
 
@@ -63,6 +63,7 @@ BENCHMARK_DECLARE (udp_timed_pummel_1000v1000)
 
 BENCHMARK_DECLARE (getaddrinfo)
 BENCHMARK_DECLARE (fs_stat)
+BENCHMARK_DECLARE (threadpool)
 BENCHMARK_DECLARE (async1)
 BENCHMARK_DECLARE (async2)
 BENCHMARK_DECLARE (async4)
@@ -146,6 +147,7 @@ TASK_LIST_START
   BENCHMARK_ENTRY  (getaddrinfo)
 
   BENCHMARK_ENTRY  (fs_stat)
+  BENCHMARK_ENTRY  (threadpool)
 
   BENCHMARK_ENTRY  (async1)
   BENCHMARK_ENTRY  (async2)
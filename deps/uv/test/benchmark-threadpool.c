@@ -0,0 +1,85 @@
+/* Copyright Joyent, Inc. and other Node contributors. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#include "task.h"
+#include "uv.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#define NUM_REQS    (64 * 1024)
+#define NUM_ROUNDS  8
+
+static uv_work_t reqs[NUM_REQS];
+static unsigned int done_count;
+
+
+static void work_cb(uv_work_t* req) {
+  volatile unsigned int i;
+
+  /* A couple of microseconds of work, about what a cached stat() costs. */
+  for (i = 0; i < 500; i++);
+}
+
+
+static void after_work_cb(uv_work_t* req, int status) {
+  ASSERT(status == 0);
+  done_count++;
+}
+
+
+/* Measures the overhead of getting lots of tiny requests through the thread
+ * pool for increasing pool sizes. Ideally throughput goes up with the number
+ * of threads until it hits the number of CPUs, and stays flat after that.
+ */
+BENCHMARK_IMPL(threadpool) {
+  static const unsigned int sizes[] = { 1, 2, 4, 8, 16, 32, 64 };
+  uv_loop_t* loop;
+  uint64_t before;
+  uint64_t after;
+  unsigned int round;
+  unsigned int i;
+  unsigned int j;
+
+  loop = uv_default_loop();
+
+  for (i = 0; i < ARRAY_SIZE(sizes); i++) {
+    ASSERT(0 == uv_threadpool_set_size(sizes[i], sizes[i]));
+    done_count = 0;
+
+    before = uv_hrtime();
+    for (round = 0; round < NUM_ROUNDS; round++) {
+      for (j = 0; j < NUM_REQS; j++)
+        ASSERT(0 == uv_queue_work(loop, reqs + j, work_cb, after_work_cb));
+      ASSERT(0 == uv_run(loop, UV_RUN_DEFAULT));
+    }
+    after = uv_hrtime();
+
+    ASSERT(done_count == NUM_REQS * NUM_ROUNDS);
+    printf("threadpool %2u threads: %s reqs/s\n",
+           sizes[i],
+           fmt(done_count / ((after - before) / 1e9)));
+    fflush(stdout);
+  }
+
+  MAKE_VALGRIND_HAPPY();
+  return 0;
+}
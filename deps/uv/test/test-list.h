@@ -264,12 +264,21 @@ TEST_DECLARE   (fs_rename_to_existing_file)
 TEST_DECLARE   (fs_write_multiple_bufs)
 TEST_DECLARE   (threadpool_queue_work_simple)
 TEST_DECLARE   (threadpool_queue_work_einval)
+TEST_DECLARE   (threadpool_work_batch)
+TEST_DECLARE   (threadpool_steal_last)
 TEST_DECLARE   (threadpool_multiple_event_loops)
 TEST_DECLARE   (threadpool_cancel_getaddrinfo)
 TEST_DECLARE   (threadpool_cancel_getnameinfo)
 TEST_DECLARE   (threadpool_cancel_work)
 TEST_DECLARE   (threadpool_cancel_fs)
 TEST_DECLARE   (threadpool_cancel_single)
+TEST_DECLARE   (threadpool_cancel_batched)
+TEST_DECLARE   (threadpool_class_limit)
+TEST_DECLARE   (threadpool_class_priority)
+TEST_DECLARE   (threadpool_class_starvation)
+TEST_DECLARE   (threadpool_class_einval)
+TEST_DECLARE   (threadpool_grow)
+TEST_DECLARE   (threadpool_set_size)
 TEST_DECLARE   (thread_local_storage)
 TEST_DECLARE   (thread_mutex)
 TEST_DECLARE   (thread_rwlock)
@@ -657,12 +666,21 @@ TASK_LIST_START
   TEST_ENTRY  (fs_write_multiple_bufs)
   TEST_ENTRY  (threadpool_queue_work_simple)
   TEST_ENTRY  (threadpool_queue_work_einval)
+  TEST_ENTRY  (threadpool_work_batch)
+  TEST_ENTRY  (threadpool_steal_last)
   TEST_ENTRY  (threadpool_multiple_event_loops)
   TEST_ENTRY  (threadpool_cancel_getaddrinfo)
   TEST_ENTRY  (threadpool_cancel_getnameinfo)
   TEST_ENTRY  (threadpool_cancel_work)
   TEST_ENTRY  (threadpool_cancel_fs)
   TEST_ENTRY  (threadpool_cancel_single)
+  TEST_ENTRY  (threadpool_cancel_batched)
+  TEST_ENTRY  (threadpool_class_limit)
+  TEST_ENTRY  (threadpool_class_priority)
+  TEST_ENTRY  (threadpool_class_starvation)
+  TEST_ENTRY  (threadpool_class_einval)
+  TEST_ENTRY  (threadpool_grow)
+  TEST_ENTRY  (threadpool_set_size)
   TEST_ENTRY  (thread_local_storage)
   TEST_ENTRY  (thread_mutex)
   TEST_ENTRY  (thread_rwlock)
@@ -357,3 +357,94 @@ TEST_IMPL(threadpool_cancel_single) {
   MAKE_VALGRIND_HAPPY();
   return 0;
 }
+
+
+static uv_sem_t started_sem;
+static unsigned int batched_cancelled;
+static unsigned int batched_completed;
+
+
+static void gated_work_cb(uv_work_t* req) {
+  uv_mutex_t* gate;
+
+  gate = req->data;
+  uv_sem_post(&started_sem);
+  uv_mutex_lock(gate);
+  uv_mutex_unlock(gate);
+}
+
+
+static void gated_done_cb(uv_work_t* req, int status) {
+  if (status == UV_ECANCELED)
+    batched_cancelled++;
+  else if (status == 0)
+    batched_completed++;
+}
+
+
+/* Requests that a worker has already taken off the global queue as part of
+ * a batch but hasn't started yet can still be cancelled.
+ */
+TEST_IMPL(threadpool_cancel_batched) {
+  uv_threadpool_stats_t stats;
+  uv_mutex_t cpu_gate;
+  uv_mutex_t user_gate;
+  uv_work_t cpu_req;
+  uv_work_t reqs[16];
+  uv_loop_t* loop;
+  unsigned int busy;
+  unsigned int i;
+
+  loop = uv_default_loop();
+  ASSERT(0 == uv_threadpool_set_size(1, 1));
+  ASSERT(0 == uv_sem_init(&started_sem, 0));
+  ASSERT(0 == uv_mutex_init(&cpu_gate));
+  ASSERT(0 == uv_mutex_init(&user_gate));
+  uv_mutex_lock(&cpu_gate);
+  uv_mutex_lock(&user_gate);
+
+  /* Keep the only thread busy while the other requests queue up. */
+  cpu_req.data = &cpu_gate;
+  ASSERT(0 == uv_queue_work_class(loop,
+                                  &cpu_req,
+                                  UV_WORK_CPU,
+                                  gated_work_cb,
+                                  gated_done_cb));
+  uv_sem_wait(&started_sem);
+
+  for (i = 0; i < ARRAY_SIZE(reqs); i++) {
+    reqs[i].data = &user_gate;
+    ASSERT(0 == uv_queue_work(loop, reqs + i, gated_work_cb, gated_done_cb));
+  }
+
+  /* The thread now takes a batch of requests and blocks in the first one. */
+  uv_mutex_unlock(&cpu_gate);
+  uv_sem_wait(&started_sem);
+
+  busy = 0;
+  for (i = 0; i < ARRAY_SIZE(reqs); i++)
+    if (uv_cancel((uv_req_t*) (reqs + i)) != 0)
+      busy++;
+  ASSERT(busy == 1);
+
+  ASSERT(0 == uv_threadpool_get_stats(UV_WORK_USER, &stats));
+  ASSERT(stats.queued == 0);
+  ASSERT(stats.running == 1);
+  ASSERT(stats.cancelled == ARRAY_SIZE(reqs) - 1);
+
+  uv_mutex_unlock(&user_gate);
+  ASSERT(0 == uv_run(loop, UV_RUN_DEFAULT));
+  ASSERT(batched_cancelled == ARRAY_SIZE(reqs) - 1);
+  ASSERT(batched_completed == 2);
+
+  ASSERT(0 == uv_threadpool_get_stats(UV_WORK_USER, &stats));
+  ASSERT(stats.running == 0);
+  ASSERT(stats.completed == 1);
+
+  uv_mutex_destroy(&cpu_gate);
+  uv_mutex_destroy(&user_gate);
+  uv_sem_destroy(&started_sem);
+
+  MAKE_VALGRIND_HAPPY();
+  return 0;
+}
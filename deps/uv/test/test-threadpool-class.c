@@ -0,0 +1,261 @@
+/* Copyright Joyent, Inc. and other Node contributors. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#include "uv.h"
+#include "task.h"
+
+#include <stdlib.h>  /* putenv */
+
+#ifdef _WIN32
+# define putenv _putenv
+#endif
+
+#define NUM_REQS 8
+
+static uv_mutex_t mutex;
+static uv_sem_t blocker_sem;
+static unsigned int concurrent;
+static unsigned int max_concurrent;
+static unsigned int after_work_cb_called;
+static uv_work_class order[NUM_REQS];
+static unsigned int norder;
+
+
+static void counting_work_cb(uv_work_t* req) {
+  uv_mutex_lock(&mutex);
+  if (++concurrent > max_concurrent)
+    max_concurrent = concurrent;
+  uv_mutex_unlock(&mutex);
+
+  uv_sleep(10);
+
+  uv_mutex_lock(&mutex);
+  concurrent--;
+  uv_mutex_unlock(&mutex);
+}
+
+
+static void after_work_cb(uv_work_t* req, int status) {
+  ASSERT(status == 0);
+  after_work_cb_called++;
+}
+
+
+TEST_IMPL(threadpool_class_limit) {
+  uv_threadpool_stats_t stats;
+  uv_work_t reqs[NUM_REQS];
+  unsigned int i;
+
+  ASSERT(0 == uv_mutex_init(&mutex));
+  ASSERT(0 == uv_threadpool_set_limit(UV_WORK_USER, 1));
+
+  for (i = 0; i < NUM_REQS; i++)
+    ASSERT(0 == uv_queue_work(uv_default_loop(),
+                              reqs + i,
+                              counting_work_cb,
+                              after_work_cb));
+
+  ASSERT(0 == uv_run(uv_default_loop(), UV_RUN_DEFAULT));
+  ASSERT(after_work_cb_called == NUM_REQS);
+  ASSERT(max_concurrent == 1);
+
+  ASSERT(0 == uv_threadpool_get_stats(UV_WORK_USER, &stats));
+  ASSERT(stats.limit == 1);
+  ASSERT(stats.queued == 0);
+  ASSERT(stats.running == 0);
+  ASSERT(stats.submitted == NUM_REQS);
+  ASSERT(stats.completed == NUM_REQS);
+  ASSERT(stats.cancelled == 0);
+  /* Every request but the first had to wait for at least one other. */
+  ASSERT(stats.max_queue_time >= 10 * 1000 * 1000);
+  ASSERT(stats.queue_time >= stats.max_queue_time);
+
+  uv_mutex_destroy(&mutex);
+
+  MAKE_VALGRIND_HAPPY();
+  return 0;
+}
+
+
+static void blocker_work_cb(uv_work_t* req) {
+  uv_sem_wait(&blocker_sem);
+}
+
+
+static void ordered_work_cb(uv_work_t* req) {
+  uv_mutex_lock(&mutex);
+  order[norder++] = *(uv_work_class*) req->data;
+  uv_mutex_unlock(&mutex);
+}
+
+
+TEST_IMPL(threadpool_class_priority) {
+  static uv_work_class classes[] = {
+    UV_WORK_DNS, UV_WORK_CPU, UV_WORK_USER, UV_WORK_FS
+  };
+  static char threadpool_size[] = "UV_THREADPOOL_SIZE=1";
+
+  uv_work_t blocker;
+  uv_work_t reqs[ARRAY_SIZE(classes)];
+  unsigned int i;
+
+  /* With one thread, the queued requests run strictly one after another. */
+  ASSERT(0 == putenv(threadpool_size));
+  ASSERT(0 == uv_mutex_init(&mutex));
+  ASSERT(0 == uv_sem_init(&blocker_sem, 0));
+
+  ASSERT(0 == uv_queue_work(uv_default_loop(),
+                            &blocker,
+                            blocker_work_cb,
+                            after_work_cb));
+
+  for (i = 0; i < ARRAY_SIZE(classes); i++) {
+    reqs[i].data = classes + i;
+    ASSERT(0 == uv_queue_work_class(uv_default_loop(),
+                                    reqs + i,
+                                    classes[i],
+                                    ordered_work_cb,
+                                    after_work_cb));
+  }
+
+  uv_sem_post(&blocker_sem);
+  ASSERT(0 == uv_run(uv_default_loop(), UV_RUN_DEFAULT));
+  ASSERT(after_work_cb_called == 1 + ARRAY_SIZE(classes));
+
+  ASSERT(norder == ARRAY_SIZE(classes));
+  ASSERT(order[0] == UV_WORK_FS);
+  ASSERT(order[1] == UV_WORK_USER);
+  ASSERT(order[2] == UV_WORK_CPU);
+  ASSERT(order[3] == UV_WORK_DNS);
+
+  uv_sem_destroy(&blocker_sem);
+  uv_mutex_destroy(&mutex);
+
+  MAKE_VALGRIND_HAPPY();
+  return 0;
+}
+
+
+#define NUM_FLOOD_REQS 500
+#define FLOOD_QUEUE_DEPTH 8
+
+static uv_work_t flood_reqs[FLOOD_QUEUE_DEPTH];
+static unsigned int flood_submitted;
+static unsigned int flood_done;
+static unsigned int flood_done_before_cpu;
+static uint64_t cpu_queued_at;
+static uint64_t cpu_queue_time;
+
+
+static void flood_work_cb(uv_work_t* req) {
+  uv_sleep(1);
+}
+
+
+static void cpu_work_cb(uv_work_t* req) {
+  cpu_queue_time = uv_hrtime() - cpu_queued_at;
+}
+
+
+static void cpu_after_work_cb(uv_work_t* req, int status) {
+  ASSERT(status == 0);
+  flood_done_before_cpu = flood_done;
+  after_work_cb_called++;
+}
+
+
+/* Keeps the FS queue full by queueing a new request for every one that
+ * completes.
+ */
+static void flood_after_work_cb(uv_work_t* req, int status) {
+  ASSERT(status == 0);
+  flood_done++;
+  if (flood_submitted == NUM_FLOOD_REQS)
+    return;
+  flood_submitted++;
+  ASSERT(0 == uv_queue_work_class(uv_default_loop(),
+                                  req,
+                                  UV_WORK_FS,
+                                  flood_work_cb,
+                                  flood_after_work_cb));
+}
+
+
+TEST_IMPL(threadpool_class_starvation) {
+  static char threadpool_size[] = "UV_THREADPOOL_SIZE=1";
+  uv_work_t cpu_req;
+  unsigned int i;
+
+  /* With one thread, strict priority order would never get to the CPU
+   * request while FS requests keep coming in.
+   */
+  ASSERT(0 == putenv(threadpool_size));
+
+  for (i = 0; i < FLOOD_QUEUE_DEPTH; i++) {
+    flood_submitted++;
+    ASSERT(0 == uv_queue_work_class(uv_default_loop(),
+                                    flood_reqs + i,
+                                    UV_WORK_FS,
+                                    flood_work_cb,
+                                    flood_after_work_cb));
+  }
+
+  cpu_queued_at = uv_hrtime();
+  ASSERT(0 == uv_queue_work_class(uv_default_loop(),
+                                  &cpu_req,
+                                  UV_WORK_CPU,
+                                  cpu_work_cb,
+                                  cpu_after_work_cb));
+
+  ASSERT(0 == uv_run(uv_default_loop(), UV_RUN_DEFAULT));
+  ASSERT(after_work_cb_called == 1);
+  ASSERT(flood_done == NUM_FLOOD_REQS);
+
+  /* The CPU request ran while the flood was still going on, and didn't wait
+   * much longer than the 50 ms that a request may be passed over for.
+   */
+  ASSERT(flood_done_before_cpu < NUM_FLOOD_REQS / 2);
+  ASSERT(cpu_queue_time >= 50 * 1000 * 1000);
+  ASSERT(cpu_queue_time < 250 * 1000 * 1000);
+
+  MAKE_VALGRIND_HAPPY();
+  return 0;
+}
+
+
+TEST_IMPL(threadpool_class_einval) {
+  uv_threadpool_stats_t stats;
+  uv_work_t req;
+
+  ASSERT(UV_EINVAL == uv_queue_work_class(uv_default_loop(),
+                                          &req,
+                                          UV_WORK_CLASS_MAX,
+                                          counting_work_cb,
+                                          after_work_cb));
+  ASSERT(UV_EINVAL == uv_threadpool_set_limit(UV_WORK_CLASS_MAX, 1));
+  ASSERT(UV_EINVAL == uv_threadpool_get_stats(UV_WORK_CLASS_MAX, &stats));
+
+  ASSERT(0 == uv_threadpool_get_stats(UV_WORK_DNS, &stats));
+  ASSERT(stats.limit > 0);
+
+  MAKE_VALGRIND_HAPPY();
+  return 0;
+}
@@ -0,0 +1,145 @@
+/* Copyright Joyent, Inc. and other Node contributors. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#include "uv.h"
+#include "task.h"
+
+#include <stdlib.h>  /* putenv */
+
+#ifdef _WIN32
+# define putenv _putenv
+#endif
+
+#define NUM_REQS 16
+
+static unsigned int after_work_cb_called;
+
+
+static void slow_work_cb(uv_work_t* req) {
+  uv_sleep(20);
+}
+
+
+static void after_work_cb(uv_work_t* req, int status) {
+  ASSERT(status == 0);
+  after_work_cb_called++;
+}
+
+
+TEST_IMPL(threadpool_grow) {
+  static char size[] = "UV_THREADPOOL_SIZE=1";
+  static char max_size[] = "UV_THREADPOOL_MAX_SIZE=4";
+  uv_threadpool_info_t info;
+  uv_work_t reqs[NUM_REQS];
+  unsigned int i;
+
+  ASSERT(0 == putenv(size));
+  ASSERT(0 == putenv(max_size));
+
+  ASSERT(0 == uv_threadpool_get_info(&info));
+  ASSERT(info.threads == 1);
+  ASSERT(info.min_threads == 1);
+  ASSERT(info.max_threads == 4);
+
+  for (i = 0; i < NUM_REQS; i++)
+    ASSERT(0 == uv_queue_work(uv_default_loop(),
+                              reqs + i,
+                              slow_work_cb,
+                              after_work_cb));
+
+  ASSERT(0 == uv_run(uv_default_loop(), UV_RUN_DEFAULT));
+  ASSERT(after_work_cb_called == NUM_REQS);
+
+  /* The requests queue up behind each other, so the pool must have grown. */
+  ASSERT(0 == uv_threadpool_get_info(&info));
+  ASSERT(info.threads_created > 1);
+  ASSERT(info.threads > 1);
+  ASSERT(info.threads <= 4);
+  ASSERT(info.queued == 0);
+  ASSERT(info.running == 0);
+  ASSERT(info.p99_queue_time >= info.p50_queue_time);
+  ASSERT(info.p99_queue_time >= 1000 * 1000);
+
+  /* The percentiles only start over when asked to. */
+  ASSERT(0 == uv_threadpool_get_info(&info));
+  ASSERT(info.p99_queue_time >= 1000 * 1000);
+  uv_threadpool_reset_percentiles();
+  ASSERT(0 == uv_threadpool_get_info(&info));
+  ASSERT(info.p50_queue_time == 0);
+  ASSERT(info.p99_queue_time == 0);
+
+  MAKE_VALGRIND_HAPPY();
+  return 0;
+}
+
+
+TEST_IMPL(threadpool_set_size) {
+  uv_threadpool_stats_t stats;
+  uv_threadpool_info_t info;
+  unsigned int i;
+
+  ASSERT(UV_EINVAL == uv_threadpool_set_size(0, 1));
+  ASSERT(UV_EINVAL == uv_threadpool_set_size(3, 2));
+  ASSERT(UV_EINVAL == uv_threadpool_set_size(1, 129));
+
+  ASSERT(0 == uv_threadpool_set_size(6, 8));
+  ASSERT(0 == uv_threadpool_get_info(&info));
+  ASSERT(info.threads == 6);
+  ASSERT(info.min_threads == 6);
+  ASSERT(info.max_threads == 8);
+
+  /* The default limits follow the size of the pool. */
+  ASSERT(0 == uv_threadpool_get_stats(UV_WORK_DNS, &stats));
+  ASSERT(stats.limit == 3);
+  ASSERT(0 == uv_threadpool_get_stats(UV_WORK_CPU, &stats));
+  ASSERT(stats.limit == 5);
+
+  /* Idle threads notice right away that they are no longer needed. */
+  ASSERT(0 == uv_threadpool_set_size(2, 2));
+  for (i = 0; i < 100; i++) {
+    ASSERT(0 == uv_threadpool_get_info(&info));
+    if (info.threads == 2)
+      break;
+    uv_sleep(10);
+  }
+  ASSERT(info.threads == 2);
+  ASSERT(info.threads_exited == 4);
+
+  ASSERT(0 == uv_threadpool_get_stats(UV_WORK_DNS, &stats));
+  ASSERT(stats.limit == 1);
+  ASSERT(0 == uv_threadpool_get_stats(UV_WORK_CPU, &stats));
+  ASSERT(stats.limit == 1);
+
+  /* Threads that exited can be replaced. */
+  /* Limits that were set explicitly stay as they are. */
+  ASSERT(0 == uv_threadpool_set_limit(UV_WORK_CPU, 2));
+  ASSERT(0 == uv_threadpool_set_size(5, 5));
+  ASSERT(0 == uv_threadpool_get_info(&info));
+  ASSERT(info.threads == 5);
+
+  ASSERT(0 == uv_threadpool_get_stats(UV_WORK_DNS, &stats));
+  ASSERT(stats.limit == 3);
+  ASSERT(0 == uv_threadpool_get_stats(UV_WORK_CPU, &stats));
+  ASSERT(stats.limit == 2);
+
+  MAKE_VALGRIND_HAPPY();
+  return 0;
+}
@@ -74,3 +74,157 @@ TEST_IMPL(threadpool_queue_work_einval) {
   MAKE_VALGRIND_HAPPY();
   return 0;
 }
+
+
+static unsigned int batch_begin_count;
+static unsigned int batch_end_count;
+static unsigned int batch_size;
+static unsigned int batch_done;
+static unsigned int batch_total;
+
+
+static void batch_begin_cb(uv_loop_t* loop, unsigned int count, void* arg) {
+  ASSERT(arg == &data);
+  ASSERT(batch_size == 0);
+  ASSERT(count > 0);
+  batch_size = count;
+  batch_done = 0;
+  batch_begin_count++;
+}
+
+
+static void batch_end_cb(uv_loop_t* loop, unsigned int count, void* arg) {
+  ASSERT(arg == &data);
+  ASSERT(count == batch_size);
+  ASSERT(batch_done == batch_size);
+  batch_total += batch_size;
+  batch_size = 0;
+  batch_end_count++;
+}
+
+
+static void noop_work_cb(uv_work_t* req) {
+}
+
+
+static void batch_after_work_cb(uv_work_t* req, int status) {
+  ASSERT(status == 0);
+  ASSERT(batch_size > 0);
+  batch_done++;
+}
+
+
+TEST_IMPL(threadpool_work_batch) {
+  uv_work_t reqs[32];
+  uv_loop_t* loop;
+  unsigned int i;
+
+  loop = uv_default_loop();
+  uv_loop_set_work_batch_cb(loop, batch_begin_cb, batch_end_cb, &data);
+
+  for (i = 0; i < ARRAY_SIZE(reqs); i++)
+    ASSERT(0 == uv_queue_work(loop, reqs + i, noop_work_cb,
+                              batch_after_work_cb));
+
+  ASSERT(0 == uv_run(loop, UV_RUN_DEFAULT));
+  ASSERT(batch_total == ARRAY_SIZE(reqs));
+  ASSERT(batch_begin_count == batch_end_count);
+  ASSERT(batch_begin_count >= 1);
+  ASSERT(batch_begin_count <= ARRAY_SIZE(reqs));
+
+  /* Once cleared, the batch callbacks are no longer made. */
+  uv_loop_set_work_batch_cb(loop, NULL, NULL, NULL);
+  work_req.data = &data;
+  ASSERT(0 == uv_queue_work(loop, &work_req, work_cb, after_work_cb));
+  ASSERT(0 == uv_run(loop, UV_RUN_DEFAULT));
+  ASSERT(after_work_cb_count == 1);
+  ASSERT(batch_begin_count == batch_end_count);
+
+  MAKE_VALGRIND_HAPPY();
+  return 0;
+}
+
+
+#define NUM_SHORT_REQS 15
+
+static uv_mutex_t steal_mutex;
+static uv_sem_t blocker_sem;
+static uv_sem_t blocked_sem;
+static uint64_t short_done_at;
+static unsigned int short_done;
+
+
+static void blocker_work_cb(uv_work_t* req) {
+  uv_sem_post(&blocked_sem);
+  uv_sem_wait(&blocker_sem);
+}
+
+
+static void long_work_cb(uv_work_t* req) {
+  uv_sleep(2000);
+}
+
+
+static void short_work_cb(uv_work_t* req) {
+  uv_sleep(1);
+  uv_mutex_lock(&steal_mutex);
+  short_done++;
+  short_done_at = uv_hrtime();
+  uv_mutex_unlock(&steal_mutex);
+}
+
+
+static void steal_after_work_cb(uv_work_t* req, int status) {
+  ASSERT(status == 0);
+}
+
+
+TEST_IMPL(threadpool_steal_last) {
+  uv_work_t blockers[4];
+  uv_work_t long_req;
+  uv_work_t short_reqs[NUM_SHORT_REQS];
+  uv_loop_t* loop;
+  uint64_t start;
+  unsigned int i;
+
+  loop = uv_default_loop();
+  ASSERT(0 == uv_threadpool_set_size(ARRAY_SIZE(blockers),
+                                     ARRAY_SIZE(blockers)));
+  ASSERT(0 == uv_mutex_init(&steal_mutex));
+  ASSERT(0 == uv_sem_init(&blocker_sem, 0));
+  ASSERT(0 == uv_sem_init(&blocked_sem, 0));
+
+  /* Keep every thread busy while the real work is queued up, so that it
+   * is handed out in batches.
+   */
+  for (i = 0; i < ARRAY_SIZE(blockers); i++)
+    ASSERT(0 == uv_queue_work(loop, blockers + i, blocker_work_cb,
+                              steal_after_work_cb));
+  for (i = 0; i < ARRAY_SIZE(blockers); i++)
+    uv_sem_wait(&blocked_sem);
+
+  ASSERT(0 == uv_queue_work(loop, &long_req, long_work_cb,
+                            steal_after_work_cb));
+  for (i = 0; i < ARRAY_SIZE(short_reqs); i++)
+    ASSERT(0 == uv_queue_work(loop, short_reqs + i, short_work_cb,
+                              steal_after_work_cb));
+
+  start = uv_hrtime();
+  for (i = 0; i < ARRAY_SIZE(blockers); i++)
+    uv_sem_post(&blocker_sem);
+
+  ASSERT(0 == uv_run(loop, UV_RUN_DEFAULT));
+
+  /* None of the short requests waits for the long one, whichever batch
+   * they ended up in.
+   */
+  ASSERT(short_done == NUM_SHORT_REQS);
+  ASSERT(short_done_at - start < 1000 * 1000 * 1000);
+
+  uv_sem_destroy(&blocked_sem);
+  uv_sem_destroy(&blocker_sem);
+  uv_mutex_destroy(&steal_mutex);
+
+  MAKE_VALGRIND_HAPPY();
+  return 0;
+}
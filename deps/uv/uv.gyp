@@ -371,6 +371,8 @@
         'test/test-tcp-write-queue-order.c',
         'test/test-threadpool.c',
         'test/test-threadpool-cancel.c',
+        'test/test-threadpool-class.c',
+        'test/test-threadpool-size.c',
         'test/test-thread-equal.c',
         'test/test-mutexes.c',
         'test/test-thread.c',
@@ -452,6 +454,7 @@
         'test/benchmark-sizes.c',
         'test/benchmark-spawn.c',
         'test/benchmark-thread.c',
+        'test/benchmark-threadpool.c',
         'test/benchmark-tcp-write-batch.c',
         'test/benchmark-udp-pummel.c',
         'test/dns-server.c',
@@ -20,6 +20,7 @@ const kOnHeaders = HTTPParser.kOnHeaders | 0;
 const kOnHeadersComplete = HTTPParser.kOnHeadersComplete | 0;
 const kOnBody = HTTPParser.kOnBody | 0;
 const kOnMessageComplete = HTTPParser.kOnMessageComplete | 0;
+const kOnExecute = HTTPParser.kOnExecute | 0;
 
 // Only called in the slow case where slow means
 // that the request headers were either fragmented
@@ -156,6 +157,8 @@ var parsers = new FreeList('parsers', 1000, function() {
   parser[kOnHeadersComplete] = parserOnHeadersComplete;
   parser[kOnBody] = parserOnBody;
   parser[kOnMessageComplete] = parserOnMessageComplete;
+  parser[kOnExecute] = null;
+  parser._consumed = false;
 
   return parser;
 });
@@ -173,6 +176,9 @@ function freeParser(parser, req, socket) {
   if (parser) {
     parser._headers = [];
     parser.onIncoming = null;
+    if (parser._consumed)
+      unconsume(parser, parser.socket);
+    parser[kOnExecute] = null;
     if (parser.socket)
       parser.socket.parser = null;
     parser.socket = null;
@@ -191,6 +197,16 @@ function freeParser(parser, req, socket) {
 exports.freeParser = freeParser;
 
 
+// Hand the socket's reads back from the native parser to the socket itself.
+// The socket may be gone already, in which case there is nothing to restore.
+function unconsume(parser, socket) {
+  var handle = socket && socket._handle;
+  parser.unconsume(handle ? handle._externalStream : undefined);
+  parser._consumed = false;
+}
+exports.unconsume = unconsume;
+
+
 function ondrain() {
   if (this._httpMessage) this._httpMessage.emit('drain');
 }
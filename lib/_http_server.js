@@ -8,11 +8,13 @@ const assert = require('assert').ok;
 const common = require('_http_common');
 const parsers = common.parsers;
 const freeParser = common.freeParser;
+const unconsume = common.unconsume;
 const debug = common.debug;
 const CRLF = common.CRLF;
 const continueExpression = common.continueExpression;
 const chunkExpression = common.chunkExpression;
 const httpSocketSetup = common.httpSocketSetup;
+const kOnExecute = HTTPParser.kOnExecute | 0;
 const OutgoingMessage = require('_http_outgoing').OutgoingMessage;
 
 const STATUS_CODES = exports.STATUS_CODES = {
@@ -235,6 +237,10 @@ function Server(requestListener) {
   });
 
   this.timeout = 2 * 60 * 1000;
+
+  // Feed socket reads straight into the HTTP parser, bypassing the
+  // 'data' event. Off by default, see connectionListener().
+  this.nativeParsing = false;
 }
 util.inherits(Server, net.Server);
 
@@ -314,6 +320,22 @@ function connectionListener(socket) {
   socket.on('end', socketOnEnd);
   socket.on('data', socketOnData);
 
+  // Let the parser read from the handle directly. Plain TCP and pipe
+  // handles support this, wrapped streams (e.g. TLS) don't expose one.
+  var external = self.nativeParsing &&
+                 socket._handle &&
+                 socket._handle._externalStream;
+  if (external) {
+    parser.consume(external);
+    parser._consumed = true;
+    parser[kOnExecute] = onParserExecute;
+    socket.on('pause', onSocketPause);
+    socket.on('resume', onSocketResume);
+    // Anyone who wants the raw data gets it back through the socket.
+    socket.on = socketOnWrap;
+  }
+  external = null;
+
   // TODO(isaacs): Move all these functions out of here
   function socketOnError(e) {
     self.emit('clientError', e, this);
@@ -323,6 +345,16 @@ function connectionListener(socket) {
     assert(!socket._paused);
     debug('SERVER socketOnData %d', d.length);
     var ret = parser.execute(d);
+    onParserExecuteCommon(ret, d);
+  }
+
+  function onParserExecute(ret) {
+    socket._unrefTimer();
+    debug('SERVER onParserExecute %d', ret);
+    onParserExecuteCommon(ret, undefined);
+  }
+
+  function onParserExecuteCommon(ret, d) {
     if (ret instanceof Error) {
       debug('parse error');
       socket.destroy(ret);
@@ -332,6 +364,11 @@ function connectionListener(socket) {
       var req = parser.incoming;
       debug('SERVER upgrade or connect', req.method);
 
+      if (d === undefined)
+        d = parser.getCurrentBuffer();
+
+      if (parser._consumed)
+        unconsumeSocket();
       socket.removeListener('data', socketOnData);
       socket.removeListener('end', socketOnEnd);
       socket.removeListener('close', serverSocketCloseListener);
@@ -361,6 +398,39 @@ function connectionListener(socket) {
     }
   }
 
+  // The readable side never sees data while the parser consumes the handle,
+  // so pausing and resuming the socket has to reach the handle by hand.
+  function onSocketPause() {
+    if (socket._handle && socket._handle.reading) {
+      socket._handle.reading = false;
+      socket._handle.readStop();
+    }
+  }
+
+  function onSocketResume() {
+    if (socket._handle && !socket._handle.reading) {
+      socket._handle.reading = true;
+      socket._handle.readStart();
+    }
+  }
+
+  function socketOnWrap(ev, fn) {
+    var res = net.Socket.prototype.on.call(this, ev, fn);
+    if (ev === 'data' || ev === 'readable') {
+      if (parser && socket.parser === parser && parser._consumed)
+        unconsumeSocket();
+    }
+    return res;
+  }
+
+  function unconsumeSocket() {
+    unconsume(parser, socket);
+    parser[kOnExecute] = null;
+    socket.removeListener('pause', onSocketPause);
+    socket.removeListener('resume', onSocketResume);
+    socket.on = net.Socket.prototype.on;
+  }
+
   function socketOnEnd() {
     var socket = this;
     var ret = parser.finish();
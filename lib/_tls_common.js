@@ -8,6 +8,7 @@ var crypto = null;
 
 const binding = process.binding('crypto');
 const NativeSecureContext = binding.SecureContext;
+const NativeSessionCache = binding.SessionCache;
 
 function SecureContext(secureProtocol, flags, context) {
   if (!(this instanceof SecureContext)) {
@@ -32,6 +33,43 @@ function SecureContext(secureProtocol, flags, context) {
 exports.SecureContext = SecureContext;
 
 
+// The same default size as OpenSSL's internal cache.
+const kDefaultSessionCacheSize = 20 * 1024;
+
+function SessionCache(options) {
+  if (!(this instanceof SessionCache))
+    return new SessionCache(options);
+
+  if (!options) options = {};
+
+  var size = kDefaultSessionCacheSize;
+  if (options.size !== undefined) {
+    size = options.size;
+    if ((size >>> 0) !== size || size === 0)
+      throw new TypeError('size must be a positive integer');
+  }
+
+  var timeout = 0;
+  if (options.timeout !== undefined) {
+    timeout = options.timeout;
+    if ((timeout >>> 0) !== timeout)
+      throw new TypeError('timeout must be a non-negative integer');
+  }
+
+  this._handle = new NativeSessionCache(size, timeout);
+}
+
+SessionCache.prototype.getStats = function() {
+  return this._handle.getStats();
+};
+
+SessionCache.prototype.flush = function() {
+  this._handle.flush();
+};
+
+exports.SessionCache = SessionCache;
+
+
 exports.createSecureContext = function createSecureContext(options, context) {
   if (!options) options = {};
 
@@ -115,6 +153,12 @@ exports.createSecureContext = function createSecureContext(options, context) {
     c.context.setSessionIdContext(options.sessionIdContext);
   }
 
+  if (options.sessionCache) {
+    if (!(options.sessionCache instanceof SessionCache))
+      throw new TypeError('sessionCache must be a tls.SessionCache');
+    c.context.setSessionCache(options.sessionCache._handle);
+  }
+
   if (options.pfx) {
     var pfx = options.pfx;
     var passphrase = options.passphrase;
@@ -347,6 +347,8 @@ TLSSocket.prototype._init = function(socket, wrap) {
       if (listenerCount(this.server, 'OCSPRequest') > 0)
         ssl.enableCertCb();
     }
+    if (options.asyncPrivateKey)
+      ssl.enableAsyncPrivateKey();
   } else {
     ssl.onhandshakestart = function() {};
     ssl.onhandshakedone = this._finishInit.bind(this);
@@ -618,6 +620,8 @@ TLSSocket.prototype.getCipher = function(err) {
 // - cert: string.
 // - ca: string or array of strings.
 // - sessionTimeout: integer.
+// - sessionCache: tls.SessionCache, or false.
+// - asyncPrivateKey: boolean, default to false.
 //
 // emit 'secureConnection'
 //   function (tlsSocket) { }
@@ -668,7 +672,8 @@ function Server(/* [options], listener */) {
     secureOptions: self.secureOptions,
     honorCipherOrder: self.honorCipherOrder,
     crl: self.crl,
-    sessionIdContext: self.sessionIdContext
+    sessionIdContext: self.sessionIdContext,
+    sessionCache: self.sessionCache
   });
   this._sharedCreds = sharedCreds;
 
@@ -696,7 +701,8 @@ function Server(/* [options], listener */) {
       rejectUnauthorized: self.rejectUnauthorized,
       handshakeTimeout: timeout,
       NPNProtocols: self.NPNProtocols,
-      SNICallback: options.SNICallback || SNICallback
+      SNICallback: options.SNICallback || SNICallback,
+      asyncPrivateKey: self.asyncPrivateKey
     });
 
     socket.on('secure', function() {
@@ -785,6 +791,12 @@ Server.prototype.setOptions = function(options) {
   if (options.dhparam) this.dhparam = options.dhparam;
   if (options.sessionTimeout) this.sessionTimeout = options.sessionTimeout;
   if (options.ticketKeys) this.ticketKeys = options.ticketKeys;
+  if (options.sessionCache !== undefined)
+    this.sessionCache = options.sessionCache;
+  else if (this.sessionCache === undefined)
+    this.sessionCache = new tls.SessionCache();
+  if (options.asyncPrivateKey !== undefined)
+    this.asyncPrivateKey = !!options.asyncPrivateKey;
   var secureOptions = options.secureOptions || 0;
   if (options.honorCipherOrder !== undefined)
     this.honorCipherOrder = !!options.honorCipherOrder;
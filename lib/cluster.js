@@ -8,6 +8,7 @@ const net = require('net');
 const util = require('util');
 const SCHED_NONE = 1;
 const SCHED_RR = 2;
+const SCHED_REUSEPORT = 3;
 
 const uv = process.binding('uv');
 
@@ -93,6 +94,36 @@ SharedHandle.prototype.remove = function(worker) {
 };
 
 
+// Start a SO_REUSEPORT server. Every worker listens on a socket of its own
+// and the kernel balances connections across them, the master is not involved
+// in accepting connections. The master only holds on to a bound but not
+// listening socket that reserves the port (and resolves port 0).
+function ReusePortHandle(key, address, port, addressType, backlog, fd) {
+  this.key = key;
+  this.workers = [];
+  this.handle = null;
+  this.errno = 0;
+  this.sockname = null;
+
+  var rval = net._createServerHandle(address, port, addressType, fd, true);
+  if (typeof rval === 'number') {
+    this.errno = rval;
+  } else {
+    this.handle = rval;
+    this.sockname = {};
+    rval.getsockname(this.sockname);
+  }
+}
+
+ReusePortHandle.prototype.add = function(worker, send) {
+  assert(this.workers.indexOf(worker) === -1);
+  this.workers.push(worker);
+  send(this.errno, { reuseport: true, sockname: this.sockname }, null);
+};
+
+ReusePortHandle.prototype.remove = SharedHandle.prototype.remove;
+
+
 // Start a round-robin server. Master accepts connections and distributes
 // them over the workers.
 function RoundRobinHandle(key, address, port, addressType, backlog, fd) {
@@ -201,7 +232,8 @@ function masterInit() {
   // XXX(bnoordhuis) Fold cluster.schedulingPolicy into cluster.settings?
   var schedulingPolicy = {
     'none': SCHED_NONE,
-    'rr': SCHED_RR
+    'rr': SCHED_RR,
+    'reuseport': SCHED_REUSEPORT
   }[process.env.NODE_CLUSTER_SCHED_POLICY];
 
   if (schedulingPolicy === undefined) {
@@ -213,6 +245,7 @@ function masterInit() {
   cluster.schedulingPolicy = schedulingPolicy;
   cluster.SCHED_NONE = SCHED_NONE;  // Leave it to the operating system.
   cluster.SCHED_RR = SCHED_RR;      // Master distributes connections.
+  cluster.SCHED_REUSEPORT = SCHED_REUSEPORT;  // Kernel distributes them.
 
   // Keyed on address:port:etc. When a worker dies, we walk over the handles
   // and remove() the worker from each one. remove() may do a linear scan
@@ -243,7 +276,9 @@ function masterInit() {
       return process.nextTick(setupSettingsNT, settings);
     initialized = true;
     schedulingPolicy = cluster.schedulingPolicy;  // Freeze policy.
-    assert(schedulingPolicy === SCHED_NONE || schedulingPolicy === SCHED_RR,
+    assert(schedulingPolicy === SCHED_NONE ||
+           schedulingPolicy === SCHED_RR ||
+           schedulingPolicy === SCHED_REUSEPORT,
            'Bad cluster.schedulingPolicy: ' + schedulingPolicy);
 
     var hasDebugArg = process.execArgv.some(function(argv) {
@@ -451,6 +486,14 @@ function masterInit() {
           message.addressType === 'udp6') {
         constructor = SharedHandle;
       }
+      // SO_REUSEPORT only applies to TCP servers that bind to a port, UNIX
+      // sockets and servers listening on an inherited fd are shared instead.
+      if (schedulingPolicy === SCHED_REUSEPORT &&
+          (message.addressType === 4 || message.addressType === 6) &&
+          message.port >= 0 &&
+          typeof message.fd !== 'number') {
+        constructor = ReusePortHandle;
+      }
       handles[key] = handle = new constructor(key,
                                               message.address,
                                               message.port,
@@ -544,6 +587,8 @@ function workerInit() {
 
       if (handle)
         shared(reply, handle, cb);  // Shared listen socket.
+      else if (reply.reuseport)
+        reuseport(reply, address, addressType, cb);  // SO_REUSEPORT.
       else
         rr(reply, cb);              // Round-robin.
     });
@@ -571,6 +616,20 @@ function workerInit() {
     cb(message.errno, handle);
   }
 
+  // SO_REUSEPORT. Bind a listen socket of our own to the port that the
+  // master reserved, the kernel balances connections across the workers.
+  function reuseport(message, address, addressType, cb) {
+    if (message.errno)
+      return cb(message.errno, null);
+
+    var port = message.sockname.port;
+    var rval = net._createServerHandle(address, port, addressType, null, true);
+    if (typeof rval === 'number')
+      return cb(rval, null);
+
+    shared(message, rval, cb);
+  }
+
   // Round-robin. Master distributes handles across workers.
   function rr(message, cb) {
     if (message.errno)
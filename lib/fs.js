@@ -3,7 +3,6 @@
 
 'use strict';
 
-const SlowBuffer = require('buffer').SlowBuffer;
 const util = require('util');
 const pathModule = require('path');
 
@@ -19,7 +18,6 @@ const Readable = Stream.Readable;
 const Writable = Stream.Writable;
 
 const kMinPoolSpace = 128;
-const kMaxLength = require('smalloc').kMaxLength;
 
 const O_APPEND = constants.O_APPEND || 0;
 const O_CREAT = constants.O_CREAT || 0;
@@ -168,6 +166,65 @@ fs.Stats.prototype.isSocket = function() {
   return this._checkModeProperty(constants.S_IFSOCK);
 };
 
+// Lazy stats.  stat(), lstat() and fstat() write their results into the
+// shared statValues array (laid out like the Stats constructor arguments)
+// instead of building a Stats object with four Dates in C++.  The numbers
+// are copied out right away, the Dates are only created when touched.
+const statValues = binding.statValues;
+
+function LazyStats() {
+  this.dev = statValues[0];
+  this.mode = statValues[1];
+  this.nlink = statValues[2];
+  this.uid = statValues[3];
+  this.gid = statValues[4];
+  this.rdev = statValues[5];
+  this.blksize = statValues[6];
+  this.ino = statValues[7];
+  this.size = statValues[8];
+  this.blocks = statValues[9];
+  this.atimeMs = statValues[10];
+  this.mtimeMs = statValues[11];
+  this.ctimeMs = statValues[12];
+  this.birthtimeMs = statValues[13];
+}
+util.inherits(LazyStats, fs.Stats);
+
+['atime', 'mtime', 'ctime', 'birthtime'].forEach(function(name) {
+  var msec = name + 'Ms';
+  function define(stats, value) {
+    Object.defineProperty(stats, name, {
+      configurable: true, enumerable: true, writable: true, value: value
+    });
+  }
+  Object.defineProperty(LazyStats.prototype, name, {
+    configurable: true,
+    enumerable: true,
+    get: function() {
+      var date = new Date(this[msec]);
+      define(this, date);
+      return date;
+    },
+    set: function(value) {
+      define(this, value);
+    }
+  });
+});
+
+function makeLazyStatsCallback(cb) {
+  return function(err) {
+    if (err)
+      cb(err);
+    else
+      cb(null, new LazyStats());
+  };
+}
+
+function isLazy(options) {
+  return options !== null && typeof options === 'object' &&
+         options.lazy === true;
+}
+
 // Don't allow mode to accidentally be overwritten.
 ['F_OK', 'R_OK', 'W_OK', 'X_OK'].forEach(function(key) {
   Object.defineProperty(fs, key, {
@@ -207,8 +264,8 @@ fs.exists = function(path, callback) {
   if (!nullCheck(path, cb)) return;
   var req = new FSReqWrap();
   req.oncomplete = cb;
-  binding.stat(pathModule._makeLong(path), req);
-  function cb(err, stats) {
+  binding.stat(pathModule._makeLong(path), req, true);
+  function cb(err) {
     if (callback) callback(err ? false : true);
   }
 };
@@ -216,7 +273,7 @@ fs.exists = function(path, callback) {
 fs.existsSync = function(path) {
   try {
     nullCheck(path);
-    binding.stat(pathModule._makeLong(path));
+    binding.stat(pathModule._makeLong(path), undefined, true);
     return true;
   } catch (e) {
     return false;
@@ -241,145 +298,24 @@ fs.readFile = function(path, options, callback_) {
   if (!nullCheck(path, callback))
     return;
 
-  var context = new ReadFileContext(callback, encoding);
-  var req = new FSReqWrap();
-  req.context = context;
-  req.oncomplete = readFileAfterOpen;
-
-  binding.open(pathModule._makeLong(path),
-               stringToFlags(flag),
-               0o666,
-               req);
-};
-
-const kReadFileBufferLength = 8 * 1024;
-
-function ReadFileContext(callback, encoding) {
-  this.fd = undefined;
-  this.size = undefined;
-  this.callback = callback;
-  this.buffers = null;
-  this.buffer = null;
-  this.pos = 0;
-  this.encoding = encoding;
-  this.err = null;
-}
-
-ReadFileContext.prototype.read = function() {
-  var fd = this.fd;
-  var size = this.size;
-  var buffer;
-  var offset;
-  var length;
-
-  if (size === 0) {
-    buffer = this.buffer = new SlowBuffer(kReadFileBufferLength);
-    offset = 0;
-    length = kReadFileBufferLength;
-  } else {
-    buffer = this.buffer;
-    offset = this.pos;
-    length = size - this.pos;
-  }
-
   var req = new FSReqWrap();
+  req.callback = callback;
+  req.encoding = encoding;
   req.oncomplete = readFileAfterRead;
-  req.context = this;
-
-  binding.read(fd, buffer, offset, length, -1, req);
-};
 
-ReadFileContext.prototype.close = function(err) {
-  var req = new FSReqWrap();
-  req.oncomplete = readFileAfterClose;
-  req.context = this;
-  this.err = err;
-  binding.close(this.fd, req);
+  binding.readFile(pathModule._makeLong(path), stringToFlags(flag), req);
 };
 
-function readFileAfterOpen(err, fd) {
-  var context = this.context;
-
-  if (err) {
-    var callback = context.callback;
-    callback(err);
-    return;
-  }
-
-  context.fd = fd;
-
-  var req = new FSReqWrap();
-  req.oncomplete = readFileAfterStat;
-  req.context = context;
-  binding.fstat(fd, req);
-}
-
-function readFileAfterStat(err, st) {
-  var context = this.context;
+function readFileAfterRead(err, buffer) {
+  var callback = this.callback;
 
   if (err)
-    return context.close(err);
-
-  var size = context.size = st.isFile() ? st.size : 0;
+    return callback(err);
 
-  if (size === 0) {
-    context.buffers = [];
-    context.read();
-    return;
-  }
+  if (this.encoding)
+    buffer = buffer.toString(this.encoding);
 
-  if (size > kMaxLength) {
-    err = new RangeError('File size is greater than possible Buffer: ' +
-                         `0x${kMaxLength.toString(16)} bytes`);
-    return context.close(err);
-  }
-
-  context.buffer = new SlowBuffer(size);
-  context.read();
-}
-
-function readFileAfterRead(err, bytesRead) {
-  var context = this.context;
-
-  if (err)
-    return context.close(err);
-
-  if (bytesRead === 0)
-    return context.close();
-
-  context.pos += bytesRead;
-
-  if (context.size !== 0) {
-    if (context.pos === context.size)
-      context.close();
-    else
-      context.read();
-  } else {
-    // unknown size, just read until we don't get bytes.
-    context.buffers.push(context.buffer.slice(0, bytesRead));
-    context.read();
-  }
-}
-
-function readFileAfterClose(err) {
-  var context = this.context;
-  var buffer = null;
-  var callback = context.callback;
-
-  if (context.err)
-    return callback(context.err);
-
-  if (context.size === 0)
-    buffer = Buffer.concat(context.buffers, context.pos);
-  else if (context.pos < context.size)
-    buffer = context.buffer.slice(0, context.pos);
-  else
-    buffer = context.buffer;
-
-  if (context.encoding)
-    buffer = buffer.toString(context.encoding);
-
-  callback(err, buffer);
+  callback(null, buffer);
 }
 
 
@@ -668,6 +604,84 @@ fs.writeSync = function(fd, buffer, offset, length, position) {
   return binding.writeString(fd, buffer, offset, length, position);
 };
 
+// usage:
+//  fs.writev(fd, buffers[, position], callback);
+fs.writev = function(fd, buffers, position, callback) {
+  if (typeof position === 'function') {
+    callback = position;
+    position = null;
+  }
+  callback = maybeCallback(callback);
+
+  function wrapper(err, written) {
+    // Retain a reference to buffers so that they can't be GC'ed too soon.
+    callback(err, written || 0, buffers);
+  }
+
+  if (!Array.isArray(buffers))
+    throw new TypeError('buffers must be an array of Buffers');
+
+  if (buffers.length === 0)
+    return process.nextTick(function() {
+      wrapper(null, 0);
+    });
+
+  var req = new FSReqWrap();
+  req.oncomplete = wrapper;
+  binding.writeBuffers(fd, buffers, position, req);
+};
+
+// usage:
+//  fs.writevSync(fd, buffers[, position]);
+fs.writevSync = function(fd, buffers, position) {
+  if (!Array.isArray(buffers))
+    throw new TypeError('buffers must be an array of Buffers');
+  if (buffers.length === 0)
+    return 0;
+  if (position === undefined)
+    position = null;
+  return binding.writeBuffers(fd, buffers, position);
+};
+
+// usage:
+//  fs.readv(fd, buffers[, position], callback);
+fs.readv = function(fd, buffers, position, callback) {
+  if (typeof position === 'function') {
+    callback = position;
+    position = null;
+  }
+  callback = maybeCallback(callback);
+
+  function wrapper(err, bytesRead) {
+    // Retain a reference to buffers so that they can't be GC'ed too soon.
+    callback(err, bytesRead || 0, buffers);
+  }
+
+  if (!Array.isArray(buffers))
+    throw new TypeError('buffers must be an array of Buffers');
+
+  if (buffers.length === 0)
+    return process.nextTick(function() {
+      wrapper(null, 0);
+    });
+
+  var req = new FSReqWrap();
+  req.oncomplete = wrapper;
+  binding.readBuffers(fd, buffers, position, req);
+};
+
+// usage:
+//  fs.readvSync(fd, buffers[, position]);
+fs.readvSync = function(fd, buffers, position) {
+  if (!Array.isArray(buffers))
+    throw new TypeError('buffers must be an array of Buffers');
+  if (buffers.length === 0)
+    return 0;
+  if (position === undefined)
+    position = null;
+  return binding.readBuffers(fd, buffers, position);
+};
+
 fs.rename = function(oldPath, newPath, callback) {
   callback = makeCallback(callback);
   if (!nullCheck(oldPath, callback)) return;
@@ -797,52 +811,131 @@ fs.mkdirSync = function(path, mode) {
                        modeNum(mode, 0o777));
 };
 
-fs.readdir = function(path, callback) {
-  callback = makeCallback(callback);
+fs.readdir = function(path, options, callback) {
+  callback = makeCallback(arguments[arguments.length - 1]);
+  if (!options || typeof options === 'function')
+    options = {};
   if (!nullCheck(path, callback)) return;
   var req = new FSReqWrap();
   req.oncomplete = callback;
-  binding.readdir(pathModule._makeLong(path), req);
+  binding.readdir(pathModule._makeLong(path), req, !!options.withTypes);
 };
 
-fs.readdirSync = function(path) {
+fs.readdirSync = function(path, options) {
+  options = options || {};
   nullCheck(path);
-  return binding.readdir(pathModule._makeLong(path));
+  return binding.readdir(pathModule._makeLong(path),
+                         undefined,
+                         !!options.withTypes);
 };
 
-fs.fstat = function(fd, callback) {
+fs.fstat = function(fd, options, callback) {
+  if (arguments.length < 3) {
+    callback = options;
+    options = null;
+  }
+  callback = makeCallback(callback);
+  var lazy = isLazy(options);
   var req = new FSReqWrap();
-  req.oncomplete = makeCallback(callback);
-  binding.fstat(fd, req);
+  req.oncomplete = lazy ? makeLazyStatsCallback(callback) : callback;
+  binding.fstat(fd, req, lazy);
 };
 
-fs.lstat = function(path, callback) {
+fs.lstat = function(path, options, callback) {
+  if (arguments.length < 3) {
+    callback = options;
+    options = null;
+  }
   callback = makeCallback(callback);
   if (!nullCheck(path, callback)) return;
+  var lazy = isLazy(options);
   var req = new FSReqWrap();
-  req.oncomplete = callback;
-  binding.lstat(pathModule._makeLong(path), req);
+  req.oncomplete = lazy ? makeLazyStatsCallback(callback) : callback;
+  binding.lstat(pathModule._makeLong(path), req, lazy);
 };
 
-fs.stat = function(path, callback) {
+fs.stat = function(path, options, callback) {
+  if (arguments.length < 3) {
+    callback = options;
+    options = null;
+  }
   callback = makeCallback(callback);
   if (!nullCheck(path, callback)) return;
+  var lazy = isLazy(options);
   var req = new FSReqWrap();
-  req.oncomplete = callback;
-  binding.stat(pathModule._makeLong(path), req);
+  req.oncomplete = lazy ? makeLazyStatsCallback(callback) : callback;
+  binding.stat(pathModule._makeLong(path), req, lazy);
 };
 
-fs.fstatSync = function(fd) {
+fs.fstatSync = function(fd, options) {
+  if (isLazy(options)) {
+    binding.fstat(fd, undefined, true);
+    return new LazyStats();
+  }
   return binding.fstat(fd);
 };
 
-fs.lstatSync = function(path) {
+// Number of Float64Array slots per path in the results of fs.statMany().
+const kStatManyFields = 15;
+
+function statManyArgs(paths, callback) {
+  if (!Array.isArray(paths))
+    throw new TypeError('paths must be an array');
+
+  var longPaths = new Array(paths.length);
+  for (var i = 0; i < paths.length; i++) {
+    if (!nullCheck(paths[i], callback))
+      return null;
+    longPaths[i] = pathModule._makeLong(paths[i]);
+  }
+  return longPaths;
+}
+
+fs.statMany = function(paths, options, callback) {
+  callback = makeCallback(arguments[arguments.length - 1]);
+  if (!options || typeof options === 'function')
+    options = {};
+
+  var longPaths = statManyArgs(paths, callback);
+  if (longPaths === null)
+    return;
+
+  var results = new Float64Array(paths.length * kStatManyFields);
+  if (paths.length === 0)
+    return process.nextTick(callback, null, results);
+
+  var req = new FSReqWrap();
+  req.oncomplete = function(err) {
+    callback(err, results);
+  };
+  binding.statMany(longPaths, results, !!options.lstat, req);
+};
+
+fs.statManySync = function(paths, options) {
+  options = options || {};
+
+  var longPaths = statManyArgs(paths);
+  var results = new Float64Array(paths.length * kStatManyFields);
+  if (paths.length !== 0)
+    binding.statMany(longPaths, results, !!options.lstat);
+  return results;
+};
+
+fs.lstatSync = function(path, options) {
   nullCheck(path);
+  if (isLazy(options)) {
+    binding.lstat(pathModule._makeLong(path), undefined, true);
+    return new LazyStats();
+  }
   return binding.lstat(pathModule._makeLong(path));
 };
 
-fs.statSync = function(path) {
+fs.statSync = function(path, options) {
   nullCheck(path);
+  if (isLazy(options)) {
+    binding.stat(pathModule._makeLong(path), undefined, true);
+    return new LazyStats();
+  }
   return binding.stat(pathModule._makeLong(path));
 };
 
@@ -1087,30 +1180,6 @@ fs.futimesSync = function(fd, atime, mtime) {
   binding.futimes(fd, atime, mtime);
 };
 
-function writeAll(fd, buffer, offset, length, position, callback) {
-  callback = maybeCallback(arguments[arguments.length - 1]);
-
-  // write(fd, buffer, offset, length, position, callback)
-  fs.write(fd, buffer, offset, length, position, function(writeErr, written) {
-    if (writeErr) {
-      fs.close(fd, function() {
-        if (callback) callback(writeErr);
-      });
-    } else {
-      if (written === length) {
-        fs.close(fd, callback);
-      } else {
-        offset += written;
-        length -= written;
-        if (position !== null) {
-          position += written;
-        }
-        writeAll(fd, buffer, offset, length, position, callback);
-      }
-    }
-  });
-}
-
 fs.writeFile = function(path, data, options, callback) {
   var callback = maybeCallback(arguments[arguments.length - 1]);
 
@@ -1125,16 +1194,23 @@ fs.writeFile = function(path, data, options, callback) {
   assertEncoding(options.encoding);
 
   var flag = options.flag || 'w';
-  fs.open(path, flag, options.mode, function(openErr, fd) {
-    if (openErr) {
-      if (callback) callback(openErr);
-    } else {
-      var buffer = (data instanceof Buffer) ? data : new Buffer('' + data,
-          options.encoding || 'utf8');
-      var position = /a/.test(flag) ? null : 0;
-      writeAll(fd, buffer, 0, buffer.length, position, callback);
-    }
-  });
+
+  if (!nullCheck(path, callback))
+    return;
+
+  var buffer = (data instanceof Buffer) ? data : new Buffer('' + data,
+      options.encoding || 'utf8');
+  var position = /a/.test(flag) ? null : 0;
+
+  var req = new FSReqWrap();
+  req.oncomplete = callback;
+
+  binding.writeFile(pathModule._makeLong(path),
+                    buffer,
+                    stringToFlags(flag),
+                    modeNum(options.mode, 0o666),
+                    position,
+                    req);
 };
 
 fs.writeFileSync = function(path, data, options) {
@@ -1855,6 +1931,64 @@ WriteStream.prototype._write = function(data, encoding, cb) {
 };
 
 
+// Writes out all of `buffers`.  A single writev() can come up short when
+// there are more buffers than the system takes per call or the disk is full.
+function writevAll(fd, buffers, size, position, callback) {
+  fs.writev(fd, buffers, position, function(er, written) {
+    if (er)
+      return callback(er);
+
+    if (written === size)
+      return callback(null);
+
+    // Drop what's been written, including the head of a partial buffer.
+    var rest = written;
+    var i = 0;
+    while (rest >= buffers[i].length)
+      rest -= buffers[i++].length;
+    buffers = buffers.slice(i);
+    buffers[0] = buffers[0].slice(rest);
+
+    if (position !== undefined && position !== null)
+      position += written;
+
+    writevAll(fd, buffers, size - written, position, callback);
+  });
+}
+
+
+WriteStream.prototype._writev = function(data, cb) {
+  if (typeof this.fd !== 'number')
+    return this.once('open', function() {
+      this._writev(data, cb);
+    });
+
+  var chunks = new Array(data.length);
+  var size = 0;
+
+  for (var i = 0; i < data.length; i++) {
+    var chunk = data[i].chunk;
+    if (!(chunk instanceof Buffer))
+      return this.emit('error', new Error('Invalid data'));
+    chunks[i] = chunk;
+    size += chunk.length;
+  }
+
+  var self = this;
+  writevAll(this.fd, chunks, size, this.pos, function(er) {
+    if (er) {
+      self.destroy();
+      return cb(er);
+    }
+    self.bytesWritten += size;
+    cb();
+  });
+
+  if (this.pos !== undefined)
+    this.pos += size;
+};
+
+
 WriteStream.prototype.destroy = ReadStream.prototype.destroy;
 WriteStream.prototype.close = ReadStream.prototype.close;
 
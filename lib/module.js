@@ -56,9 +56,12 @@ const debug = Module._debug;
 //   -> a.<ext>
 //   -> a/index.<ext>
 
+// The resolver only looks at the file type, skip building the Dates.
+const lazyStat = { lazy: true };
+
 function statPath(path) {
   try {
-    return fs.statSync(path);
+    return fs.statSync(path, lazyStat);
   } catch (ex) {}
   return false;
 }
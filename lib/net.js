@@ -15,6 +15,7 @@ const TCPConnectWrap = process.binding('tcp_wrap').TCPConnectWrap;
 const PipeConnectWrap = process.binding('pipe_wrap').PipeConnectWrap;
 const ShutdownWrap = process.binding('stream_wrap').ShutdownWrap;
 const WriteWrap = process.binding('stream_wrap').WriteWrap;
+const StreamPipe = process.binding('stream_wrap').StreamPipe;
 
 
 var cluster;
@@ -327,12 +328,102 @@ Socket.prototype.setNoDelay = function(enable) {
 };
 
 
+Socket.prototype.setWriteCoalescing = function(maxBytes) {
+  if (this._handle && this._handle.setWriteCoalescing) {
+    this._handle.onerror = onCoalescedWriteError;
+    this._handle.setWriteCoalescing(maxBytes >>> 0);
+  }
+};
+
+
+// Sending coalesced data failed after the writes that it came from had
+// completed, so there is no write callback left to pass the error to.
+function onCoalescedWriteError(err) {
+  var self = this.owner;
+  debug('coalesced write error', err);
+  self._destroy(errnoException(err, 'write'));
+}
+
+
 Socket.prototype.setKeepAlive = function(setting, msecs) {
   if (this._handle && this._handle.setKeepAlive)
     this._handle.setKeepAlive(setting, ~~(msecs / 1000));
 };
 
 
+// Like readable.pipe(), but the data goes from this socket's handle to the
+// destination's handle in C++ and never becomes a JS Buffer. Falls back to
+// pipe() when that is not possible.
+Socket.prototype.pipeNative = function(dest, options) {
+  if (!(dest instanceof Socket))
+    return this.pipe(dest, options);
+  startPipeNative(this, dest, options);
+  return dest;
+};
+
+
+function startPipeNative(src, dest, options) {
+  if (src._connecting)
+    return src.once('connect', function() {
+      startPipeNative(src, dest, options);
+    });
+  if (dest._connecting)
+    return dest.once('connect', function() {
+      startPipeNative(src, dest, options);
+    });
+
+  if (!src._handle || !dest._handle || src._readableState.ended)
+    return src.pipe(dest, options);
+
+  // What has been read already goes first, and so does what has been written
+  // to `dest` from JS land.
+  var chunk;
+  while ((chunk = src.read()) !== null)
+    dest.write(chunk);
+  if (dest._writableState.length !== 0)
+    return dest.write(new Buffer(0), function() {
+      startPipeNative(src, dest, options);
+    });
+
+  var pipe = new StreamPipe();
+  var err = pipe.start(src._handle._externalStream,
+                       dest._handle._externalStream);
+  if (err) {
+    debug('pipeNative falls back to pipe()', err);
+    return src.pipe(dest, options);
+  }
+
+  pipe.oncomplete = function(status) {
+    unpipe();
+    if (!dest.destroyed)
+      dest._destroy(errnoException(status, 'write'));
+  };
+
+  function onend() {
+    unpipe();
+    if (!options || options.end !== false)
+      dest.end();
+  }
+
+  function unpipe() {
+    pipe.unpipe();
+    src.removeListener('end', onend);
+    src.removeListener('close', unpipe);
+    dest.removeListener('close', unpipe);
+    // Like unpipe(), leave the data for whoever reads next
+    src.pause();
+  }
+
+  src.on('end', onend);
+  src.on('close', unpipe);
+  dest.on('close', unpipe);
+
+  // The EOF arrives through the usual path once everything has been written,
+  // 'end' is only emitted in flowing mode.
+  src.resume();
+}
+
+
 Socket.prototype.address = function() {
   return this._getsockname();
 };
@@ -635,15 +726,31 @@ Socket.prototype._writeGeneric = function(writev, data, encoding, cb) {
   var err;
 
   if (writev) {
-    var chunks = new Array(data.length << 1);
+    var allBuffers = true;
     for (var i = 0; i < data.length; i++) {
-      var entry = data[i];
-      var chunk = entry.chunk;
-      var enc = entry.encoding;
-      chunks[i * 2] = chunk;
-      chunks[i * 2 + 1] = enc;
+      if (!(data[i].chunk instanceof Buffer)) {
+        allBuffers = false;
+        break;
+      }
     }
-    err = this._handle.writev(req, chunks);
+
+    var chunks;
+    if (allBuffers) {
+      // Let the binding skip the encoding lookups.
+      chunks = new Array(data.length);
+      for (var i = 0; i < data.length; i++)
+        chunks[i] = data[i].chunk;
+    } else {
+      chunks = new Array(data.length << 1);
+      for (var i = 0; i < data.length; i++) {
+        var entry = data[i];
+        var chunk = entry.chunk;
+        var enc = entry.encoding;
+        chunks[i * 2] = chunk;
+        chunks[i * 2 + 1] = enc;
+      }
+    }
+    err = this._handle.writev(req, chunks, allBuffers);
 
     // Retain chunks
     if (err === 0) req._chunks = chunks;
@@ -1074,6 +1181,7 @@ function Server(options, connectionListener) {
 
   this.allowHalfOpen = options.allowHalfOpen || false;
   this.pauseOnConnect = !!options.pauseOnConnect;
+  this.acceptBatchSize = options.acceptBatchSize >>> 0;
 }
 util.inherits(Server, events.EventEmitter);
 exports.Server = Server;
@@ -1089,7 +1197,7 @@ function _listen(handle, backlog) {
 }
 
 var createServerHandle = exports._createServerHandle =
-    function(address, port, addressType, fd) {
+    function(address, port, addressType, fd, reusePort) {
   var err = 0;
   // assign handle in listen, and clean up if bind or listen fails
   var handle;
@@ -1125,16 +1233,16 @@ var createServerHandle = exports._createServerHandle =
     debug('bind to ' + (address || 'anycast'));
     if (!address) {
       // Try binding to ipv6 first
-      err = handle.bind6('::', port);
+      err = handle.bind6('::', port, reusePort);
       if (err) {
         handle.close();
         // Fallback to ipv4
-        return createServerHandle('0.0.0.0', port);
+        return createServerHandle('0.0.0.0', port, 4, undefined, reusePort);
       }
     } else if (addressType === 6) {
-      err = handle.bind6(address, port);
+      err = handle.bind6(address, port, reusePort);
     } else {
-      err = handle.bind(address, port);
+      err = handle.bind(address, port, reusePort);
     }
   }
 
@@ -1189,6 +1297,9 @@ Server.prototype._listen2 = function(address, port, addressType, backlog, fd) {
   self._handle.onconnection = onconnection;
   self._handle.owner = self;
 
+  if (self.acceptBatchSize > 0 && self._handle.setAcceptBatchSize)
+    self._handle.setAcceptBatchSize(self.acceptBatchSize);
+
   var err = _listen(self._handle, backlog);
 
   if (err) {
@@ -1355,6 +1466,17 @@ function onconnection(err, clientHandle) {
 
   debug('onconnection');
 
+  // Batched accept, see Server#acceptBatchSize.
+  if (Array.isArray(clientHandle)) {
+    for (var i = 0; i < clientHandle.length; i++) {
+      if (self._handle === null)
+        clientHandle[i].close();
+      else
+        onconnection.call(handle, err, clientHandle[i]);
+    }
+    return;
+  }
+
   if (err) {
     self.emit('error', errnoException(err, 'accept'));
     return;
@@ -51,6 +51,19 @@ exports.getCiphers = function() {
   return Object.getOwnPropertyNames(ctx).sort();
 };
 
+// Memory of the buffers between OpenSSL and the TLS sockets of this process,
+// see Environment::BIOBufferPool in src/env.h.
+exports.getBufferStats = function() {
+  const stats = process.binding('tls_wrap').bioBufferStats;
+  return {
+    inUse: stats[0],
+    pooled: stats[1],
+    hits: stats[2],
+    misses: stats[3],
+    idleReleases: stats[4]
+  };
+};
+
 // Convert protocols array into valid OpenSSL protocols list
 // ("\x06spdy/2\x08http/1.1\x08http/1.0")
 exports.convertNPNProtocols = function convertNPNProtocols(NPNProtocols, out) {
@@ -242,6 +255,7 @@ exports.parseCertString = function parseCertString(s) {
 // Public API
 exports.createSecureContext = require('_tls_common').createSecureContext;
 exports.SecureContext = require('_tls_common').SecureContext;
+exports.SessionCache = require('_tls_common').SessionCache;
 exports.TLSSocket = require('_tls_wrap').TLSSocket;
 exports.Server = require('_tls_wrap').Server;
 exports.createServer = require('_tls_wrap').createServer;
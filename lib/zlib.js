@@ -104,10 +104,14 @@ exports.deflate = function(buffer, opts, callback) {
     callback = opts;
     opts = {};
   }
+  if (canProcessBuffer(buffer, opts))
+    return processBuffer(binding.DEFLATE, buffer, opts, callback);
   return zlibBuffer(new Deflate(opts), buffer, callback);
 };
 
 exports.deflateSync = function(buffer, opts) {
+  if (canProcessBuffer(buffer, opts))
+    return processBufferSync(binding.DEFLATE, buffer, opts);
   return zlibBufferSync(new Deflate(opts), buffer);
 };
 
@@ -116,10 +120,14 @@ exports.gzip = function(buffer, opts, callback) {
     callback = opts;
     opts = {};
   }
+  if (canProcessBuffer(buffer, opts))
+    return processBuffer(binding.GZIP, buffer, opts, callback);
   return zlibBuffer(new Gzip(opts), buffer, callback);
 };
 
 exports.gzipSync = function(buffer, opts) {
+  if (canProcessBuffer(buffer, opts))
+    return processBufferSync(binding.GZIP, buffer, opts);
   return zlibBufferSync(new Gzip(opts), buffer);
 };
 
@@ -128,10 +136,14 @@ exports.deflateRaw = function(buffer, opts, callback) {
     callback = opts;
     opts = {};
   }
+  if (canProcessBuffer(buffer, opts))
+    return processBuffer(binding.DEFLATERAW, buffer, opts, callback);
   return zlibBuffer(new DeflateRaw(opts), buffer, callback);
 };
 
 exports.deflateRawSync = function(buffer, opts) {
+  if (canProcessBuffer(buffer, opts))
+    return processBufferSync(binding.DEFLATERAW, buffer, opts);
   return zlibBufferSync(new DeflateRaw(opts), buffer);
 };
 
@@ -140,10 +152,14 @@ exports.unzip = function(buffer, opts, callback) {
     callback = opts;
     opts = {};
   }
+  if (canProcessBuffer(buffer, opts))
+    return processBuffer(binding.UNZIP, buffer, opts, callback);
   return zlibBuffer(new Unzip(opts), buffer, callback);
 };
 
 exports.unzipSync = function(buffer, opts) {
+  if (canProcessBuffer(buffer, opts))
+    return processBufferSync(binding.UNZIP, buffer, opts);
   return zlibBufferSync(new Unzip(opts), buffer);
 };
 
@@ -152,10 +168,14 @@ exports.inflate = function(buffer, opts, callback) {
     callback = opts;
     opts = {};
   }
+  if (canProcessBuffer(buffer, opts))
+    return processBuffer(binding.INFLATE, buffer, opts, callback);
   return zlibBuffer(new Inflate(opts), buffer, callback);
 };
 
 exports.inflateSync = function(buffer, opts) {
+  if (canProcessBuffer(buffer, opts))
+    return processBufferSync(binding.INFLATE, buffer, opts);
   return zlibBufferSync(new Inflate(opts), buffer);
 };
 
@@ -164,10 +184,14 @@ exports.gunzip = function(buffer, opts, callback) {
     callback = opts;
     opts = {};
   }
+  if (canProcessBuffer(buffer, opts))
+    return processBuffer(binding.GUNZIP, buffer, opts, callback);
   return zlibBuffer(new Gunzip(opts), buffer, callback);
 };
 
 exports.gunzipSync = function(buffer, opts) {
+  if (canProcessBuffer(buffer, opts))
+    return processBufferSync(binding.GUNZIP, buffer, opts);
   return zlibBufferSync(new Gunzip(opts), buffer);
 };
 
@@ -176,13 +200,72 @@ exports.inflateRaw = function(buffer, opts, callback) {
     callback = opts;
     opts = {};
   }
+  if (canProcessBuffer(buffer, opts))
+    return processBuffer(binding.INFLATERAW, buffer, opts, callback);
   return zlibBuffer(new InflateRaw(opts), buffer, callback);
 };
 
 exports.inflateRawSync = function(buffer, opts) {
+  if (canProcessBuffer(buffer, opts))
+    return processBufferSync(binding.INFLATERAW, buffer, opts);
   return zlibBufferSync(new InflateRaw(opts), buffer);
 };
 
+// Buffers are handed to the binding as a whole, which deflates or inflates
+// them in a single thread pool job. Only dictionaries need the stream.
+function canProcessBuffer(buffer, opts) {
+  return (typeof buffer === 'string' || buffer instanceof Buffer) &&
+         !(opts && opts.dictionary);
+}
+
+function processBuffer(mode, buffer, opts, callback) {
+  runBinding(mode, buffer, opts, function(err, result) {
+    if (err) {
+      err.code = codes[err.errno];
+      return callback(err);
+    }
+    callback(null, result);
+  });
+}
+
+function processBufferSync(mode, buffer, opts) {
+  var result = runBinding(mode, buffer, opts);
+  if (!(result instanceof Buffer)) {
+    result.code = codes[result.errno];
+    throw result;
+  }
+  return result;
+}
+
+// Without oncomplete, the binding does the work right away and returns
+// either the output or an error.
+function runBinding(mode, buffer, opts, oncomplete) {
+  opts = opts || {};
+  validateOptions(opts);
+
+  if (typeof buffer === 'string')
+    buffer = new Buffer(buffer);
+
+  var windowBits = opts.windowBits || exports.Z_DEFAULT_WINDOWBITS;
+  if (mode === binding.DEFLATE ||
+      mode === binding.GZIP ||
+      mode === binding.DEFLATERAW) {
+    var level = exports.Z_DEFAULT_COMPRESSION;
+    if (typeof opts.level === 'number') level = opts.level;
+    var strategy = exports.Z_DEFAULT_STRATEGY;
+    if (typeof opts.strategy === 'number') strategy = opts.strategy;
+
+    return binding.deflateBuffer(mode,
+                                  buffer,
+                                  level,
+                                  windowBits,
+                                  opts.memLevel || exports.Z_DEFAULT_MEMLEVEL,
+                                  strategy,
+                                  oncomplete);
+  }
+  return binding.inflateBuffer(mode, buffer, windowBits, oncomplete);
+}
+
 function zlibBuffer(engine, buffer, callback) {
   var buffers = [];
   var nread = 0;
@@ -273,17 +356,7 @@ function Unzip(opts) {
 }
 
 
-// the Zlib class they all inherit from
-// This thing manages the queue of requests, and returns
-// true or false if there is anything in the queue when
-// you call the .write() method.
-
-function Zlib(opts, mode) {
-  this._opts = opts = opts || {};
-  this._chunkSize = opts.chunkSize || exports.Z_DEFAULT_CHUNK;
-
-  Transform.call(this, opts);
-
+function validateOptions(opts) {
   if (opts.flush) {
     if (opts.flush !== binding.Z_NO_FLUSH &&
         opts.flush !== binding.Z_PARTIAL_FLUSH &&
@@ -294,8 +367,6 @@ function Zlib(opts, mode) {
       throw new Error('Invalid flush flag: ' + opts.flush);
     }
   }
-  this._flushFlag = opts.flush || binding.Z_NO_FLUSH;
-
   if (opts.chunkSize) {
     if (opts.chunkSize < exports.Z_MIN_CHUNK ||
         opts.chunkSize > exports.Z_MAX_CHUNK) {
@@ -339,6 +410,22 @@ function Zlib(opts, mode) {
       throw new Error('Invalid dictionary: it should be a Buffer instance');
     }
   }
+}
+
+// the Zlib class they all inherit from
+// This thing manages the queue of requests, and returns
+// true or false if there is anything in the queue when
+// you call the .write() method.
+
+function Zlib(opts, mode) {
+  this._opts = opts = opts || {};
+  this._chunkSize = opts.chunkSize || exports.Z_DEFAULT_CHUNK;
+
+  Transform.call(this, opts);
+
+  validateOptions(opts);
+
+  this._flushFlag = opts.flush || binding.Z_NO_FLUSH;
 
   this._handle = new binding.Zlib(mode);
 
@@ -368,8 +455,6 @@ function Zlib(opts, mode) {
                     strategy,
                     opts.dictionary);
 
-  this._buffer = new Buffer(this._chunkSize);
-  this._offset = 0;
   this._closed = false;
   this._level = level;
   this._strategy = strategy;
@@ -492,9 +577,12 @@ Zlib.prototype._transform = function(chunk, encoding, cb) {
   this._processChunk(chunk, flushFlag, cb);
 };
 
+// The binding keeps compressing in the thread pool for as long as the output
+// fills up, and hands back the output as a list of buffers of at most
+// _chunkSize bytes each. Only when it stopped early because it produced a
+// lot of output do we have to go back for the rest.
 Zlib.prototype._processChunk = function(chunk, flushFlag, cb) {
   var availInBefore = chunk && chunk.length;
-  var availOutBefore = this._chunkSize - this._offset;
   var inOff = 0;
 
   var self = this;
@@ -512,14 +600,12 @@ Zlib.prototype._processChunk = function(chunk, flushFlag, cb) {
 
     assert(!this._closed, 'zlib binding closed');
     do {
-      var res = this._handle.writeSync(flushFlag,
-                                       chunk, // in
-                                       inOff, // in_off
-                                       availInBefore, // in_len
-                                       this._buffer, // out
-                                       this._offset, //out_off
-                                       availOutBefore); // out_len
-    } while (!this._hadError && callback(res[0], res[1]));
+      var res = this._handle.writeAllSync(flushFlag,
+                                          chunk, // in
+                                          inOff, // in_off
+                                          availInBefore, // in_len
+                                          this._chunkSize); // chunk_size
+    } while (!this._hadError && callback(res[0], res[1], res[2]));
 
     if (this._hadError) {
       throw error;
@@ -532,43 +618,29 @@ Zlib.prototype._processChunk = function(chunk, flushFlag, cb) {
   }
 
   assert(!this._closed, 'zlib binding closed');
-  var req = this._handle.write(flushFlag,
-                               chunk, // in
-                               inOff, // in_off
-                               availInBefore, // in_len
-                               this._buffer, // out
-                               this._offset, //out_off
-                               availOutBefore); // out_len
+  var req = this._handle.writeAll(flushFlag,
+                                  chunk, // in
+                                  inOff, // in_off
+                                  availInBefore, // in_len
+                                  this._chunkSize); // chunk_size
 
   req.buffer = chunk;
   req.callback = callback;
 
-  function callback(availInAfter, availOutAfter) {
+  function callback(availInAfter, availOutAfter, out) {
     if (self._hadError)
       return;
 
-    var have = availOutBefore - availOutAfter;
-    assert(have >= 0, 'have should not go down');
-
-    if (have > 0) {
-      var out = self._buffer.slice(self._offset, self._offset + have);
-      self._offset += have;
-      // serve some output to the consumer.
+    // serve some output to the consumer.
+    for (var i = 0; i < out.length; i++) {
       if (async) {
-        self.push(out);
+        self.push(out[i]);
       } else {
-        buffers.push(out);
-        nread += out.length;
+        buffers.push(out[i]);
+        nread += out[i].length;
       }
     }
 
-    // exhausted the output buffer, or used all the input create a new one.
-    if (availOutAfter === 0 || self._offset >= self._chunkSize) {
-      availOutBefore = self._chunkSize;
-      self._offset = 0;
-      self._buffer = new Buffer(self._chunkSize);
-    }
-
     if (availOutAfter === 0) {
       // Not actually done.  Need to reprocess.
       // Also, update the availInBefore to the availInAfter value,
@@ -580,13 +652,11 @@ Zlib.prototype._processChunk = function(chunk, flushFlag, cb) {
       if (!async)
         return true;
 
-      var newReq = self._handle.write(flushFlag,
-                                      chunk,
-                                      inOff,
-                                      availInBefore,
-                                      self._buffer,
-                                      self._offset,
-                                      self._chunkSize);
+      var newReq = self._handle.writeAll(flushFlag,
+                                         chunk,
+                                         inOff,
+                                         availInBefore,
+                                         self._chunkSize);
       newReq.callback = callback; // this same function
       newReq.buffer = chunk;
       return;
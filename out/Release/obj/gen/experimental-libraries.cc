@@ -0,0 +1,1460 @@
+// Copyright 2011 Google Inc. All Rights Reserved.
+
+// This file was generated from .js source files by GYP.  If you
+// want to make changes to this file you should either change the
+// javascript source files or the GYP script.
+
+#include "src/v8.h"
+#include "src/natives.h"
+#include "src/utils.h"
+
+namespace v8 {
+namespace internal {
+
+  static const char sources[] = { 10, 34, 117, 115, 101, 32, 115, 116, 114, 105, 99, 116, 34, 59, 10, 118, 97,
+114, 32, 36, 80, 114, 111, 120, 121, 61, 110, 101, 119, 32, 36, 79, 98, 106,
+101, 99, 116, 40, 41, 59, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 80,
+114, 111, 120, 121, 67, 114, 101, 97, 116, 101, 40, 97, 44, 98, 41, 123, 10,
+105, 102, 40, 33, 40, 37, 95, 73, 115, 83, 112, 101, 99, 79, 98, 106, 101, 99,
+116, 40, 97, 41, 41, 41, 10, 116, 104, 114, 111, 119, 32, 77, 97, 107, 101, 84,
+121, 112, 101, 69, 114, 114, 111, 114, 40, 34, 104, 97, 110, 100, 108, 101, 114,
+95, 110, 111, 110, 95, 111, 98, 106, 101, 99, 116, 34, 44, 91, 34, 99, 114, 101,
+97, 116, 101, 34, 93, 41, 10, 105, 102, 40, 40, 98, 61, 61, 61, 40, 118, 111,
+105, 100, 32, 48, 41, 41, 41, 10, 98, 61, 110, 117, 108, 108, 10, 101, 108, 115,
+101, 32, 105, 102, 40, 33, 40, 40, 37, 95, 73, 115, 83, 112, 101, 99, 79, 98,
+106, 101, 99, 116, 40, 98, 41, 41, 124, 124, 40, 98, 61, 61, 61, 110, 117, 108,
+108, 41, 41, 41, 10, 116, 104, 114, 111, 119, 32, 77, 97, 107, 101, 84, 121,
+112, 101, 69, 114, 114, 111, 114, 40, 34, 112, 114, 111, 116, 111, 95, 110, 111,
+110, 95, 111, 98, 106, 101, 99, 116, 34, 44, 91, 34, 99, 114, 101, 97, 116, 101,
+34, 93, 41, 10, 114, 101, 116, 117, 114, 110, 32, 37, 67, 114, 101, 97, 116,
+101, 74, 83, 80, 114, 111, 120, 121, 40, 97, 44, 98, 41, 10, 125, 10, 102, 117,
+110, 99, 116, 105, 111, 110, 32, 80, 114, 111, 120, 121, 67, 114, 101, 97, 116,
+101, 70, 117, 110, 99, 116, 105, 111, 110, 40, 97, 44, 98, 44, 99, 41, 123, 10,
+105, 102, 40, 33, 40, 37, 95, 73, 115, 83, 112, 101, 99, 79, 98, 106, 101, 99,
+116, 40, 97, 41, 41, 41, 10, 116, 104, 114, 111, 119, 32, 77, 97, 107, 101, 84,
+121, 112, 101, 69, 114, 114, 111, 114, 40, 34, 104, 97, 110, 100, 108, 101, 114,
+95, 110, 111, 110, 95, 111, 98, 106, 101, 99, 116, 34, 44, 91, 34, 99, 114, 101,
+97, 116, 101, 34, 93, 41, 10, 105, 102, 40, 33, 40, 37, 95, 67, 108, 97, 115,
+115, 79, 102, 40, 98, 41, 61, 61, 61, 39, 70, 117, 110, 99, 116, 105, 111, 110,
+39, 41, 41, 10, 116, 104, 114, 111, 119, 32, 77, 97, 107, 101, 84, 121, 112,
+101, 69, 114, 114, 111, 114, 40, 34, 116, 114, 97, 112, 95, 102, 117, 110, 99,
+116, 105, 111, 110, 95, 101, 120, 112, 101, 99, 116, 101, 100, 34, 44, 91, 34,
+99, 114, 101, 97, 116, 101, 70, 117, 110, 99, 116, 105, 111, 110, 34, 44, 34,
+99, 97, 108, 108, 34, 93, 41, 10, 105, 102, 40, 40, 99, 61, 61, 61, 40, 118,
+111, 105, 100, 32, 48, 41, 41, 41, 123, 10, 99, 61, 68, 101, 114, 105, 118, 101,
+100, 67, 111, 110, 115, 116, 114, 117, 99, 116, 84, 114, 97, 112, 40, 98, 41,
+10, 125, 101, 108, 115, 101, 32, 105, 102, 40, 40, 37, 95, 67, 108, 97, 115,
+115, 79, 102, 40, 99, 41, 61, 61, 61, 39, 70, 117, 110, 99, 116, 105, 111, 110,
+39, 41, 41, 123, 10, 118, 97, 114, 32, 100, 61, 99, 10, 99, 61, 102, 117, 110,
+99, 116, 105, 111, 110, 40, 41, 123, 10, 114, 101, 116, 117, 114, 110, 32, 37,
+65, 112, 112, 108, 121, 40, 100, 44, 40, 118, 111, 105, 100, 32, 48, 41, 44, 97,
+114, 103, 117, 109, 101, 110, 116, 115, 44, 48, 44, 37, 95, 65, 114, 103, 117,
+109, 101, 110, 116, 115, 76, 101, 110, 103, 116, 104, 40, 41, 41, 59, 10, 125,
+10, 125, 101, 108, 115, 101, 123, 10, 116, 104, 114, 111, 119, 32, 77, 97, 107,
+101, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 34, 116, 114, 97, 112, 95,
+102, 117, 110, 99, 116, 105, 111, 110, 95, 101, 120, 112, 101, 99, 116, 101,
+100, 34, 44, 10, 91, 34, 99, 114, 101, 97, 116, 101, 70, 117, 110, 99, 116, 105,
+111, 110, 34, 44, 34, 99, 111, 110, 115, 116, 114, 117, 99, 116, 34, 93, 41, 10,
+125, 10, 114, 101, 116, 117, 114, 110, 32, 37, 67, 114, 101, 97, 116, 101, 74,
+83, 70, 117, 110, 99, 116, 105, 111, 110, 80, 114, 111, 120, 121, 40, 10, 97,
+44, 98, 44, 99, 44, 36, 70, 117, 110, 99, 116, 105, 111, 110, 46, 112, 114, 111,
+116, 111, 116, 121, 112, 101, 41, 10, 125, 10, 102, 117, 110, 99, 116, 105, 111,
+110, 32, 83, 101, 116, 85, 112, 80, 114, 111, 120, 121, 40, 41, 123, 10, 37, 67,
+104, 101, 99, 107, 73, 115, 66, 111, 111, 116, 115, 116, 114, 97, 112, 112, 105,
+110, 103, 40, 41, 10, 118, 97, 114, 32, 97, 61, 37, 71, 108, 111, 98, 97, 108,
+80, 114, 111, 120, 121, 40, 103, 108, 111, 98, 97, 108, 41, 59, 10, 97, 46, 80,
+114, 111, 120, 121, 61, 36, 80, 114, 111, 120, 121, 59, 10, 73, 110, 115, 116,
+97, 108, 108, 70, 117, 110, 99, 116, 105, 111, 110, 115, 40, 36, 80, 114, 111,
+120, 121, 44, 50, 44, 91, 10, 34, 99, 114, 101, 97, 116, 101, 34, 44, 80, 114,
+111, 120, 121, 67, 114, 101, 97, 116, 101, 44, 10, 34, 99, 114, 101, 97, 116,
+101, 70, 117, 110, 99, 116, 105, 111, 110, 34, 44, 80, 114, 111, 120, 121, 67,
+114, 101, 97, 116, 101, 70, 117, 110, 99, 116, 105, 111, 110, 10, 93, 41, 10,
+125, 10, 83, 101, 116, 85, 112, 80, 114, 111, 120, 121, 40, 41, 59, 10, 102,
+117, 110, 99, 116, 105, 111, 110, 32, 68, 101, 114, 105, 118, 101, 100, 67, 111,
+110, 115, 116, 114, 117, 99, 116, 84, 114, 97, 112, 40, 97, 41, 123, 10, 114,
+101, 116, 117, 114, 110, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 41, 123,
+10, 118, 97, 114, 32, 98, 61, 116, 104, 105, 115, 46, 112, 114, 111, 116, 111,
+116, 121, 112, 101, 10, 105, 102, 40, 33, 40, 37, 95, 73, 115, 83, 112, 101, 99,
+79, 98, 106, 101, 99, 116, 40, 98, 41, 41, 41, 98, 61, 36, 79, 98, 106, 101, 99,
+116, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 10, 118, 97, 114, 32, 99,
+61, 123, 95, 95, 112, 114, 111, 116, 111, 95, 95, 58, 98, 125, 59, 10, 118, 97,
+114, 32, 100, 61, 37, 65, 112, 112, 108, 121, 40, 97, 44, 99, 44, 97, 114, 103,
+117, 109, 101, 110, 116, 115, 44, 48, 44, 37, 95, 65, 114, 103, 117, 109, 101,
+110, 116, 115, 76, 101, 110, 103, 116, 104, 40, 41, 41, 59, 10, 114, 101, 116,
+117, 114, 110, 40, 37, 95, 73, 115, 83, 112, 101, 99, 79, 98, 106, 101, 99, 116,
+40, 100, 41, 41, 63, 100, 58, 99, 10, 125, 10, 125, 10, 102, 117, 110, 99, 116,
+105, 111, 110, 32, 68, 101, 108, 101, 103, 97, 116, 101, 67, 97, 108, 108, 65,
+110, 100, 67, 111, 110, 115, 116, 114, 117, 99, 116, 40, 97, 44, 98, 41, 123,
+10, 114, 101, 116, 117, 114, 110, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40,
+41, 123, 10, 114, 101, 116, 117, 114, 110, 32, 37, 65, 112, 112, 108, 121, 40,
+37, 95, 73, 115, 67, 111, 110, 115, 116, 114, 117, 99, 116, 67, 97, 108, 108,
+40, 41, 63, 98, 58, 97, 44, 10, 116, 104, 105, 115, 44, 97, 114, 103, 117, 109,
+101, 110, 116, 115, 44, 48, 44, 37, 95, 65, 114, 103, 117, 109, 101, 110, 116,
+115, 76, 101, 110, 103, 116, 104, 40, 41, 41, 10, 125, 10, 125, 10, 102, 117,
+110, 99, 116, 105, 111, 110, 32, 68, 101, 114, 105, 118, 101, 100, 71, 101, 116,
+84, 114, 97, 112, 40, 97, 44, 98, 41, 123, 10, 118, 97, 114, 32, 99, 61, 116,
+104, 105, 115, 46, 103, 101, 116, 80, 114, 111, 112, 101, 114, 116, 121, 68,
+101, 115, 99, 114, 105, 112, 116, 111, 114, 40, 98, 41, 10, 105, 102, 40, 40,
+99, 61, 61, 61, 40, 118, 111, 105, 100, 32, 48, 41, 41, 41, 123, 114, 101, 116,
+117, 114, 110, 32, 99, 125, 10, 105, 102, 40, 39, 118, 97, 108, 117, 101, 39,
+105, 110, 32, 99, 41, 123, 10, 114, 101, 116, 117, 114, 110, 32, 99, 46, 118,
+97, 108, 117, 101, 10, 125, 101, 108, 115, 101, 123, 10, 105, 102, 40, 40, 99,
+46, 103, 101, 116, 61, 61, 61, 40, 118, 111, 105, 100, 32, 48, 41, 41, 41, 123,
+114, 101, 116, 117, 114, 110, 32, 99, 46, 103, 101, 116, 125, 10, 114, 101, 116,
+117, 114, 110, 32, 37, 95, 67, 97, 108, 108, 70, 117, 110, 99, 116, 105, 111,
+110, 40, 97, 44, 99, 46, 103, 101, 116, 41, 10, 125, 10, 125, 10, 102, 117, 110,
+99, 116, 105, 111, 110, 32, 68, 101, 114, 105, 118, 101, 100, 83, 101, 116, 84,
+114, 97, 112, 40, 97, 44, 98, 44, 99, 41, 123, 10, 118, 97, 114, 32, 100, 61,
+116, 104, 105, 115, 46, 103, 101, 116, 79, 119, 110, 80, 114, 111, 112, 101,
+114, 116, 121, 68, 101, 115, 99, 114, 105, 112, 116, 111, 114, 40, 98, 41, 10,
+105, 102, 40, 100, 41, 123, 10, 105, 102, 40, 39, 119, 114, 105, 116, 97, 98,
+108, 101, 39, 105, 110, 32, 100, 41, 123, 10, 105, 102, 40, 100, 46, 119, 114,
+105, 116, 97, 98, 108, 101, 41, 123, 10, 100, 46, 118, 97, 108, 117, 101, 61,
+99, 10, 116, 104, 105, 115, 46, 100, 101, 102, 105, 110, 101, 80, 114, 111, 112,
+101, 114, 116, 121, 40, 98, 44, 100, 41, 10, 114, 101, 116, 117, 114, 110, 32,
+116, 114, 117, 101, 10, 125, 101, 108, 115, 101, 123, 10, 114, 101, 116, 117,
+114, 110, 32, 102, 97, 108, 115, 101, 10, 125, 10, 125, 101, 108, 115, 101, 123,
+10, 105, 102, 40, 100, 46, 115, 101, 116, 41, 123, 10, 37, 95, 67, 97, 108, 108,
+70, 117, 110, 99, 116, 105, 111, 110, 40, 97, 44, 99, 44, 100, 46, 115, 101,
+116, 41, 10, 114, 101, 116, 117, 114, 110, 32, 116, 114, 117, 101, 10, 125, 101,
+108, 115, 101, 123, 10, 114, 101, 116, 117, 114, 110, 32, 102, 97, 108, 115,
+101, 10, 125, 10, 125, 10, 125, 10, 100, 61, 116, 104, 105, 115, 46, 103, 101,
+116, 80, 114, 111, 112, 101, 114, 116, 121, 68, 101, 115, 99, 114, 105, 112,
+116, 111, 114, 40, 98, 41, 10, 105, 102, 40, 100, 41, 123, 10, 105, 102, 40, 39,
+119, 114, 105, 116, 97, 98, 108, 101, 39, 105, 110, 32, 100, 41, 123, 10, 105,
+102, 40, 100, 46, 119, 114, 105, 116, 97, 98, 108, 101, 41, 123, 10, 125, 101,
+108, 115, 101, 123, 10, 114, 101, 116, 117, 114, 110, 32, 102, 97, 108, 115,
+101, 10, 125, 10, 125, 101, 108, 115, 101, 123, 10, 105, 102, 40, 100, 46, 115,
+101, 116, 41, 123, 10, 37, 95, 67, 97, 108, 108, 70, 117, 110, 99, 116, 105,
+111, 110, 40, 97, 44, 99, 44, 100, 46, 115, 101, 116, 41, 10, 114, 101, 116,
+117, 114, 110, 32, 116, 114, 117, 101, 10, 125, 101, 108, 115, 101, 123, 10,
+114, 101, 116, 117, 114, 110, 32, 102, 97, 108, 115, 101, 10, 125, 10, 125, 10,
+125, 10, 116, 104, 105, 115, 46, 100, 101, 102, 105, 110, 101, 80, 114, 111,
+112, 101, 114, 116, 121, 40, 98, 44, 123, 10, 118, 97, 108, 117, 101, 58, 99,
+44, 10, 119, 114, 105, 116, 97, 98, 108, 101, 58, 116, 114, 117, 101, 44, 10,
+101, 110, 117, 109, 101, 114, 97, 98, 108, 101, 58, 116, 114, 117, 101, 44, 10,
+99, 111, 110, 102, 105, 103, 117, 114, 97, 98, 108, 101, 58, 116, 114, 117, 101,
+125, 41, 59, 10, 114, 101, 116, 117, 114, 110, 32, 116, 114, 117, 101, 59, 10,
+125, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 68, 101, 114, 105, 118, 101,
+100, 72, 97, 115, 84, 114, 97, 112, 40, 97, 41, 123, 10, 114, 101, 116, 117,
+114, 110, 33, 33, 116, 104, 105, 115, 46, 103, 101, 116, 80, 114, 111, 112, 101,
+114, 116, 121, 68, 101, 115, 99, 114, 105, 112, 116, 111, 114, 40, 97, 41, 10,
+125, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 68, 101, 114, 105, 118, 101,
+100, 72, 97, 115, 79, 119, 110, 84, 114, 97, 112, 40, 97, 41, 123, 10, 114, 101,
+116, 117, 114, 110, 33, 33, 116, 104, 105, 115, 46, 103, 101, 116, 79, 119, 110,
+80, 114, 111, 112, 101, 114, 116, 121, 68, 101, 115, 99, 114, 105, 112, 116,
+111, 114, 40, 97, 41, 10, 125, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32,
+68, 101, 114, 105, 118, 101, 100, 75, 101, 121, 115, 84, 114, 97, 112, 40, 41,
+123, 10, 118, 97, 114, 32, 97, 61, 116, 104, 105, 115, 46, 103, 101, 116, 79,
+119, 110, 80, 114, 111, 112, 101, 114, 116, 121, 78, 97, 109, 101, 115, 40, 41,
+10, 118, 97, 114, 32, 98, 61, 91, 93, 10, 102, 111, 114, 40, 118, 97, 114, 32,
+99, 61, 48, 44, 99, 111, 117, 110, 116, 61, 48, 59, 99, 60, 97, 46, 108, 101,
+110, 103, 116, 104, 59, 43, 43, 99, 41, 123, 10, 118, 97, 114, 32, 100, 61, 97,
+91, 99, 93, 10, 105, 102, 40, 40, 116, 121, 112, 101, 111, 102, 40, 100, 41, 61,
+61, 61, 39, 115, 121, 109, 98, 111, 108, 39, 41, 41, 99, 111, 110, 116, 105,
+110, 117, 101, 10, 118, 97, 114, 32, 101, 61, 116, 104, 105, 115, 46, 103, 101,
+116, 79, 119, 110, 80, 114, 111, 112, 101, 114, 116, 121, 68, 101, 115, 99, 114,
+105, 112, 116, 111, 114, 40, 40, 40, 116, 121, 112, 101, 111, 102, 40, 37, 73,
+83, 95, 86, 65, 82, 40, 100, 41, 41, 61, 61, 61, 39, 115, 116, 114, 105, 110,
+103, 39, 41, 63, 100, 58, 78, 111, 110, 83, 116, 114, 105, 110, 103, 84, 111,
+83, 116, 114, 105, 110, 103, 40, 100, 41, 41, 41, 10, 105, 102, 40, 33, 40, 101,
+61, 61, 61, 40, 118, 111, 105, 100, 32, 48, 41, 41, 38, 38, 101, 46, 101, 110,
+117, 109, 101, 114, 97, 98, 108, 101, 41, 123, 10, 98, 91, 99, 111, 117, 110,
+116, 43, 43, 93, 61, 97, 91, 99, 93, 10, 125, 10, 125, 10, 114, 101, 116, 117,
+114, 110, 32, 98, 10, 125, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 68,
+101, 114, 105, 118, 101, 100, 69, 110, 117, 109, 101, 114, 97, 116, 101, 84,
+114, 97, 112, 40, 41, 123, 10, 118, 97, 114, 32, 97, 61, 116, 104, 105, 115, 46,
+103, 101, 116, 80, 114, 111, 112, 101, 114, 116, 121, 78, 97, 109, 101, 115, 40,
+41, 10, 118, 97, 114, 32, 98, 61, 91, 93, 10, 102, 111, 114, 40, 118, 97, 114,
+32, 99, 61, 48, 44, 99, 111, 117, 110, 116, 61, 48, 59, 99, 60, 97, 46, 108,
+101, 110, 103, 116, 104, 59, 43, 43, 99, 41, 123, 10, 118, 97, 114, 32, 100, 61,
+97, 91, 99, 93, 10, 105, 102, 40, 40, 116, 121, 112, 101, 111, 102, 40, 100, 41,
+61, 61, 61, 39, 115, 121, 109, 98, 111, 108, 39, 41, 41, 99, 111, 110, 116, 105,
+110, 117, 101, 10, 118, 97, 114, 32, 101, 61, 116, 104, 105, 115, 46, 103, 101,
+116, 80, 114, 111, 112, 101, 114, 116, 121, 68, 101, 115, 99, 114, 105, 112,
+116, 111, 114, 40, 40, 40, 116, 121, 112, 101, 111, 102, 40, 37, 73, 83, 95, 86,
+65, 82, 40, 100, 41, 41, 61, 61, 61, 39, 115, 116, 114, 105, 110, 103, 39, 41,
+63, 100, 58, 78, 111, 110, 83, 116, 114, 105, 110, 103, 84, 111, 83, 116, 114,
+105, 110, 103, 40, 100, 41, 41, 41, 10, 105, 102, 40, 33, 40, 101, 61, 61, 61,
+40, 118, 111, 105, 100, 32, 48, 41, 41, 41, 123, 10, 105, 102, 40, 33, 101, 46,
+99, 111, 110, 102, 105, 103, 117, 114, 97, 98, 108, 101, 41, 123, 10, 116, 104,
+114, 111, 119, 32, 77, 97, 107, 101, 84, 121, 112, 101, 69, 114, 114, 111, 114,
+40, 34, 112, 114, 111, 120, 121, 95, 112, 114, 111, 112, 95, 110, 111, 116, 95,
+99, 111, 110, 102, 105, 103, 117, 114, 97, 98, 108, 101, 34, 44, 10, 91, 116,
+104, 105, 115, 44, 34, 103, 101, 116, 80, 114, 111, 112, 101, 114, 116, 121, 68,
+101, 115, 99, 114, 105, 112, 116, 111, 114, 34, 44, 100, 93, 41, 10, 125, 10,
+105, 102, 40, 101, 46, 101, 110, 117, 109, 101, 114, 97, 98, 108, 101, 41, 98,
+91, 99, 111, 117, 110, 116, 43, 43, 93, 61, 97, 91, 99, 93, 10, 125, 10, 125,
+10, 114, 101, 116, 117, 114, 110, 32, 98, 10, 125, 10, 102, 117, 110, 99, 116,
+105, 111, 110, 32, 80, 114, 111, 120, 121, 69, 110, 117, 109, 101, 114, 97, 116,
+101, 40, 97, 41, 123, 10, 118, 97, 114, 32, 98, 61, 37, 71, 101, 116, 72, 97,
+110, 100, 108, 101, 114, 40, 97, 41, 10, 105, 102, 40, 40, 98, 46, 101, 110,
+117, 109, 101, 114, 97, 116, 101, 61, 61, 61, 40, 118, 111, 105, 100, 32, 48,
+41, 41, 41, 123, 10, 114, 101, 116, 117, 114, 110, 32, 37, 65, 112, 112, 108,
+121, 40, 68, 101, 114, 105, 118, 101, 100, 69, 110, 117, 109, 101, 114, 97, 116,
+101, 84, 114, 97, 112, 44, 98, 44, 91, 93, 44, 48, 44, 48, 41, 10, 125, 101,
+108, 115, 101, 123, 10, 114, 101, 116, 117, 114, 110, 32, 84, 111, 78, 97, 109,
+101, 65, 114, 114, 97, 121, 40, 98, 46, 101, 110, 117, 109, 101, 114, 97, 116,
+101, 40, 41, 44, 34, 101, 110, 117, 109, 101, 114, 97, 116, 101, 34, 44, 102,
+97, 108, 115, 101, 41, 10, 125, 10, 125, 10, 10, 10, 34, 117, 115, 101, 32, 115,
+116, 114, 105, 99, 116, 34, 59, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32,
+71, 101, 110, 101, 114, 97, 116, 111, 114, 79, 98, 106, 101, 99, 116, 78, 101,
+120, 116, 40, 97, 41, 123, 10, 105, 102, 40, 33, 40, 37, 95, 67, 108, 97, 115,
+115, 79, 102, 40, 116, 104, 105, 115, 41, 61, 61, 61, 39, 71, 101, 110, 101,
+114, 97, 116, 111, 114, 39, 41, 41, 123, 10, 116, 104, 114, 111, 119, 32, 77,
+97, 107, 101, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 39, 105, 110, 99,
+111, 109, 112, 97, 116, 105, 98, 108, 101, 95, 109, 101, 116, 104, 111, 100, 95,
+114, 101, 99, 101, 105, 118, 101, 114, 39, 44, 10, 91, 39, 91, 71, 101, 110,
+101, 114, 97, 116, 111, 114, 93, 46, 112, 114, 111, 116, 111, 116, 121, 112,
+101, 46, 110, 101, 120, 116, 39, 44, 116, 104, 105, 115, 93, 41, 59, 10, 125,
+10, 118, 97, 114, 32, 98, 61, 37, 71, 101, 110, 101, 114, 97, 116, 111, 114, 71,
+101, 116, 67, 111, 110, 116, 105, 110, 117, 97, 116, 105, 111, 110, 40, 116,
+104, 105, 115, 41, 59, 10, 105, 102, 40, 98, 62, 48, 41, 123, 10, 105, 102, 40,
+40, 37, 95, 68, 101, 98, 117, 103, 73, 115, 65, 99, 116, 105, 118, 101, 40, 41,
+33, 61, 48, 41, 41, 37, 68, 101, 98, 117, 103, 80, 114, 101, 112, 97, 114, 101,
+83, 116, 101, 112, 73, 110, 73, 102, 83, 116, 101, 112, 112, 105, 110, 103, 40,
+116, 104, 105, 115, 41, 59, 10, 116, 114, 121, 123, 10, 114, 101, 116, 117, 114,
+110, 32, 37, 95, 71, 101, 110, 101, 114, 97, 116, 111, 114, 78, 101, 120, 116,
+40, 116, 104, 105, 115, 44, 97, 41, 59, 10, 125, 99, 97, 116, 99, 104, 40, 101,
+41, 123, 10, 37, 71, 101, 110, 101, 114, 97, 116, 111, 114, 67, 108, 111, 115,
+101, 40, 116, 104, 105, 115, 41, 59, 10, 116, 104, 114, 111, 119, 32, 101, 59,
+10, 125, 10, 125, 101, 108, 115, 101, 32, 105, 102, 40, 98, 61, 61, 48, 41, 123,
+10, 114, 101, 116, 117, 114, 110, 123, 118, 97, 108, 117, 101, 58, 118, 111,
+105, 100, 32, 48, 44, 100, 111, 110, 101, 58, 116, 114, 117, 101, 125, 59, 10,
+125, 101, 108, 115, 101, 123, 10, 116, 104, 114, 111, 119, 32, 77, 97, 107, 101,
+84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 39, 103, 101, 110, 101, 114, 97,
+116, 111, 114, 95, 114, 117, 110, 110, 105, 110, 103, 39, 44, 91, 93, 41, 59,
+10, 125, 10, 125, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 71, 101, 110,
+101, 114, 97, 116, 111, 114, 79, 98, 106, 101, 99, 116, 84, 104, 114, 111, 119,
+40, 97, 41, 123, 10, 105, 102, 40, 33, 40, 37, 95, 67, 108, 97, 115, 115, 79,
+102, 40, 116, 104, 105, 115, 41, 61, 61, 61, 39, 71, 101, 110, 101, 114, 97,
+116, 111, 114, 39, 41, 41, 123, 10, 116, 104, 114, 111, 119, 32, 77, 97, 107,
+101, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 39, 105, 110, 99, 111, 109,
+112, 97, 116, 105, 98, 108, 101, 95, 109, 101, 116, 104, 111, 100, 95, 114, 101,
+99, 101, 105, 118, 101, 114, 39, 44, 10, 91, 39, 91, 71, 101, 110, 101, 114, 97,
+116, 111, 114, 93, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 116,
+104, 114, 111, 119, 39, 44, 116, 104, 105, 115, 93, 41, 59, 10, 125, 10, 118,
+97, 114, 32, 98, 61, 37, 71, 101, 110, 101, 114, 97, 116, 111, 114, 71, 101,
+116, 67, 111, 110, 116, 105, 110, 117, 97, 116, 105, 111, 110, 40, 116, 104,
+105, 115, 41, 59, 10, 105, 102, 40, 98, 62, 48, 41, 123, 10, 116, 114, 121, 123,
+10, 114, 101, 116, 117, 114, 110, 32, 37, 95, 71, 101, 110, 101, 114, 97, 116,
+111, 114, 84, 104, 114, 111, 119, 40, 116, 104, 105, 115, 44, 97, 41, 59, 10,
+125, 99, 97, 116, 99, 104, 40, 101, 41, 123, 10, 37, 71, 101, 110, 101, 114, 97,
+116, 111, 114, 67, 108, 111, 115, 101, 40, 116, 104, 105, 115, 41, 59, 10, 116,
+104, 114, 111, 119, 32, 101, 59, 10, 125, 10, 125, 101, 108, 115, 101, 32, 105,
+102, 40, 98, 61, 61, 48, 41, 123, 10, 116, 104, 114, 111, 119, 32, 97, 59, 10,
+125, 101, 108, 115, 101, 123, 10, 116, 104, 114, 111, 119, 32, 77, 97, 107, 101,
+84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 39, 103, 101, 110, 101, 114, 97,
+116, 111, 114, 95, 114, 117, 110, 110, 105, 110, 103, 39, 44, 91, 93, 41, 59,
+10, 125, 10, 125, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 71, 101, 110,
+101, 114, 97, 116, 111, 114, 79, 98, 106, 101, 99, 116, 73, 116, 101, 114, 97,
+116, 111, 114, 40, 41, 123, 10, 114, 101, 116, 117, 114, 110, 32, 116, 104, 105,
+115, 59, 10, 125, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 71, 101, 110,
+101, 114, 97, 116, 111, 114, 70, 117, 110, 99, 116, 105, 111, 110, 80, 114, 111,
+116, 111, 116, 121, 112, 101, 67, 111, 110, 115, 116, 114, 117, 99, 116, 111,
+114, 40, 97, 41, 123, 10, 105, 102, 40, 37, 95, 73, 115, 67, 111, 110, 115, 116,
+114, 117, 99, 116, 67, 97, 108, 108, 40, 41, 41, 123, 10, 116, 104, 114, 111,
+119, 32, 77, 97, 107, 101, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 39,
+110, 111, 116, 95, 99, 111, 110, 115, 116, 114, 117, 99, 116, 111, 114, 39, 44,
+91, 39, 71, 101, 110, 101, 114, 97, 116, 111, 114, 70, 117, 110, 99, 116, 105,
+111, 110, 80, 114, 111, 116, 111, 116, 121, 112, 101, 39, 93, 41, 59, 10, 125,
+10, 125, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 71, 101, 110, 101, 114,
+97, 116, 111, 114, 70, 117, 110, 99, 116, 105, 111, 110, 67, 111, 110, 115, 116,
+114, 117, 99, 116, 111, 114, 40, 97, 41, 123, 10, 114, 101, 116, 117, 114, 110,
+32, 78, 101, 119, 70, 117, 110, 99, 116, 105, 111, 110, 70, 114, 111, 109, 83,
+116, 114, 105, 110, 103, 40, 97, 114, 103, 117, 109, 101, 110, 116, 115, 44, 39,
+102, 117, 110, 99, 116, 105, 111, 110, 42, 39, 41, 59, 10, 125, 10, 102, 117,
+110, 99, 116, 105, 111, 110, 32, 83, 101, 116, 85, 112, 71, 101, 110, 101, 114,
+97, 116, 111, 114, 115, 40, 41, 123, 10, 37, 67, 104, 101, 99, 107, 73, 115, 66,
+111, 111, 116, 115, 116, 114, 97, 112, 112, 105, 110, 103, 40, 41, 59, 10, 37,
+78, 101, 118, 101, 114, 79, 112, 116, 105, 109, 105, 122, 101, 70, 117, 110, 99,
+116, 105, 111, 110, 40, 71, 101, 110, 101, 114, 97, 116, 111, 114, 79, 98, 106,
+101, 99, 116, 78, 101, 120, 116, 41, 59, 10, 37, 78, 101, 118, 101, 114, 79,
+112, 116, 105, 109, 105, 122, 101, 70, 117, 110, 99, 116, 105, 111, 110, 40, 71,
+101, 110, 101, 114, 97, 116, 111, 114, 79, 98, 106, 101, 99, 116, 84, 104, 114,
+111, 119, 41, 59, 10, 118, 97, 114, 32, 97, 61, 71, 101, 110, 101, 114, 97, 116,
+111, 114, 70, 117, 110, 99, 116, 105, 111, 110, 80, 114, 111, 116, 111, 116,
+121, 112, 101, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 59, 10, 73, 110,
+115, 116, 97, 108, 108, 70, 117, 110, 99, 116, 105, 111, 110, 115, 40, 97, 44,
+10, 50, 124, 52, 124, 49, 44, 10, 91, 34, 110, 101, 120, 116, 34, 44, 71, 101,
+110, 101, 114, 97, 116, 111, 114, 79, 98, 106, 101, 99, 116, 78, 101, 120, 116,
+44, 10, 34, 116, 104, 114, 111, 119, 34, 44, 71, 101, 110, 101, 114, 97, 116,
+111, 114, 79, 98, 106, 101, 99, 116, 84, 104, 114, 111, 119, 93, 41, 59, 10, 37,
+70, 117, 110, 99, 116, 105, 111, 110, 83, 101, 116, 78, 97, 109, 101, 40, 71,
+101, 110, 101, 114, 97, 116, 111, 114, 79, 98, 106, 101, 99, 116, 73, 116, 101,
+114, 97, 116, 111, 114, 44, 39, 91, 83, 121, 109, 98, 111, 108, 46, 105, 116,
+101, 114, 97, 116, 111, 114, 93, 39, 41, 59, 10, 37, 65, 100, 100, 78, 97, 109,
+101, 100, 80, 114, 111, 112, 101, 114, 116, 121, 40, 97, 44, 115, 121, 109, 98,
+111, 108, 73, 116, 101, 114, 97, 116, 111, 114, 44, 10, 71, 101, 110, 101, 114,
+97, 116, 111, 114, 79, 98, 106, 101, 99, 116, 73, 116, 101, 114, 97, 116, 111,
+114, 44, 50, 124, 52, 124, 49, 41, 59, 10, 37, 65, 100, 100, 78, 97, 109, 101,
+100, 80, 114, 111, 112, 101, 114, 116, 121, 40, 97, 44, 34, 99, 111, 110, 115,
+116, 114, 117, 99, 116, 111, 114, 34, 44, 10, 71, 101, 110, 101, 114, 97, 116,
+111, 114, 70, 117, 110, 99, 116, 105, 111, 110, 80, 114, 111, 116, 111, 116,
+121, 112, 101, 44, 50, 124, 49, 41, 59, 10, 37, 65, 100, 100, 78, 97, 109, 101,
+100, 80, 114, 111, 112, 101, 114, 116, 121, 40, 97, 44, 10, 115, 121, 109, 98,
+111, 108, 84, 111, 83, 116, 114, 105, 110, 103, 84, 97, 103, 44, 34, 71, 101,
+110, 101, 114, 97, 116, 111, 114, 34, 44, 50, 124, 49, 41, 59, 10, 37, 73, 110,
+116, 101, 114, 110, 97, 108, 83, 101, 116, 80, 114, 111, 116, 111, 116, 121,
+112, 101, 40, 71, 101, 110, 101, 114, 97, 116, 111, 114, 70, 117, 110, 99, 116,
+105, 111, 110, 80, 114, 111, 116, 111, 116, 121, 112, 101, 44, 36, 70, 117, 110,
+99, 116, 105, 111, 110, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 41, 59,
+10, 37, 65, 100, 100, 78, 97, 109, 101, 100, 80, 114, 111, 112, 101, 114, 116,
+121, 40, 71, 101, 110, 101, 114, 97, 116, 111, 114, 70, 117, 110, 99, 116, 105,
+111, 110, 80, 114, 111, 116, 111, 116, 121, 112, 101, 44, 10, 115, 121, 109, 98,
+111, 108, 84, 111, 83, 116, 114, 105, 110, 103, 84, 97, 103, 44, 34, 71, 101,
+110, 101, 114, 97, 116, 111, 114, 70, 117, 110, 99, 116, 105, 111, 110, 34, 44,
+50, 124, 49, 41, 59, 10, 37, 83, 101, 116, 67, 111, 100, 101, 40, 71, 101, 110,
+101, 114, 97, 116, 111, 114, 70, 117, 110, 99, 116, 105, 111, 110, 80, 114, 111,
+116, 111, 116, 121, 112, 101, 44, 71, 101, 110, 101, 114, 97, 116, 111, 114, 70,
+117, 110, 99, 116, 105, 111, 110, 80, 114, 111, 116, 111, 116, 121, 112, 101,
+67, 111, 110, 115, 116, 114, 117, 99, 116, 111, 114, 41, 59, 10, 37, 65, 100,
+100, 78, 97, 109, 101, 100, 80, 114, 111, 112, 101, 114, 116, 121, 40, 71, 101,
+110, 101, 114, 97, 116, 111, 114, 70, 117, 110, 99, 116, 105, 111, 110, 80, 114,
+111, 116, 111, 116, 121, 112, 101, 44, 34, 99, 111, 110, 115, 116, 114, 117, 99,
+116, 111, 114, 34, 44, 10, 71, 101, 110, 101, 114, 97, 116, 111, 114, 70, 117,
+110, 99, 116, 105, 111, 110, 44, 50, 124, 49, 41, 59, 10, 37, 73, 110, 116, 101,
+114, 110, 97, 108, 83, 101, 116, 80, 114, 111, 116, 111, 116, 121, 112, 101, 40,
+71, 101, 110, 101, 114, 97, 116, 111, 114, 70, 117, 110, 99, 116, 105, 111, 110,
+44, 36, 70, 117, 110, 99, 116, 105, 111, 110, 41, 59, 10, 37, 83, 101, 116, 67,
+111, 100, 101, 40, 71, 101, 110, 101, 114, 97, 116, 111, 114, 70, 117, 110, 99,
+116, 105, 111, 110, 44, 71, 101, 110, 101, 114, 97, 116, 111, 114, 70, 117, 110,
+99, 116, 105, 111, 110, 67, 111, 110, 115, 116, 114, 117, 99, 116, 111, 114, 41,
+59, 10, 125, 10, 83, 101, 116, 85, 112, 71, 101, 110, 101, 114, 97, 116, 111,
+114, 115, 40, 41, 59, 10, 10, 10, 34, 117, 115, 101, 32, 115, 116, 114, 105, 99,
+116, 34, 59, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 83, 116, 114, 105,
+110, 103, 82, 101, 112, 101, 97, 116, 40, 97, 41, 123, 10, 105, 102, 40, 40,
+116, 104, 105, 115, 61, 61, 110, 117, 108, 108, 41, 38, 38, 33, 40, 37, 95, 73,
+115, 85, 110, 100, 101, 116, 101, 99, 116, 97, 98, 108, 101, 79, 98, 106, 101,
+99, 116, 40, 116, 104, 105, 115, 41, 41, 41, 116, 104, 114, 111, 119, 32, 77,
+97, 107, 101, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 39, 99, 97, 108,
+108, 101, 100, 95, 111, 110, 95, 110, 117, 108, 108, 95, 111, 114, 95, 117, 110,
+100, 101, 102, 105, 110, 101, 100, 39, 44, 91, 34, 83, 116, 114, 105, 110, 103,
+46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 114, 101, 112, 101, 97,
+116, 34, 93, 41, 59, 10, 118, 97, 114, 32, 98, 61, 40, 40, 116, 121, 112, 101,
+111, 102, 40, 37, 73, 83, 95, 86, 65, 82, 40, 116, 104, 105, 115, 41, 41, 61,
+61, 61, 39, 115, 116, 114, 105, 110, 103, 39, 41, 63, 116, 104, 105, 115, 58,
+78, 111, 110, 83, 116, 114, 105, 110, 103, 84, 111, 83, 116, 114, 105, 110, 103,
+40, 116, 104, 105, 115, 41, 41, 59, 10, 118, 97, 114, 32, 99, 61, 84, 111, 73,
+110, 116, 101, 103, 101, 114, 40, 97, 41, 59, 10, 105, 102, 40, 99, 60, 48, 124,
+124, 99, 62, 37, 95, 77, 97, 120, 83, 109, 105, 40, 41, 41, 123, 10, 116, 104,
+114, 111, 119, 32, 77, 97, 107, 101, 82, 97, 110, 103, 101, 69, 114, 114, 111,
+114, 40, 34, 105, 110, 118, 97, 108, 105, 100, 95, 99, 111, 117, 110, 116, 95,
+118, 97, 108, 117, 101, 34, 44, 91, 93, 41, 59, 10, 125, 10, 118, 97, 114, 32,
+100, 61, 34, 34, 59, 10, 119, 104, 105, 108, 101, 40, 116, 114, 117, 101, 41,
+123, 10, 105, 102, 40, 99, 38, 49, 41, 100, 43, 61, 98, 59, 10, 99, 62, 62, 61,
+49, 59, 10, 105, 102, 40, 99, 61, 61, 61, 48, 41, 114, 101, 116, 117, 114, 110,
+32, 100, 59, 10, 98, 43, 61, 98, 59, 10, 125, 10, 125, 10, 102, 117, 110, 99,
+116, 105, 111, 110, 32, 83, 116, 114, 105, 110, 103, 83, 116, 97, 114, 116, 115,
+87, 105, 116, 104, 40, 97, 41, 123, 10, 105, 102, 40, 40, 116, 104, 105, 115,
+61, 61, 110, 117, 108, 108, 41, 38, 38, 33, 40, 37, 95, 73, 115, 85, 110, 100,
+101, 116, 101, 99, 116, 97, 98, 108, 101, 79, 98, 106, 101, 99, 116, 40, 116,
+104, 105, 115, 41, 41, 41, 116, 104, 114, 111, 119, 32, 77, 97, 107, 101, 84,
+121, 112, 101, 69, 114, 114, 111, 114, 40, 39, 99, 97, 108, 108, 101, 100, 95,
+111, 110, 95, 110, 117, 108, 108, 95, 111, 114, 95, 117, 110, 100, 101, 102,
+105, 110, 101, 100, 39, 44, 91, 34, 83, 116, 114, 105, 110, 103, 46, 112, 114,
+111, 116, 111, 116, 121, 112, 101, 46, 115, 116, 97, 114, 116, 115, 87, 105,
+116, 104, 34, 93, 41, 59, 10, 118, 97, 114, 32, 98, 61, 40, 40, 116, 121, 112,
+101, 111, 102, 40, 37, 73, 83, 95, 86, 65, 82, 40, 116, 104, 105, 115, 41, 41,
+61, 61, 61, 39, 115, 116, 114, 105, 110, 103, 39, 41, 63, 116, 104, 105, 115,
+58, 78, 111, 110, 83, 116, 114, 105, 110, 103, 84, 111, 83, 116, 114, 105, 110,
+103, 40, 116, 104, 105, 115, 41, 41, 59, 10, 105, 102, 40, 40, 37, 95, 73, 115,
+82, 101, 103, 69, 120, 112, 40, 97, 41, 41, 41, 123, 10, 116, 104, 114, 111,
+119, 32, 77, 97, 107, 101, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 34,
+102, 105, 114, 115, 116, 95, 97, 114, 103, 117, 109, 101, 110, 116, 95, 110,
+111, 116, 95, 114, 101, 103, 101, 120, 112, 34, 44, 10, 91, 34, 83, 116, 114,
+105, 110, 103, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 115, 116,
+97, 114, 116, 115, 87, 105, 116, 104, 34, 93, 41, 59, 10, 125, 10, 118, 97, 114,
+32, 99, 61, 40, 40, 116, 121, 112, 101, 111, 102, 40, 37, 73, 83, 95, 86, 65,
+82, 40, 97, 41, 41, 61, 61, 61, 39, 115, 116, 114, 105, 110, 103, 39, 41, 63,
+97, 58, 78, 111, 110, 83, 116, 114, 105, 110, 103, 84, 111, 83, 116, 114, 105,
+110, 103, 40, 97, 41, 41, 59, 10, 118, 97, 114, 32, 100, 61, 48, 59, 10, 105,
+102, 40, 37, 95, 65, 114, 103, 117, 109, 101, 110, 116, 115, 76, 101, 110, 103,
+116, 104, 40, 41, 62, 49, 41, 123, 10, 100, 61, 37, 95, 65, 114, 103, 117, 109,
+101, 110, 116, 115, 40, 49, 41, 59, 10, 100, 61, 84, 111, 73, 110, 116, 101,
+103, 101, 114, 40, 100, 41, 59, 10, 125, 10, 118, 97, 114, 32, 101, 61, 98, 46,
+108, 101, 110, 103, 116, 104, 59, 10, 118, 97, 114, 32, 102, 61, 77, 97, 116,
+104, 77, 105, 110, 40, 77, 97, 116, 104, 77, 97, 120, 40, 100, 44, 48, 41, 44,
+101, 41, 59, 10, 118, 97, 114, 32, 103, 61, 99, 46, 108, 101, 110, 103, 116,
+104, 59, 10, 105, 102, 40, 103, 43, 102, 62, 101, 41, 123, 10, 114, 101, 116,
+117, 114, 110, 32, 102, 97, 108, 115, 101, 59, 10, 125, 10, 114, 101, 116, 117,
+114, 110, 32, 37, 83, 116, 114, 105, 110, 103, 73, 110, 100, 101, 120, 79, 102,
+40, 98, 44, 99, 44, 102, 41, 61, 61, 61, 102, 59, 10, 125, 10, 102, 117, 110,
+99, 116, 105, 111, 110, 32, 83, 116, 114, 105, 110, 103, 69, 110, 100, 115, 87,
+105, 116, 104, 40, 97, 41, 123, 10, 105, 102, 40, 40, 116, 104, 105, 115, 61,
+61, 110, 117, 108, 108, 41, 38, 38, 33, 40, 37, 95, 73, 115, 85, 110, 100, 101,
+116, 101, 99, 116, 97, 98, 108, 101, 79, 98, 106, 101, 99, 116, 40, 116, 104,
+105, 115, 41, 41, 41, 116, 104, 114, 111, 119, 32, 77, 97, 107, 101, 84, 121,
+112, 101, 69, 114, 114, 111, 114, 40, 39, 99, 97, 108, 108, 101, 100, 95, 111,
+110, 95, 110, 117, 108, 108, 95, 111, 114, 95, 117, 110, 100, 101, 102, 105,
+110, 101, 100, 39, 44, 91, 34, 83, 116, 114, 105, 110, 103, 46, 112, 114, 111,
+116, 111, 116, 121, 112, 101, 46, 101, 110, 100, 115, 87, 105, 116, 104, 34, 93,
+41, 59, 10, 118, 97, 114, 32, 98, 61, 40, 40, 116, 121, 112, 101, 111, 102, 40,
+37, 73, 83, 95, 86, 65, 82, 40, 116, 104, 105, 115, 41, 41, 61, 61, 61, 39, 115,
+116, 114, 105, 110, 103, 39, 41, 63, 116, 104, 105, 115, 58, 78, 111, 110, 83,
+116, 114, 105, 110, 103, 84, 111, 83, 116, 114, 105, 110, 103, 40, 116, 104,
+105, 115, 41, 41, 59, 10, 105, 102, 40, 40, 37, 95, 73, 115, 82, 101, 103, 69,
+120, 112, 40, 97, 41, 41, 41, 123, 10, 116, 104, 114, 111, 119, 32, 77, 97, 107,
+101, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 34, 102, 105, 114, 115, 116,
+95, 97, 114, 103, 117, 109, 101, 110, 116, 95, 110, 111, 116, 95, 114, 101, 103,
+101, 120, 112, 34, 44, 10, 91, 34, 83, 116, 114, 105, 110, 103, 46, 112, 114,
+111, 116, 111, 116, 121, 112, 101, 46, 101, 110, 100, 115, 87, 105, 116, 104,
+34, 93, 41, 59, 10, 125, 10, 118, 97, 114, 32, 99, 61, 40, 40, 116, 121, 112,
+101, 111, 102, 40, 37, 73, 83, 95, 86, 65, 82, 40, 97, 41, 41, 61, 61, 61, 39,
+115, 116, 114, 105, 110, 103, 39, 41, 63, 97, 58, 78, 111, 110, 83, 116, 114,
+105, 110, 103, 84, 111, 83, 116, 114, 105, 110, 103, 40, 97, 41, 41, 59, 10,
+118, 97, 114, 32, 100, 61, 98, 46, 108, 101, 110, 103, 116, 104, 59, 10, 118,
+97, 114, 32, 101, 61, 100, 59, 10, 105, 102, 40, 37, 95, 65, 114, 103, 117, 109,
+101, 110, 116, 115, 76, 101, 110, 103, 116, 104, 40, 41, 62, 49, 41, 123, 10,
+118, 97, 114, 32, 102, 61, 37, 95, 65, 114, 103, 117, 109, 101, 110, 116, 115,
+40, 49, 41, 59, 10, 105, 102, 40, 33, 40, 102, 61, 61, 61, 40, 118, 111, 105,
+100, 32, 48, 41, 41, 41, 123, 10, 101, 61, 84, 111, 73, 110, 116, 101, 103, 101,
+114, 40, 102, 41, 59, 10, 125, 10, 125, 10, 118, 97, 114, 32, 103, 61, 77, 97,
+116, 104, 77, 105, 110, 40, 77, 97, 116, 104, 77, 97, 120, 40, 101, 44, 48, 41,
+44, 100, 41, 59, 10, 118, 97, 114, 32, 104, 61, 99, 46, 108, 101, 110, 103, 116,
+104, 59, 10, 118, 97, 114, 32, 105, 61, 103, 45, 104, 59, 10, 105, 102, 40, 105,
+60, 48, 41, 123, 10, 114, 101, 116, 117, 114, 110, 32, 102, 97, 108, 115, 101,
+59, 10, 125, 10, 114, 101, 116, 117, 114, 110, 32, 37, 83, 116, 114, 105, 110,
+103, 76, 97, 115, 116, 73, 110, 100, 101, 120, 79, 102, 40, 98, 44, 99, 44, 105,
+41, 61, 61, 61, 105, 59, 10, 125, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32,
+83, 116, 114, 105, 110, 103, 73, 110, 99, 108, 117, 100, 101, 115, 40, 97, 41,
+123, 10, 105, 102, 40, 40, 116, 104, 105, 115, 61, 61, 110, 117, 108, 108, 41,
+38, 38, 33, 40, 37, 95, 73, 115, 85, 110, 100, 101, 116, 101, 99, 116, 97, 98,
+108, 101, 79, 98, 106, 101, 99, 116, 40, 116, 104, 105, 115, 41, 41, 41, 116,
+104, 114, 111, 119, 32, 77, 97, 107, 101, 84, 121, 112, 101, 69, 114, 114, 111,
+114, 40, 39, 99, 97, 108, 108, 101, 100, 95, 111, 110, 95, 110, 117, 108, 108,
+95, 111, 114, 95, 117, 110, 100, 101, 102, 105, 110, 101, 100, 39, 44, 91, 34,
+83, 116, 114, 105, 110, 103, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101,
+46, 105, 110, 99, 108, 117, 100, 101, 115, 34, 93, 41, 59, 10, 118, 97, 114, 32,
+98, 61, 40, 40, 116, 121, 112, 101, 111, 102, 40, 37, 73, 83, 95, 86, 65, 82,
+40, 116, 104, 105, 115, 41, 41, 61, 61, 61, 39, 115, 116, 114, 105, 110, 103,
+39, 41, 63, 116, 104, 105, 115, 58, 78, 111, 110, 83, 116, 114, 105, 110, 103,
+84, 111, 83, 116, 114, 105, 110, 103, 40, 116, 104, 105, 115, 41, 41, 59, 10,
+105, 102, 40, 40, 37, 95, 73, 115, 82, 101, 103, 69, 120, 112, 40, 97, 41, 41,
+41, 123, 10, 116, 104, 114, 111, 119, 32, 77, 97, 107, 101, 84, 121, 112, 101,
+69, 114, 114, 111, 114, 40, 34, 102, 105, 114, 115, 116, 95, 97, 114, 103, 117,
+109, 101, 110, 116, 95, 110, 111, 116, 95, 114, 101, 103, 101, 120, 112, 34, 44,
+10, 91, 34, 83, 116, 114, 105, 110, 103, 46, 112, 114, 111, 116, 111, 116, 121,
+112, 101, 46, 105, 110, 99, 108, 117, 100, 101, 115, 34, 93, 41, 59, 10, 125,
+10, 118, 97, 114, 32, 99, 61, 40, 40, 116, 121, 112, 101, 111, 102, 40, 37, 73,
+83, 95, 86, 65, 82, 40, 97, 41, 41, 61, 61, 61, 39, 115, 116, 114, 105, 110,
+103, 39, 41, 63, 97, 58, 78, 111, 110, 83, 116, 114, 105, 110, 103, 84, 111, 83,
+116, 114, 105, 110, 103, 40, 97, 41, 41, 59, 10, 118, 97, 114, 32, 100, 61, 48,
+59, 10, 105, 102, 40, 37, 95, 65, 114, 103, 117, 109, 101, 110, 116, 115, 76,
+101, 110, 103, 116, 104, 40, 41, 62, 49, 41, 123, 10, 100, 61, 37, 95, 65, 114,
+103, 117, 109, 101, 110, 116, 115, 40, 49, 41, 59, 10, 100, 61, 84, 111, 73,
+110, 116, 101, 103, 101, 114, 40, 100, 41, 59, 10, 125, 10, 118, 97, 114, 32,
+101, 61, 98, 46, 108, 101, 110, 103, 116, 104, 59, 10, 118, 97, 114, 32, 102,
+61, 77, 97, 116, 104, 77, 105, 110, 40, 77, 97, 116, 104, 77, 97, 120, 40, 100,
+44, 48, 41, 44, 101, 41, 59, 10, 118, 97, 114, 32, 103, 61, 99, 46, 108, 101,
+110, 103, 116, 104, 59, 10, 105, 102, 40, 103, 43, 102, 62, 101, 41, 123, 10,
+114, 101, 116, 117, 114, 110, 32, 102, 97, 108, 115, 101, 59, 10, 125, 10, 114,
+101, 116, 117, 114, 110, 32, 37, 83, 116, 114, 105, 110, 103, 73, 110, 100, 101,
+120, 79, 102, 40, 98, 44, 99, 44, 102, 41, 33, 61, 61, 45, 49, 59, 10, 125, 10,
+102, 117, 110, 99, 116, 105, 111, 110, 32, 83, 116, 114, 105, 110, 103, 67, 111,
+100, 101, 80, 111, 105, 110, 116, 65, 116, 40, 97, 41, 123, 10, 105, 102, 40,
+40, 116, 104, 105, 115, 61, 61, 110, 117, 108, 108, 41, 38, 38, 33, 40, 37, 95,
+73, 115, 85, 110, 100, 101, 116, 101, 99, 116, 97, 98, 108, 101, 79, 98, 106,
+101, 99, 116, 40, 116, 104, 105, 115, 41, 41, 41, 116, 104, 114, 111, 119, 32,
+77, 97, 107, 101, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 39, 99, 97,
+108, 108, 101, 100, 95, 111, 110, 95, 110, 117, 108, 108, 95, 111, 114, 95, 117,
+110, 100, 101, 102, 105, 110, 101, 100, 39, 44, 91, 34, 83, 116, 114, 105, 110,
+103, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 99, 111, 100, 101, 80,
+111, 105, 110, 116, 65, 116, 34, 93, 41, 59, 10, 118, 97, 114, 32, 98, 61, 40,
+40, 116, 121, 112, 101, 111, 102, 40, 37, 73, 83, 95, 86, 65, 82, 40, 116, 104,
+105, 115, 41, 41, 61, 61, 61, 39, 115, 116, 114, 105, 110, 103, 39, 41, 63, 116,
+104, 105, 115, 58, 78, 111, 110, 83, 116, 114, 105, 110, 103, 84, 111, 83, 116,
+114, 105, 110, 103, 40, 116, 104, 105, 115, 41, 41, 59, 10, 118, 97, 114, 32,
+99, 61, 98, 46, 108, 101, 110, 103, 116, 104, 59, 10, 97, 61, 40, 37, 95, 73,
+115, 83, 109, 105, 40, 37, 73, 83, 95, 86, 65, 82, 40, 97, 41, 41, 63, 97, 58,
+37, 78, 117, 109, 98, 101, 114, 84, 111, 73, 110, 116, 101, 103, 101, 114, 40,
+84, 111, 78, 117, 109, 98, 101, 114, 40, 97, 41, 41, 41, 59, 10, 105, 102, 40,
+97, 60, 48, 124, 124, 97, 62, 61, 99, 41, 123, 10, 114, 101, 116, 117, 114, 110,
+40, 118, 111, 105, 100, 32, 48, 41, 59, 10, 125, 10, 118, 97, 114, 32, 100, 61,
+37, 95, 83, 116, 114, 105, 110, 103, 67, 104, 97, 114, 67, 111, 100, 101, 65,
+116, 40, 98, 44, 97, 41, 59, 10, 105, 102, 40, 100, 60, 48, 120, 68, 56, 48, 48,
+124, 124, 100, 62, 48, 120, 68, 66, 70, 70, 124, 124, 97, 43, 49, 61, 61, 99,
+41, 123, 10, 114, 101, 116, 117, 114, 110, 32, 100, 59, 10, 125, 10, 118, 97,
+114, 32, 101, 61, 37, 95, 83, 116, 114, 105, 110, 103, 67, 104, 97, 114, 67,
+111, 100, 101, 65, 116, 40, 98, 44, 97, 43, 49, 41, 59, 10, 105, 102, 40, 101,
+60, 48, 120, 68, 67, 48, 48, 124, 124, 101, 62, 48, 120, 68, 70, 70, 70, 41,
+123, 10, 114, 101, 116, 117, 114, 110, 32, 100, 59, 10, 125, 10, 114, 101, 116,
+117, 114, 110, 40, 100, 45, 48, 120, 68, 56, 48, 48, 41, 42, 48, 120, 52, 48,
+48, 43, 101, 43, 48, 120, 50, 52, 48, 48, 59, 10, 125, 10, 102, 117, 110, 99,
+116, 105, 111, 110, 32, 83, 116, 114, 105, 110, 103, 70, 114, 111, 109, 67, 111,
+100, 101, 80, 111, 105, 110, 116, 40, 97, 41, 123, 10, 118, 97, 114, 32, 98, 59,
+10, 118, 97, 114, 32, 99, 61, 37, 95, 65, 114, 103, 117, 109, 101, 110, 116,
+115, 76, 101, 110, 103, 116, 104, 40, 41, 59, 10, 118, 97, 114, 32, 100, 59, 10,
+118, 97, 114, 32, 101, 61, 34, 34, 59, 10, 102, 111, 114, 40, 100, 61, 48, 59,
+100, 60, 99, 59, 100, 43, 43, 41, 123, 10, 98, 61, 37, 95, 65, 114, 103, 117,
+109, 101, 110, 116, 115, 40, 100, 41, 59, 10, 105, 102, 40, 33, 37, 95, 73, 115,
+83, 109, 105, 40, 98, 41, 41, 123, 10, 98, 61, 84, 111, 78, 117, 109, 98, 101,
+114, 40, 98, 41, 59, 10, 125, 10, 105, 102, 40, 98, 60, 48, 124, 124, 98, 62,
+48, 120, 49, 48, 70, 70, 70, 70, 124, 124, 98, 33, 61, 61, 40, 37, 95, 73, 115,
+83, 109, 105, 40, 37, 73, 83, 95, 86, 65, 82, 40, 98, 41, 41, 63, 98, 58, 37,
+78, 117, 109, 98, 101, 114, 84, 111, 73, 110, 116, 101, 103, 101, 114, 40, 84,
+111, 78, 117, 109, 98, 101, 114, 40, 98, 41, 41, 41, 41, 123, 10, 116, 104, 114,
+111, 119, 32, 77, 97, 107, 101, 82, 97, 110, 103, 101, 69, 114, 114, 111, 114,
+40, 34, 105, 110, 118, 97, 108, 105, 100, 95, 99, 111, 100, 101, 95, 112, 111,
+105, 110, 116, 34, 44, 91, 98, 93, 41, 59, 10, 125, 10, 105, 102, 40, 98, 60,
+61, 48, 120, 70, 70, 70, 70, 41, 123, 10, 101, 43, 61, 37, 95, 83, 116, 114,
+105, 110, 103, 67, 104, 97, 114, 70, 114, 111, 109, 67, 111, 100, 101, 40, 98,
+41, 59, 10, 125, 101, 108, 115, 101, 123, 10, 98, 45, 61, 48, 120, 49, 48, 48,
+48, 48, 59, 10, 101, 43, 61, 37, 95, 83, 116, 114, 105, 110, 103, 67, 104, 97,
+114, 70, 114, 111, 109, 67, 111, 100, 101, 40, 40, 98, 62, 62, 62, 49, 48, 41,
+38, 48, 120, 51, 70, 70, 124, 48, 120, 68, 56, 48, 48, 41, 59, 10, 101, 43, 61,
+37, 95, 83, 116, 114, 105, 110, 103, 67, 104, 97, 114, 70, 114, 111, 109, 67,
+111, 100, 101, 40, 98, 38, 48, 120, 51, 70, 70, 124, 48, 120, 68, 67, 48, 48,
+41, 59, 10, 125, 10, 125, 10, 114, 101, 116, 117, 114, 110, 32, 101, 59, 10,
+125, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 69, 120, 116, 101, 110, 100,
+83, 116, 114, 105, 110, 103, 80, 114, 111, 116, 111, 116, 121, 112, 101, 40, 41,
+123, 10, 37, 67, 104, 101, 99, 107, 73, 115, 66, 111, 111, 116, 115, 116, 114,
+97, 112, 112, 105, 110, 103, 40, 41, 59, 10, 73, 110, 115, 116, 97, 108, 108,
+70, 117, 110, 99, 116, 105, 111, 110, 115, 40, 36, 83, 116, 114, 105, 110, 103,
+44, 50, 44, 36, 65, 114, 114, 97, 121, 40, 10, 34, 102, 114, 111, 109, 67, 111,
+100, 101, 80, 111, 105, 110, 116, 34, 44, 83, 116, 114, 105, 110, 103, 70, 114,
+111, 109, 67, 111, 100, 101, 80, 111, 105, 110, 116, 10, 41, 41, 59, 10, 73,
+110, 115, 116, 97, 108, 108, 70, 117, 110, 99, 116, 105, 111, 110, 115, 40, 36,
+83, 116, 114, 105, 110, 103, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101,
+44, 50, 44, 36, 65, 114, 114, 97, 121, 40, 10, 34, 99, 111, 100, 101, 80, 111,
+105, 110, 116, 65, 116, 34, 44, 83, 116, 114, 105, 110, 103, 67, 111, 100, 101,
+80, 111, 105, 110, 116, 65, 116, 44, 10, 34, 105, 110, 99, 108, 117, 100, 101,
+115, 34, 44, 83, 116, 114, 105, 110, 103, 73, 110, 99, 108, 117, 100, 101, 115,
+44, 10, 34, 101, 110, 100, 115, 87, 105, 116, 104, 34, 44, 83, 116, 114, 105,
+110, 103, 69, 110, 100, 115, 87, 105, 116, 104, 44, 10, 34, 114, 101, 112, 101,
+97, 116, 34, 44, 83, 116, 114, 105, 110, 103, 82, 101, 112, 101, 97, 116, 44,
+10, 34, 115, 116, 97, 114, 116, 115, 87, 105, 116, 104, 34, 44, 83, 116, 114,
+105, 110, 103, 83, 116, 97, 114, 116, 115, 87, 105, 116, 104, 10, 41, 41, 59,
+10, 125, 10, 69, 120, 116, 101, 110, 100, 83, 116, 114, 105, 110, 103, 80, 114,
+111, 116, 111, 116, 121, 112, 101, 40, 41, 59, 10, 10, 10, 39, 117, 115, 101,
+32, 115, 116, 114, 105, 99, 116, 39, 59, 10, 102, 117, 110, 99, 116, 105, 111,
+110, 32, 65, 114, 114, 97, 121, 70, 105, 110, 100, 40, 97, 41, 123, 10, 105,
+102, 40, 40, 116, 104, 105, 115, 61, 61, 110, 117, 108, 108, 41, 38, 38, 33, 40,
+37, 95, 73, 115, 85, 110, 100, 101, 116, 101, 99, 116, 97, 98, 108, 101, 79, 98,
+106, 101, 99, 116, 40, 116, 104, 105, 115, 41, 41, 41, 116, 104, 114, 111, 119,
+32, 77, 97, 107, 101, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 39, 99, 97,
+108, 108, 101, 100, 95, 111, 110, 95, 110, 117, 108, 108, 95, 111, 114, 95, 117,
+110, 100, 101, 102, 105, 110, 101, 100, 39, 44, 91, 34, 65, 114, 114, 97, 121,
+46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 102, 105, 110, 100, 34, 93,
+41, 59, 10, 118, 97, 114, 32, 98, 61, 84, 111, 79, 98, 106, 101, 99, 116, 40,
+116, 104, 105, 115, 41, 59, 10, 118, 97, 114, 32, 99, 61, 84, 111, 73, 110, 116,
+101, 103, 101, 114, 40, 98, 46, 108, 101, 110, 103, 116, 104, 41, 59, 10, 105,
+102, 40, 33, 40, 37, 95, 67, 108, 97, 115, 115, 79, 102, 40, 97, 41, 61, 61, 61,
+39, 70, 117, 110, 99, 116, 105, 111, 110, 39, 41, 41, 123, 10, 116, 104, 114,
+111, 119, 32, 77, 97, 107, 101, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40,
+39, 99, 97, 108, 108, 101, 100, 95, 110, 111, 110, 95, 99, 97, 108, 108, 97, 98,
+108, 101, 39, 44, 91, 97, 93, 41, 59, 10, 125, 10, 118, 97, 114, 32, 100, 59,
+10, 105, 102, 40, 37, 95, 65, 114, 103, 117, 109, 101, 110, 116, 115, 76, 101,
+110, 103, 116, 104, 40, 41, 62, 49, 41, 123, 10, 100, 61, 37, 95, 65, 114, 103,
+117, 109, 101, 110, 116, 115, 40, 49, 41, 59, 10, 125, 10, 118, 97, 114, 32,
+101, 61, 102, 97, 108, 115, 101, 59, 10, 105, 102, 40, 40, 100, 61, 61, 110,
+117, 108, 108, 41, 41, 123, 10, 100, 61, 37, 71, 101, 116, 68, 101, 102, 97,
+117, 108, 116, 82, 101, 99, 101, 105, 118, 101, 114, 40, 97, 41, 124, 124, 100,
+59, 10, 125, 101, 108, 115, 101, 123, 10, 101, 61, 40, 33, 40, 37, 95, 73, 115,
+83, 112, 101, 99, 79, 98, 106, 101, 99, 116, 40, 100, 41, 41, 38, 38, 37, 73,
+115, 83, 108, 111, 112, 112, 121, 77, 111, 100, 101, 70, 117, 110, 99, 116, 105,
+111, 110, 40, 97, 41, 41, 59, 10, 125, 10, 102, 111, 114, 40, 118, 97, 114, 32,
+102, 61, 48, 59, 102, 60, 99, 59, 102, 43, 43, 41, 123, 10, 105, 102, 40, 102,
+32, 105, 110, 32, 98, 41, 123, 10, 118, 97, 114, 32, 103, 61, 98, 91, 102, 93,
+59, 10, 118, 97, 114, 32, 104, 61, 101, 63, 84, 111, 79, 98, 106, 101, 99, 116,
+40, 100, 41, 58, 100, 59, 10, 105, 102, 40, 37, 95, 67, 97, 108, 108, 70, 117,
+110, 99, 116, 105, 111, 110, 40, 104, 44, 103, 44, 102, 44, 98, 44, 97, 41, 41,
+123, 10, 114, 101, 116, 117, 114, 110, 32, 103, 59, 10, 125, 10, 125, 10, 125,
+10, 114, 101, 116, 117, 114, 110, 59, 10, 125, 10, 102, 117, 110, 99, 116, 105,
+111, 110, 32, 65, 114, 114, 97, 121, 70, 105, 110, 100, 73, 110, 100, 101, 120,
+40, 97, 41, 123, 10, 105, 102, 40, 40, 116, 104, 105, 115, 61, 61, 110, 117,
+108, 108, 41, 38, 38, 33, 40, 37, 95, 73, 115, 85, 110, 100, 101, 116, 101, 99,
+116, 97, 98, 108, 101, 79, 98, 106, 101, 99, 116, 40, 116, 104, 105, 115, 41,
+41, 41, 116, 104, 114, 111, 119, 32, 77, 97, 107, 101, 84, 121, 112, 101, 69,
+114, 114, 111, 114, 40, 39, 99, 97, 108, 108, 101, 100, 95, 111, 110, 95, 110,
+117, 108, 108, 95, 111, 114, 95, 117, 110, 100, 101, 102, 105, 110, 101, 100,
+39, 44, 91, 34, 65, 114, 114, 97, 121, 46, 112, 114, 111, 116, 111, 116, 121,
+112, 101, 46, 102, 105, 110, 100, 73, 110, 100, 101, 120, 34, 93, 41, 59, 10,
+118, 97, 114, 32, 98, 61, 84, 111, 79, 98, 106, 101, 99, 116, 40, 116, 104, 105,
+115, 41, 59, 10, 118, 97, 114, 32, 99, 61, 84, 111, 73, 110, 116, 101, 103, 101,
+114, 40, 98, 46, 108, 101, 110, 103, 116, 104, 41, 59, 10, 105, 102, 40, 33, 40,
+37, 95, 67, 108, 97, 115, 115, 79, 102, 40, 97, 41, 61, 61, 61, 39, 70, 117,
+110, 99, 116, 105, 111, 110, 39, 41, 41, 123, 10, 116, 104, 114, 111, 119, 32,
+77, 97, 107, 101, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 39, 99, 97,
+108, 108, 101, 100, 95, 110, 111, 110, 95, 99, 97, 108, 108, 97, 98, 108, 101,
+39, 44, 91, 97, 93, 41, 59, 10, 125, 10, 118, 97, 114, 32, 100, 59, 10, 105,
+102, 40, 37, 95, 65, 114, 103, 117, 109, 101, 110, 116, 115, 76, 101, 110, 103,
+116, 104, 40, 41, 62, 49, 41, 123, 10, 100, 61, 37, 95, 65, 114, 103, 117, 109,
+101, 110, 116, 115, 40, 49, 41, 59, 10, 125, 10, 118, 97, 114, 32, 101, 61, 102,
+97, 108, 115, 101, 59, 10, 105, 102, 40, 40, 100, 61, 61, 110, 117, 108, 108,
+41, 41, 123, 10, 100, 61, 37, 71, 101, 116, 68, 101, 102, 97, 117, 108, 116, 82,
+101, 99, 101, 105, 118, 101, 114, 40, 97, 41, 124, 124, 100, 59, 10, 125, 101,
+108, 115, 101, 123, 10, 101, 61, 40, 33, 40, 37, 95, 73, 115, 83, 112, 101, 99,
+79, 98, 106, 101, 99, 116, 40, 100, 41, 41, 38, 38, 37, 73, 115, 83, 108, 111,
+112, 112, 121, 77, 111, 100, 101, 70, 117, 110, 99, 116, 105, 111, 110, 40, 97,
+41, 41, 59, 10, 125, 10, 102, 111, 114, 40, 118, 97, 114, 32, 102, 61, 48, 59,
+102, 60, 99, 59, 102, 43, 43, 41, 123, 10, 105, 102, 40, 102, 32, 105, 110, 32,
+98, 41, 123, 10, 118, 97, 114, 32, 103, 61, 98, 91, 102, 93, 59, 10, 118, 97,
+114, 32, 104, 61, 101, 63, 84, 111, 79, 98, 106, 101, 99, 116, 40, 100, 41, 58,
+100, 59, 10, 105, 102, 40, 37, 95, 67, 97, 108, 108, 70, 117, 110, 99, 116, 105,
+111, 110, 40, 104, 44, 103, 44, 102, 44, 98, 44, 97, 41, 41, 123, 10, 114, 101,
+116, 117, 114, 110, 32, 102, 59, 10, 125, 10, 125, 10, 125, 10, 114, 101, 116,
+117, 114, 110, 45, 49, 59, 10, 125, 10, 102, 117, 110, 99, 116, 105, 111, 110,
+32, 65, 114, 114, 97, 121, 70, 105, 108, 108, 40, 97, 41, 123, 10, 105, 102, 40,
+40, 116, 104, 105, 115, 61, 61, 110, 117, 108, 108, 41, 38, 38, 33, 40, 37, 95,
+73, 115, 85, 110, 100, 101, 116, 101, 99, 116, 97, 98, 108, 101, 79, 98, 106,
+101, 99, 116, 40, 116, 104, 105, 115, 41, 41, 41, 116, 104, 114, 111, 119, 32,
+77, 97, 107, 101, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 39, 99, 97,
+108, 108, 101, 100, 95, 111, 110, 95, 110, 117, 108, 108, 95, 111, 114, 95, 117,
+110, 100, 101, 102, 105, 110, 101, 100, 39, 44, 91, 34, 65, 114, 114, 97, 121,
+46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 102, 105, 108, 108, 34, 93,
+41, 59, 10, 118, 97, 114, 32, 98, 61, 84, 111, 79, 98, 106, 101, 99, 116, 40,
+116, 104, 105, 115, 41, 59, 10, 118, 97, 114, 32, 99, 61, 40, 98, 46, 108, 101,
+110, 103, 116, 104, 62, 62, 62, 48, 41, 59, 10, 118, 97, 114, 32, 100, 61, 48,
+59, 10, 118, 97, 114, 32, 101, 61, 99, 59, 10, 105, 102, 40, 37, 95, 65, 114,
+103, 117, 109, 101, 110, 116, 115, 76, 101, 110, 103, 116, 104, 40, 41, 62, 49,
+41, 123, 10, 100, 61, 37, 95, 65, 114, 103, 117, 109, 101, 110, 116, 115, 40,
+49, 41, 59, 10, 100, 61, 40, 100, 61, 61, 61, 40, 118, 111, 105, 100, 32, 48,
+41, 41, 63, 48, 58, 40, 37, 95, 73, 115, 83, 109, 105, 40, 37, 73, 83, 95, 86,
+65, 82, 40, 100, 41, 41, 63, 100, 58, 37, 78, 117, 109, 98, 101, 114, 84, 111,
+73, 110, 116, 101, 103, 101, 114, 40, 84, 111, 78, 117, 109, 98, 101, 114, 40,
+100, 41, 41, 41, 59, 10, 105, 102, 40, 37, 95, 65, 114, 103, 117, 109, 101, 110,
+116, 115, 76, 101, 110, 103, 116, 104, 40, 41, 62, 50, 41, 123, 10, 101, 61, 37,
+95, 65, 114, 103, 117, 109, 101, 110, 116, 115, 40, 50, 41, 59, 10, 101, 61, 40,
+101, 61, 61, 61, 40, 118, 111, 105, 100, 32, 48, 41, 41, 63, 99, 58, 40, 37, 95,
+73, 115, 83, 109, 105, 40, 37, 73, 83, 95, 86, 65, 82, 40, 101, 41, 41, 63, 101,
+58, 37, 78, 117, 109, 98, 101, 114, 84, 111, 73, 110, 116, 101, 103, 101, 114,
+40, 84, 111, 78, 117, 109, 98, 101, 114, 40, 101, 41, 41, 41, 59, 10, 125, 10,
+125, 10, 105, 102, 40, 100, 60, 48, 41, 123, 10, 100, 43, 61, 99, 59, 10, 105,
+102, 40, 100, 60, 48, 41, 100, 61, 48, 59, 10, 125, 101, 108, 115, 101, 123, 10,
+105, 102, 40, 100, 62, 99, 41, 100, 61, 99, 59, 10, 125, 10, 105, 102, 40, 101,
+60, 48, 41, 123, 10, 101, 43, 61, 99, 59, 10, 105, 102, 40, 101, 60, 48, 41,
+101, 61, 48, 59, 10, 125, 101, 108, 115, 101, 123, 10, 105, 102, 40, 101, 62,
+99, 41, 101, 61, 99, 59, 10, 125, 10, 105, 102, 40, 40, 101, 45, 100, 41, 62,
+48, 38, 38, 79, 98, 106, 101, 99, 116, 73, 115, 70, 114, 111, 122, 101, 110, 40,
+98, 41, 41, 123, 10, 116, 104, 114, 111, 119, 32, 77, 97, 107, 101, 84, 121,
+112, 101, 69, 114, 114, 111, 114, 40, 34, 97, 114, 114, 97, 121, 95, 102, 117,
+110, 99, 116, 105, 111, 110, 115, 95, 111, 110, 95, 102, 114, 111, 122, 101,
+110, 34, 44, 10, 91, 34, 65, 114, 114, 97, 121, 46, 112, 114, 111, 116, 111,
+116, 121, 112, 101, 46, 102, 105, 108, 108, 34, 93, 41, 59, 10, 125, 10, 102,
+111, 114, 40, 59, 100, 60, 101, 59, 100, 43, 43, 41, 10, 98, 91, 100, 93, 61,
+97, 59, 10, 114, 101, 116, 117, 114, 110, 32, 98, 59, 10, 125, 10, 102, 117,
+110, 99, 116, 105, 111, 110, 32, 65, 114, 114, 97, 121, 70, 114, 111, 109, 40,
+97, 44, 98, 44, 99, 41, 123, 10, 118, 97, 114, 32, 100, 61, 84, 111, 79, 98,
+106, 101, 99, 116, 40, 97, 41, 59, 10, 118, 97, 114, 32, 101, 61, 33, 40, 98,
+61, 61, 61, 40, 118, 111, 105, 100, 32, 48, 41, 41, 59, 10, 105, 102, 40, 101,
+41, 123, 10, 105, 102, 40, 33, 40, 37, 95, 67, 108, 97, 115, 115, 79, 102, 40,
+98, 41, 61, 61, 61, 39, 70, 117, 110, 99, 116, 105, 111, 110, 39, 41, 41, 123,
+10, 116, 104, 114, 111, 119, 32, 77, 97, 107, 101, 84, 121, 112, 101, 69, 114,
+114, 111, 114, 40, 39, 99, 97, 108, 108, 101, 100, 95, 110, 111, 110, 95, 99,
+97, 108, 108, 97, 98, 108, 101, 39, 44, 91, 98, 93, 41, 59, 10, 125, 101, 108,
+115, 101, 32, 105, 102, 40, 40, 99, 61, 61, 110, 117, 108, 108, 41, 41, 123, 10,
+99, 61, 37, 71, 101, 116, 68, 101, 102, 97, 117, 108, 116, 82, 101, 99, 101,
+105, 118, 101, 114, 40, 98, 41, 124, 124, 99, 59, 10, 125, 101, 108, 115, 101,
+32, 105, 102, 40, 33, 40, 37, 95, 73, 115, 83, 112, 101, 99, 79, 98, 106, 101,
+99, 116, 40, 99, 41, 41, 38, 38, 37, 73, 115, 83, 108, 111, 112, 112, 121, 77,
+111, 100, 101, 70, 117, 110, 99, 116, 105, 111, 110, 40, 98, 41, 41, 123, 10,
+99, 61, 84, 111, 79, 98, 106, 101, 99, 116, 40, 99, 41, 59, 10, 125, 10, 125,
+10, 118, 97, 114, 32, 102, 61, 71, 101, 116, 77, 101, 116, 104, 111, 100, 40,
+100, 44, 115, 121, 109, 98, 111, 108, 73, 116, 101, 114, 97, 116, 111, 114, 41,
+59, 10, 118, 97, 114, 32, 103, 59, 10, 118, 97, 114, 32, 104, 59, 10, 118, 97,
+114, 32, 105, 59, 10, 118, 97, 114, 32, 106, 59, 10, 105, 102, 40, 33, 40, 102,
+61, 61, 61, 40, 118, 111, 105, 100, 32, 48, 41, 41, 41, 123, 10, 104, 61, 37,
+73, 115, 67, 111, 110, 115, 116, 114, 117, 99, 116, 111, 114, 40, 116, 104, 105,
+115, 41, 63, 110, 101, 119, 32, 116, 104, 105, 115, 40, 41, 58, 91, 93, 59, 10,
+118, 97, 114, 32, 107, 61, 71, 101, 116, 73, 116, 101, 114, 97, 116, 111, 114,
+40, 100, 44, 102, 41, 59, 10, 103, 61, 48, 59, 10, 119, 104, 105, 108, 101, 40,
+116, 114, 117, 101, 41, 123, 10, 118, 97, 114, 32, 108, 61, 107, 46, 110, 101,
+120, 116, 40, 41, 59, 10, 105, 102, 40, 33, 40, 37, 95, 73, 115, 79, 98, 106,
+101, 99, 116, 40, 108, 41, 41, 41, 123, 10, 116, 104, 114, 111, 119, 32, 77, 97,
+107, 101, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 34, 105, 116, 101, 114,
+97, 116, 111, 114, 95, 114, 101, 115, 117, 108, 116, 95, 110, 111, 116, 95, 97,
+110, 95, 111, 98, 106, 101, 99, 116, 34, 44, 91, 108, 93, 41, 59, 10, 125, 10,
+105, 102, 40, 108, 46, 100, 111, 110, 101, 41, 123, 10, 104, 46, 108, 101, 110,
+103, 116, 104, 61, 103, 59, 10, 114, 101, 116, 117, 114, 110, 32, 104, 59, 10,
+125, 10, 106, 61, 108, 46, 118, 97, 108, 117, 101, 59, 10, 105, 102, 40, 101,
+41, 123, 10, 105, 61, 37, 95, 67, 97, 108, 108, 70, 117, 110, 99, 116, 105, 111,
+110, 40, 99, 44, 106, 44, 103, 44, 98, 41, 59, 10, 125, 101, 108, 115, 101, 123,
+10, 105, 61, 106, 59, 10, 125, 10, 37, 65, 100, 100, 69, 108, 101, 109, 101,
+110, 116, 40, 104, 44, 103, 43, 43, 44, 105, 44, 48, 41, 59, 10, 125, 10, 125,
+101, 108, 115, 101, 123, 10, 118, 97, 114, 32, 109, 61, 84, 111, 76, 101, 110,
+103, 116, 104, 40, 100, 46, 108, 101, 110, 103, 116, 104, 41, 59, 10, 104, 61,
+37, 73, 115, 67, 111, 110, 115, 116, 114, 117, 99, 116, 111, 114, 40, 116, 104,
+105, 115, 41, 63, 110, 101, 119, 32, 116, 104, 105, 115, 40, 109, 41, 58, 110,
+101, 119, 32, 36, 65, 114, 114, 97, 121, 40, 109, 41, 59, 10, 102, 111, 114, 40,
+103, 61, 48, 59, 103, 60, 109, 59, 43, 43, 103, 41, 123, 10, 106, 61, 100, 91,
+103, 93, 59, 10, 105, 102, 40, 101, 41, 123, 10, 105, 61, 37, 95, 67, 97, 108,
+108, 70, 117, 110, 99, 116, 105, 111, 110, 40, 99, 44, 106, 44, 103, 44, 98, 41,
+59, 10, 125, 101, 108, 115, 101, 123, 10, 105, 61, 106, 59, 10, 125, 10, 37, 65,
+100, 100, 69, 108, 101, 109, 101, 110, 116, 40, 104, 44, 103, 44, 105, 44, 48,
+41, 59, 10, 125, 10, 104, 46, 108, 101, 110, 103, 116, 104, 61, 103, 59, 10,
+114, 101, 116, 117, 114, 110, 32, 104, 59, 10, 125, 10, 125, 10, 102, 117, 110,
+99, 116, 105, 111, 110, 32, 65, 114, 114, 97, 121, 79, 102, 40, 41, 123, 10,
+118, 97, 114, 32, 97, 61, 37, 95, 65, 114, 103, 117, 109, 101, 110, 116, 115,
+76, 101, 110, 103, 116, 104, 40, 41, 59, 10, 118, 97, 114, 32, 98, 61, 116, 104,
+105, 115, 59, 10, 118, 97, 114, 32, 99, 61, 37, 73, 115, 67, 111, 110, 115, 116,
+114, 117, 99, 116, 111, 114, 40, 98, 41, 63, 110, 101, 119, 32, 98, 40, 97, 41,
+58, 91, 93, 59, 10, 102, 111, 114, 40, 118, 97, 114, 32, 100, 61, 48, 59, 100,
+60, 97, 59, 100, 43, 43, 41, 123, 10, 37, 65, 100, 100, 69, 108, 101, 109, 101,
+110, 116, 40, 99, 44, 100, 44, 37, 95, 65, 114, 103, 117, 109, 101, 110, 116,
+115, 40, 100, 41, 44, 48, 41, 59, 10, 125, 10, 99, 46, 108, 101, 110, 103, 116,
+104, 61, 97, 59, 10, 114, 101, 116, 117, 114, 110, 32, 99, 59, 10, 125, 10, 102,
+117, 110, 99, 116, 105, 111, 110, 32, 72, 97, 114, 109, 111, 110, 121, 65, 114,
+114, 97, 121, 69, 120, 116, 101, 110, 100, 83, 121, 109, 98, 111, 108, 80, 114,
+111, 116, 111, 116, 121, 112, 101, 40, 41, 123, 10, 37, 67, 104, 101, 99, 107,
+73, 115, 66, 111, 111, 116, 115, 116, 114, 97, 112, 112, 105, 110, 103, 40, 41,
+59, 10, 73, 110, 115, 116, 97, 108, 108, 67, 111, 110, 115, 116, 97, 110, 116,
+115, 40, 36, 83, 121, 109, 98, 111, 108, 44, 36, 65, 114, 114, 97, 121, 40, 10,
+34, 105, 115, 67, 111, 110, 99, 97, 116, 83, 112, 114, 101, 97, 100, 97, 98,
+108, 101, 34, 44, 115, 121, 109, 98, 111, 108, 73, 115, 67, 111, 110, 99, 97,
+116, 83, 112, 114, 101, 97, 100, 97, 98, 108, 101, 10, 41, 41, 59, 10, 125, 10,
+72, 97, 114, 109, 111, 110, 121, 65, 114, 114, 97, 121, 69, 120, 116, 101, 110,
+100, 83, 121, 109, 98, 111, 108, 80, 114, 111, 116, 111, 116, 121, 112, 101, 40,
+41, 59, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 72, 97, 114, 109, 111,
+110, 121, 65, 114, 114, 97, 121, 69, 120, 116, 101, 110, 100, 65, 114, 114, 97,
+121, 80, 114, 111, 116, 111, 116, 121, 112, 101, 40, 41, 123, 10, 37, 67, 104,
+101, 99, 107, 73, 115, 66, 111, 111, 116, 115, 116, 114, 97, 112, 112, 105, 110,
+103, 40, 41, 59, 10, 37, 70, 117, 110, 99, 116, 105, 111, 110, 83, 101, 116, 76,
+101, 110, 103, 116, 104, 40, 65, 114, 114, 97, 121, 70, 114, 111, 109, 44, 49,
+41, 59, 10, 73, 110, 115, 116, 97, 108, 108, 70, 117, 110, 99, 116, 105, 111,
+110, 115, 40, 36, 65, 114, 114, 97, 121, 44, 50, 44, 36, 65, 114, 114, 97, 121,
+40, 10, 34, 102, 114, 111, 109, 34, 44, 65, 114, 114, 97, 121, 70, 114, 111,
+109, 44, 10, 34, 111, 102, 34, 44, 65, 114, 114, 97, 121, 79, 102, 10, 41, 41,
+59, 10, 73, 110, 115, 116, 97, 108, 108, 70, 117, 110, 99, 116, 105, 111, 110,
+115, 40, 36, 65, 114, 114, 97, 121, 46, 112, 114, 111, 116, 111, 116, 121, 112,
+101, 44, 50, 44, 36, 65, 114, 114, 97, 121, 40, 10, 34, 102, 105, 110, 100, 34,
+44, 65, 114, 114, 97, 121, 70, 105, 110, 100, 44, 10, 34, 102, 105, 110, 100,
+73, 110, 100, 101, 120, 34, 44, 65, 114, 114, 97, 121, 70, 105, 110, 100, 73,
+110, 100, 101, 120, 44, 10, 34, 102, 105, 108, 108, 34, 44, 65, 114, 114, 97,
+121, 70, 105, 108, 108, 10, 41, 41, 59, 10, 125, 10, 72, 97, 114, 109, 111, 110,
+121, 65, 114, 114, 97, 121, 69, 120, 116, 101, 110, 100, 65, 114, 114, 97, 121,
+80, 114, 111, 116, 111, 116, 121, 112, 101, 40, 41, 59, 10, 10, 10, 39, 117,
+115, 101, 32, 115, 116, 114, 105, 99, 116, 39, 59, 10, 102, 117, 110, 99, 116,
+105, 111, 110, 32, 65, 114, 114, 97, 121, 73, 110, 99, 108, 117, 100, 101, 115,
+40, 97, 44, 98, 41, 123, 10, 118, 97, 114, 32, 99, 61, 84, 111, 79, 98, 106,
+101, 99, 116, 40, 116, 104, 105, 115, 41, 59, 10, 118, 97, 114, 32, 100, 61, 84,
+111, 76, 101, 110, 103, 116, 104, 40, 99, 46, 108, 101, 110, 103, 116, 104, 41,
+59, 10, 105, 102, 40, 100, 61, 61, 61, 48, 41, 123, 10, 114, 101, 116, 117, 114,
+110, 32, 102, 97, 108, 115, 101, 59, 10, 125, 10, 118, 97, 114, 32, 101, 61, 84,
+111, 73, 110, 116, 101, 103, 101, 114, 40, 98, 41, 59, 10, 118, 97, 114, 32,
+102, 59, 10, 105, 102, 40, 101, 62, 61, 48, 41, 123, 10, 102, 61, 101, 59, 10,
+125, 101, 108, 115, 101, 123, 10, 102, 61, 100, 43, 101, 59, 10, 105, 102, 40,
+102, 60, 48, 41, 123, 10, 102, 61, 48, 59, 10, 125, 10, 125, 10, 119, 104, 105,
+108, 101, 40, 102, 60, 100, 41, 123, 10, 118, 97, 114, 32, 103, 61, 99, 91, 102,
+93, 59, 10, 105, 102, 40, 83, 97, 109, 101, 86, 97, 108, 117, 101, 90, 101, 114,
+111, 40, 97, 44, 103, 41, 41, 123, 10, 114, 101, 116, 117, 114, 110, 32, 116,
+114, 117, 101, 59, 10, 125, 10, 43, 43, 102, 59, 10, 125, 10, 114, 101, 116,
+117, 114, 110, 32, 102, 97, 108, 115, 101, 59, 10, 125, 10, 102, 117, 110, 99,
+116, 105, 111, 110, 32, 72, 97, 114, 109, 111, 110, 121, 65, 114, 114, 97, 121,
+73, 110, 99, 108, 117, 100, 101, 115, 69, 120, 116, 101, 110, 100, 65, 114, 114,
+97, 121, 80, 114, 111, 116, 111, 116, 121, 112, 101, 40, 41, 123, 10, 37, 67,
+104, 101, 99, 107, 73, 115, 66, 111, 111, 116, 115, 116, 114, 97, 112, 112, 105,
+110, 103, 40, 41, 59, 10, 37, 70, 117, 110, 99, 116, 105, 111, 110, 83, 101,
+116, 76, 101, 110, 103, 116, 104, 40, 65, 114, 114, 97, 121, 73, 110, 99, 108,
+117, 100, 101, 115, 44, 49, 41, 59, 10, 73, 110, 115, 116, 97, 108, 108, 70,
+117, 110, 99, 116, 105, 111, 110, 115, 40, 36, 65, 114, 114, 97, 121, 46, 112,
+114, 111, 116, 111, 116, 121, 112, 101, 44, 50, 44, 36, 65, 114, 114, 97, 121,
+40, 10, 34, 105, 110, 99, 108, 117, 100, 101, 115, 34, 44, 65, 114, 114, 97,
+121, 73, 110, 99, 108, 117, 100, 101, 115, 10, 41, 41, 59, 10, 125, 10, 72, 97,
+114, 109, 111, 110, 121, 65, 114, 114, 97, 121, 73, 110, 99, 108, 117, 100, 101,
+115, 69, 120, 116, 101, 110, 100, 65, 114, 114, 97, 121, 80, 114, 111, 116, 111,
+116, 121, 112, 101, 40, 41, 59, 10, 10, 10, 34, 117, 115, 101, 32, 115, 116,
+114, 105, 99, 116, 34, 59, 10, 68, 101, 102, 97, 117, 108, 116, 79, 98, 106,
+101, 99, 116, 84, 111, 83, 116, 114, 105, 110, 103, 61, 79, 98, 106, 101, 99,
+116, 84, 111, 83, 116, 114, 105, 110, 103, 72, 97, 114, 109, 111, 110, 121, 59,
+10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 79, 98, 106, 101, 99, 116, 84,
+111, 83, 116, 114, 105, 110, 103, 72, 97, 114, 109, 111, 110, 121, 40, 41, 123,
+10, 105, 102, 40, 40, 116, 104, 105, 115, 61, 61, 61, 40, 118, 111, 105, 100,
+32, 48, 41, 41, 38, 38, 33, 40, 37, 95, 73, 115, 85, 110, 100, 101, 116, 101,
+99, 116, 97, 98, 108, 101, 79, 98, 106, 101, 99, 116, 40, 116, 104, 105, 115,
+41, 41, 41, 114, 101, 116, 117, 114, 110, 34, 91, 111, 98, 106, 101, 99, 116,
+32, 85, 110, 100, 101, 102, 105, 110, 101, 100, 93, 34, 59, 10, 105, 102, 40,
+40, 116, 104, 105, 115, 61, 61, 61, 110, 117, 108, 108, 41, 41, 114, 101, 116,
+117, 114, 110, 34, 91, 111, 98, 106, 101, 99, 116, 32, 78, 117, 108, 108, 93,
+34, 59, 10, 118, 97, 114, 32, 97, 61, 84, 111, 79, 98, 106, 101, 99, 116, 40,
+116, 104, 105, 115, 41, 59, 10, 118, 97, 114, 32, 98, 61, 37, 95, 67, 108, 97,
+115, 115, 79, 102, 40, 97, 41, 59, 10, 118, 97, 114, 32, 99, 61, 97, 91, 115,
+121, 109, 98, 111, 108, 84, 111, 83, 116, 114, 105, 110, 103, 84, 97, 103, 93,
+59, 10, 105, 102, 40, 33, 40, 116, 121, 112, 101, 111, 102, 40, 99, 41, 61, 61,
+61, 39, 115, 116, 114, 105, 110, 103, 39, 41, 41, 123, 10, 99, 61, 98, 59, 10,
+125, 10, 114, 101, 116, 117, 114, 110, 34, 91, 111, 98, 106, 101, 99, 116, 32,
+34, 43, 99, 43, 34, 93, 34, 59, 10, 125, 10, 102, 117, 110, 99, 116, 105, 111,
+110, 32, 72, 97, 114, 109, 111, 110, 121, 84, 111, 83, 116, 114, 105, 110, 103,
+69, 120, 116, 101, 110, 100, 83, 121, 109, 98, 111, 108, 80, 114, 111, 116, 111,
+116, 121, 112, 101, 40, 41, 123, 10, 37, 67, 104, 101, 99, 107, 73, 115, 66,
+111, 111, 116, 115, 116, 114, 97, 112, 112, 105, 110, 103, 40, 41, 59, 10, 73,
+110, 115, 116, 97, 108, 108, 67, 111, 110, 115, 116, 97, 110, 116, 115, 40, 36,
+83, 121, 109, 98, 111, 108, 44, 36, 65, 114, 114, 97, 121, 40, 10, 34, 116, 111,
+83, 116, 114, 105, 110, 103, 84, 97, 103, 34, 44, 115, 121, 109, 98, 111, 108,
+84, 111, 83, 116, 114, 105, 110, 103, 84, 97, 103, 10, 41, 41, 59, 10, 125, 10,
+72, 97, 114, 109, 111, 110, 121, 84, 111, 83, 116, 114, 105, 110, 103, 69, 120,
+116, 101, 110, 100, 83, 121, 109, 98, 111, 108, 80, 114, 111, 116, 111, 116,
+121, 112, 101, 40, 41, 59, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 72,
+97, 114, 109, 111, 110, 121, 84, 111, 83, 116, 114, 105, 110, 103, 69, 120, 116,
+101, 110, 100, 79, 98, 106, 101, 99, 116, 80, 114, 111, 116, 111, 116, 121, 112,
+101, 40, 41, 123, 10, 37, 67, 104, 101, 99, 107, 73, 115, 66, 111, 111, 116,
+115, 116, 114, 97, 112, 112, 105, 110, 103, 40, 41, 59, 10, 37, 70, 117, 110,
+99, 116, 105, 111, 110, 83, 101, 116, 78, 97, 109, 101, 40, 79, 98, 106, 101,
+99, 116, 84, 111, 83, 116, 114, 105, 110, 103, 72, 97, 114, 109, 111, 110, 121,
+44, 34, 116, 111, 83, 116, 114, 105, 110, 103, 34, 41, 59, 10, 37, 70, 117, 110,
+99, 116, 105, 111, 110, 82, 101, 109, 111, 118, 101, 80, 114, 111, 116, 111,
+116, 121, 112, 101, 40, 79, 98, 106, 101, 99, 116, 84, 111, 83, 116, 114, 105,
+110, 103, 72, 97, 114, 109, 111, 110, 121, 41, 59, 10, 37, 83, 101, 116, 78, 97,
+116, 105, 118, 101, 70, 108, 97, 103, 40, 79, 98, 106, 101, 99, 116, 84, 111,
+83, 116, 114, 105, 110, 103, 72, 97, 114, 109, 111, 110, 121, 41, 59, 10, 118,
+97, 114, 32, 97, 61, 84, 111, 80, 114, 111, 112, 101, 114, 116, 121, 68, 101,
+115, 99, 114, 105, 112, 116, 111, 114, 40, 123, 10, 118, 97, 108, 117, 101, 58,
+79, 98, 106, 101, 99, 116, 84, 111, 83, 116, 114, 105, 110, 103, 72, 97, 114,
+109, 111, 110, 121, 10, 125, 41, 59, 10, 68, 101, 102, 105, 110, 101, 79, 119,
+110, 80, 114, 111, 112, 101, 114, 116, 121, 40, 36, 79, 98, 106, 101, 99, 116,
+46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 44, 34, 116, 111, 83, 116, 114,
+105, 110, 103, 34, 44, 97, 44, 102, 97, 108, 115, 101, 41, 59, 10, 37, 84, 111,
+70, 97, 115, 116, 80, 114, 111, 112, 101, 114, 116, 105, 101, 115, 40, 36, 79,
+98, 106, 101, 99, 116, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 41, 59,
+10, 125, 10, 72, 97, 114, 109, 111, 110, 121, 84, 111, 83, 116, 114, 105, 110,
+103, 69, 120, 116, 101, 110, 100, 79, 98, 106, 101, 99, 116, 80, 114, 111, 116,
+111, 116, 121, 112, 101, 40, 41, 59, 10, 10, 10, 34, 117, 115, 101, 32, 115,
+116, 114, 105, 99, 116, 34, 59, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32,
+85, 105, 110, 116, 56, 65, 114, 114, 97, 121, 70, 111, 114, 69, 97, 99, 104, 40,
+97, 41, 123, 10, 105, 102, 40, 33, 37, 73, 115, 84, 121, 112, 101, 100, 65, 114,
+114, 97, 121, 40, 116, 104, 105, 115, 41, 41, 123, 10, 116, 104, 114, 111, 119,
+32, 77, 97, 107, 101, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 39, 110,
+111, 116, 95, 116, 121, 112, 101, 100, 95, 97, 114, 114, 97, 121, 39, 44, 91,
+93, 41, 59, 10, 125, 10, 105, 102, 40, 33, 40, 37, 95, 67, 108, 97, 115, 115,
+79, 102, 40, 97, 41, 61, 61, 61, 39, 70, 117, 110, 99, 116, 105, 111, 110, 39,
+41, 41, 123, 10, 116, 104, 114, 111, 119, 32, 77, 97, 107, 101, 84, 121, 112,
+101, 69, 114, 114, 111, 114, 40, 39, 99, 97, 108, 108, 101, 100, 95, 110, 111,
+110, 95, 99, 97, 108, 108, 97, 98, 108, 101, 39, 44, 91, 97, 93, 41, 59, 10,
+125, 10, 118, 97, 114, 32, 98, 61, 37, 95, 84, 121, 112, 101, 100, 65, 114, 114,
+97, 121, 71, 101, 116, 76, 101, 110, 103, 116, 104, 40, 116, 104, 105, 115, 41,
+59, 10, 118, 97, 114, 32, 99, 59, 10, 105, 102, 40, 37, 95, 65, 114, 103, 117,
+109, 101, 110, 116, 115, 76, 101, 110, 103, 116, 104, 40, 41, 62, 49, 41, 123,
+10, 99, 61, 37, 95, 65, 114, 103, 117, 109, 101, 110, 116, 115, 40, 49, 41, 59,
+10, 125, 10, 118, 97, 114, 32, 100, 61, 102, 97, 108, 115, 101, 59, 10, 105,
+102, 40, 40, 99, 61, 61, 110, 117, 108, 108, 41, 41, 123, 10, 99, 61, 37, 71,
+101, 116, 68, 101, 102, 97, 117, 108, 116, 82, 101, 99, 101, 105, 118, 101, 114,
+40, 97, 41, 124, 124, 99, 59, 10, 125, 101, 108, 115, 101, 123, 10, 100, 61, 40,
+33, 40, 37, 95, 73, 115, 83, 112, 101, 99, 79, 98, 106, 101, 99, 116, 40, 99,
+41, 41, 38, 38, 37, 73, 115, 83, 108, 111, 112, 112, 121, 77, 111, 100, 101, 70,
+117, 110, 99, 116, 105, 111, 110, 40, 97, 41, 41, 59, 10, 125, 10, 118, 97, 114,
+32, 101, 61, 40, 37, 95, 68, 101, 98, 117, 103, 73, 115, 65, 99, 116, 105, 118,
+101, 40, 41, 33, 61, 48, 41, 38, 38, 37, 68, 101, 98, 117, 103, 67, 97, 108,
+108, 98, 97, 99, 107, 83, 117, 112, 112, 111, 114, 116, 115, 83, 116, 101, 112,
+112, 105, 110, 103, 40, 97, 41, 59, 10, 102, 111, 114, 40, 118, 97, 114, 32,
+103, 61, 48, 59, 103, 60, 98, 59, 103, 43, 43, 41, 123, 10, 118, 97, 114, 32,
+104, 61, 116, 104, 105, 115, 91, 103, 93, 59, 10, 105, 102, 40, 101, 41, 37, 68,
+101, 98, 117, 103, 80, 114, 101, 112, 97, 114, 101, 83, 116, 101, 112, 73, 110,
+73, 102, 83, 116, 101, 112, 112, 105, 110, 103, 40, 97, 41, 59, 10, 118, 97,
+114, 32, 105, 61, 100, 63, 84, 111, 79, 98, 106, 101, 99, 116, 40, 99, 41, 58,
+99, 59, 10, 37, 95, 67, 97, 108, 108, 70, 117, 110, 99, 116, 105, 111, 110, 40,
+105, 44, 40, 40, 37, 95, 73, 115, 83, 112, 101, 99, 79, 98, 106, 101, 99, 116,
+40, 37, 73, 83, 95, 86, 65, 82, 40, 104, 41, 41, 41, 63, 104, 58, 84, 111, 79,
+98, 106, 101, 99, 116, 40, 104, 41, 41, 44, 103, 44, 116, 104, 105, 115, 44, 97,
+41, 59, 10, 125, 10, 125, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 85,
+105, 110, 116, 56, 65, 114, 114, 97, 121, 79, 102, 40, 41, 123, 10, 118, 97,
+114, 32, 97, 61, 37, 95, 65, 114, 103, 117, 109, 101, 110, 116, 115, 76, 101,
+110, 103, 116, 104, 40, 41, 59, 10, 118, 97, 114, 32, 98, 61, 110, 101, 119, 32,
+116, 104, 105, 115, 40, 97, 41, 59, 10, 102, 111, 114, 40, 118, 97, 114, 32, 99,
+61, 48, 59, 99, 60, 97, 59, 99, 43, 43, 41, 123, 10, 98, 91, 99, 93, 61, 37, 95,
+65, 114, 103, 117, 109, 101, 110, 116, 115, 40, 99, 41, 59, 10, 125, 10, 114,
+101, 116, 117, 114, 110, 32, 98, 59, 10, 125, 10, 10, 102, 117, 110, 99, 116,
+105, 111, 110, 32, 73, 110, 116, 56, 65, 114, 114, 97, 121, 70, 111, 114, 69,
+97, 99, 104, 40, 97, 41, 123, 10, 105, 102, 40, 33, 37, 73, 115, 84, 121, 112,
+101, 100, 65, 114, 114, 97, 121, 40, 116, 104, 105, 115, 41, 41, 123, 10, 116,
+104, 114, 111, 119, 32, 77, 97, 107, 101, 84, 121, 112, 101, 69, 114, 114, 111,
+114, 40, 39, 110, 111, 116, 95, 116, 121, 112, 101, 100, 95, 97, 114, 114, 97,
+121, 39, 44, 91, 93, 41, 59, 10, 125, 10, 105, 102, 40, 33, 40, 37, 95, 67, 108,
+97, 115, 115, 79, 102, 40, 97, 41, 61, 61, 61, 39, 70, 117, 110, 99, 116, 105,
+111, 110, 39, 41, 41, 123, 10, 116, 104, 114, 111, 119, 32, 77, 97, 107, 101,
+84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 39, 99, 97, 108, 108, 101, 100,
+95, 110, 111, 110, 95, 99, 97, 108, 108, 97, 98, 108, 101, 39, 44, 91, 97, 93,
+41, 59, 10, 125, 10, 118, 97, 114, 32, 98, 61, 37, 95, 84, 121, 112, 101, 100,
+65, 114, 114, 97, 121, 71, 101, 116, 76, 101, 110, 103, 116, 104, 40, 116, 104,
+105, 115, 41, 59, 10, 118, 97, 114, 32, 99, 59, 10, 105, 102, 40, 37, 95, 65,
+114, 103, 117, 109, 101, 110, 116, 115, 76, 101, 110, 103, 116, 104, 40, 41, 62,
+49, 41, 123, 10, 99, 61, 37, 95, 65, 114, 103, 117, 109, 101, 110, 116, 115, 40,
+49, 41, 59, 10, 125, 10, 118, 97, 114, 32, 100, 61, 102, 97, 108, 115, 101, 59,
+10, 105, 102, 40, 40, 99, 61, 61, 110, 117, 108, 108, 41, 41, 123, 10, 99, 61,
+37, 71, 101, 116, 68, 101, 102, 97, 117, 108, 116, 82, 101, 99, 101, 105, 118,
+101, 114, 40, 97, 41, 124, 124, 99, 59, 10, 125, 101, 108, 115, 101, 123, 10,
+100, 61, 40, 33, 40, 37, 95, 73, 115, 83, 112, 101, 99, 79, 98, 106, 101, 99,
+116, 40, 99, 41, 41, 38, 38, 37, 73, 115, 83, 108, 111, 112, 112, 121, 77, 111,
+100, 101, 70, 117, 110, 99, 116, 105, 111, 110, 40, 97, 41, 41, 59, 10, 125, 10,
+118, 97, 114, 32, 101, 61, 40, 37, 95, 68, 101, 98, 117, 103, 73, 115, 65, 99,
+116, 105, 118, 101, 40, 41, 33, 61, 48, 41, 38, 38, 37, 68, 101, 98, 117, 103,
+67, 97, 108, 108, 98, 97, 99, 107, 83, 117, 112, 112, 111, 114, 116, 115, 83,
+116, 101, 112, 112, 105, 110, 103, 40, 97, 41, 59, 10, 102, 111, 114, 40, 118,
+97, 114, 32, 103, 61, 48, 59, 103, 60, 98, 59, 103, 43, 43, 41, 123, 10, 118,
+97, 114, 32, 104, 61, 116, 104, 105, 115, 91, 103, 93, 59, 10, 105, 102, 40,
+101, 41, 37, 68, 101, 98, 117, 103, 80, 114, 101, 112, 97, 114, 101, 83, 116,
+101, 112, 73, 110, 73, 102, 83, 116, 101, 112, 112, 105, 110, 103, 40, 97, 41,
+59, 10, 118, 97, 114, 32, 105, 61, 100, 63, 84, 111, 79, 98, 106, 101, 99, 116,
+40, 99, 41, 58, 99, 59, 10, 37, 95, 67, 97, 108, 108, 70, 117, 110, 99, 116,
+105, 111, 110, 40, 105, 44, 40, 40, 37, 95, 73, 115, 83, 112, 101, 99, 79, 98,
+106, 101, 99, 116, 40, 37, 73, 83, 95, 86, 65, 82, 40, 104, 41, 41, 41, 63, 104,
+58, 84, 111, 79, 98, 106, 101, 99, 116, 40, 104, 41, 41, 44, 103, 44, 116, 104,
+105, 115, 44, 97, 41, 59, 10, 125, 10, 125, 10, 102, 117, 110, 99, 116, 105,
+111, 110, 32, 73, 110, 116, 56, 65, 114, 114, 97, 121, 79, 102, 40, 41, 123, 10,
+118, 97, 114, 32, 97, 61, 37, 95, 65, 114, 103, 117, 109, 101, 110, 116, 115,
+76, 101, 110, 103, 116, 104, 40, 41, 59, 10, 118, 97, 114, 32, 98, 61, 110, 101,
+119, 32, 116, 104, 105, 115, 40, 97, 41, 59, 10, 102, 111, 114, 40, 118, 97,
+114, 32, 99, 61, 48, 59, 99, 60, 97, 59, 99, 43, 43, 41, 123, 10, 98, 91, 99,
+93, 61, 37, 95, 65, 114, 103, 117, 109, 101, 110, 116, 115, 40, 99, 41, 59, 10,
+125, 10, 114, 101, 116, 117, 114, 110, 32, 98, 59, 10, 125, 10, 10, 102, 117,
+110, 99, 116, 105, 111, 110, 32, 85, 105, 110, 116, 49, 54, 65, 114, 114, 97,
+121, 70, 111, 114, 69, 97, 99, 104, 40, 97, 41, 123, 10, 105, 102, 40, 33, 37,
+73, 115, 84, 121, 112, 101, 100, 65, 114, 114, 97, 121, 40, 116, 104, 105, 115,
+41, 41, 123, 10, 116, 104, 114, 111, 119, 32, 77, 97, 107, 101, 84, 121, 112,
+101, 69, 114, 114, 111, 114, 40, 39, 110, 111, 116, 95, 116, 121, 112, 101, 100,
+95, 97, 114, 114, 97, 121, 39, 44, 91, 93, 41, 59, 10, 125, 10, 105, 102, 40,
+33, 40, 37, 95, 67, 108, 97, 115, 115, 79, 102, 40, 97, 41, 61, 61, 61, 39, 70,
+117, 110, 99, 116, 105, 111, 110, 39, 41, 41, 123, 10, 116, 104, 114, 111, 119,
+32, 77, 97, 107, 101, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 39, 99, 97,
+108, 108, 101, 100, 95, 110, 111, 110, 95, 99, 97, 108, 108, 97, 98, 108, 101,
+39, 44, 91, 97, 93, 41, 59, 10, 125, 10, 118, 97, 114, 32, 98, 61, 37, 95, 84,
+121, 112, 101, 100, 65, 114, 114, 97, 121, 71, 101, 116, 76, 101, 110, 103, 116,
+104, 40, 116, 104, 105, 115, 41, 59, 10, 118, 97, 114, 32, 99, 59, 10, 105, 102,
+40, 37, 95, 65, 114, 103, 117, 109, 101, 110, 116, 115, 76, 101, 110, 103, 116,
+104, 40, 41, 62, 49, 41, 123, 10, 99, 61, 37, 95, 65, 114, 103, 117, 109, 101,
+110, 116, 115, 40, 49, 41, 59, 10, 125, 10, 118, 97, 114, 32, 100, 61, 102, 97,
+108, 115, 101, 59, 10, 105, 102, 40, 40, 99, 61, 61, 110, 117, 108, 108, 41, 41,
+123, 10, 99, 61, 37, 71, 101, 116, 68, 101, 102, 97, 117, 108, 116, 82, 101, 99,
+101, 105, 118, 101, 114, 40, 97, 41, 124, 124, 99, 59, 10, 125, 101, 108, 115,
+101, 123, 10, 100, 61, 40, 33, 40, 37, 95, 73, 115, 83, 112, 101, 99, 79, 98,
+106, 101, 99, 116, 40, 99, 41, 41, 38, 38, 37, 73, 115, 83, 108, 111, 112, 112,
+121, 77, 111, 100, 101, 70, 117, 110, 99, 116, 105, 111, 110, 40, 97, 41, 41,
+59, 10, 125, 10, 118, 97, 114, 32, 101, 61, 40, 37, 95, 68, 101, 98, 117, 103,
+73, 115, 65, 99, 116, 105, 118, 101, 40, 41, 33, 61, 48, 41, 38, 38, 37, 68,
+101, 98, 117, 103, 67, 97, 108, 108, 98, 97, 99, 107, 83, 117, 112, 112, 111,
+114, 116, 115, 83, 116, 101, 112, 112, 105, 110, 103, 40, 97, 41, 59, 10, 102,
+111, 114, 40, 118, 97, 114, 32, 103, 61, 48, 59, 103, 60, 98, 59, 103, 43, 43,
+41, 123, 10, 118, 97, 114, 32, 104, 61, 116, 104, 105, 115, 91, 103, 93, 59, 10,
+105, 102, 40, 101, 41, 37, 68, 101, 98, 117, 103, 80, 114, 101, 112, 97, 114,
+101, 83, 116, 101, 112, 73, 110, 73, 102, 83, 116, 101, 112, 112, 105, 110, 103,
+40, 97, 41, 59, 10, 118, 97, 114, 32, 105, 61, 100, 63, 84, 111, 79, 98, 106,
+101, 99, 116, 40, 99, 41, 58, 99, 59, 10, 37, 95, 67, 97, 108, 108, 70, 117,
+110, 99, 116, 105, 111, 110, 40, 105, 44, 40, 40, 37, 95, 73, 115, 83, 112, 101,
+99, 79, 98, 106, 101, 99, 116, 40, 37, 73, 83, 95, 86, 65, 82, 40, 104, 41, 41,
+41, 63, 104, 58, 84, 111, 79, 98, 106, 101, 99, 116, 40, 104, 41, 41, 44, 103,
+44, 116, 104, 105, 115, 44, 97, 41, 59, 10, 125, 10, 125, 10, 102, 117, 110, 99,
+116, 105, 111, 110, 32, 85, 105, 110, 116, 49, 54, 65, 114, 114, 97, 121, 79,
+102, 40, 41, 123, 10, 118, 97, 114, 32, 97, 61, 37, 95, 65, 114, 103, 117, 109,
+101, 110, 116, 115, 76, 101, 110, 103, 116, 104, 40, 41, 59, 10, 118, 97, 114,
+32, 98, 61, 110, 101, 119, 32, 116, 104, 105, 115, 40, 97, 41, 59, 10, 102, 111,
+114, 40, 118, 97, 114, 32, 99, 61, 48, 59, 99, 60, 97, 59, 99, 43, 43, 41, 123,
+10, 98, 91, 99, 93, 61, 37, 95, 65, 114, 103, 117, 109, 101, 110, 116, 115, 40,
+99, 41, 59, 10, 125, 10, 114, 101, 116, 117, 114, 110, 32, 98, 59, 10, 125, 10,
+10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 73, 110, 116, 49, 54, 65, 114,
+114, 97, 121, 70, 111, 114, 69, 97, 99, 104, 40, 97, 41, 123, 10, 105, 102, 40,
+33, 37, 73, 115, 84, 121, 112, 101, 100, 65, 114, 114, 97, 121, 40, 116, 104,
+105, 115, 41, 41, 123, 10, 116, 104, 114, 111, 119, 32, 77, 97, 107, 101, 84,
+121, 112, 101, 69, 114, 114, 111, 114, 40, 39, 110, 111, 116, 95, 116, 121, 112,
+101, 100, 95, 97, 114, 114, 97, 121, 39, 44, 91, 93, 41, 59, 10, 125, 10, 105,
+102, 40, 33, 40, 37, 95, 67, 108, 97, 115, 115, 79, 102, 40, 97, 41, 61, 61, 61,
+39, 70, 117, 110, 99, 116, 105, 111, 110, 39, 41, 41, 123, 10, 116, 104, 114,
+111, 119, 32, 77, 97, 107, 101, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40,
+39, 99, 97, 108, 108, 101, 100, 95, 110, 111, 110, 95, 99, 97, 108, 108, 97, 98,
+108, 101, 39, 44, 91, 97, 93, 41, 59, 10, 125, 10, 118, 97, 114, 32, 98, 61, 37,
+95, 84, 121, 112, 101, 100, 65, 114, 114, 97, 121, 71, 101, 116, 76, 101, 110,
+103, 116, 104, 40, 116, 104, 105, 115, 41, 59, 10, 118, 97, 114, 32, 99, 59, 10,
+105, 102, 40, 37, 95, 65, 114, 103, 117, 109, 101, 110, 116, 115, 76, 101, 110,
+103, 116, 104, 40, 41, 62, 49, 41, 123, 10, 99, 61, 37, 95, 65, 114, 103, 117,
+109, 101, 110, 116, 115, 40, 49, 41, 59, 10, 125, 10, 118, 97, 114, 32, 100, 61,
+102, 97, 108, 115, 101, 59, 10, 105, 102, 40, 40, 99, 61, 61, 110, 117, 108,
+108, 41, 41, 123, 10, 99, 61, 37, 71, 101, 116, 68, 101, 102, 97, 117, 108, 116,
+82, 101, 99, 101, 105, 118, 101, 114, 40, 97, 41, 124, 124, 99, 59, 10, 125,
+101, 108, 115, 101, 123, 10, 100, 61, 40, 33, 40, 37, 95, 73, 115, 83, 112, 101,
+99, 79, 98, 106, 101, 99, 116, 40, 99, 41, 41, 38, 38, 37, 73, 115, 83, 108,
+111, 112, 112, 121, 77, 111, 100, 101, 70, 117, 110, 99, 116, 105, 111, 110, 40,
+97, 41, 41, 59, 10, 125, 10, 118, 97, 114, 32, 101, 61, 40, 37, 95, 68, 101, 98,
+117, 103, 73, 115, 65, 99, 116, 105, 118, 101, 40, 41, 33, 61, 48, 41, 38, 38,
+37, 68, 101, 98, 117, 103, 67, 97, 108, 108, 98, 97, 99, 107, 83, 117, 112, 112,
+111, 114, 116, 115, 83, 116, 101, 112, 112, 105, 110, 103, 40, 97, 41, 59, 10,
+102, 111, 114, 40, 118, 97, 114, 32, 103, 61, 48, 59, 103, 60, 98, 59, 103, 43,
+43, 41, 123, 10, 118, 97, 114, 32, 104, 61, 116, 104, 105, 115, 91, 103, 93, 59,
+10, 105, 102, 40, 101, 41, 37, 68, 101, 98, 117, 103, 80, 114, 101, 112, 97,
+114, 101, 83, 116, 101, 112, 73, 110, 73, 102, 83, 116, 101, 112, 112, 105, 110,
+103, 40, 97, 41, 59, 10, 118, 97, 114, 32, 105, 61, 100, 63, 84, 111, 79, 98,
+106, 101, 99, 116, 40, 99, 41, 58, 99, 59, 10, 37, 95, 67, 97, 108, 108, 70,
+117, 110, 99, 116, 105, 111, 110, 40, 105, 44, 40, 40, 37, 95, 73, 115, 83, 112,
+101, 99, 79, 98, 106, 101, 99, 116, 40, 37, 73, 83, 95, 86, 65, 82, 40, 104, 41,
+41, 41, 63, 104, 58, 84, 111, 79, 98, 106, 101, 99, 116, 40, 104, 41, 41, 44,
+103, 44, 116, 104, 105, 115, 44, 97, 41, 59, 10, 125, 10, 125, 10, 102, 117,
+110, 99, 116, 105, 111, 110, 32, 73, 110, 116, 49, 54, 65, 114, 114, 97, 121,
+79, 102, 40, 41, 123, 10, 118, 97, 114, 32, 97, 61, 37, 95, 65, 114, 103, 117,
+109, 101, 110, 116, 115, 76, 101, 110, 103, 116, 104, 40, 41, 59, 10, 118, 97,
+114, 32, 98, 61, 110, 101, 119, 32, 116, 104, 105, 115, 40, 97, 41, 59, 10, 102,
+111, 114, 40, 118, 97, 114, 32, 99, 61, 48, 59, 99, 60, 97, 59, 99, 43, 43, 41,
+123, 10, 98, 91, 99, 93, 61, 37, 95, 65, 114, 103, 117, 109, 101, 110, 116, 115,
+40, 99, 41, 59, 10, 125, 10, 114, 101, 116, 117, 114, 110, 32, 98, 59, 10, 125,
+10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 85, 105, 110, 116, 51, 50,
+65, 114, 114, 97, 121, 70, 111, 114, 69, 97, 99, 104, 40, 97, 41, 123, 10, 105,
+102, 40, 33, 37, 73, 115, 84, 121, 112, 101, 100, 65, 114, 114, 97, 121, 40,
+116, 104, 105, 115, 41, 41, 123, 10, 116, 104, 114, 111, 119, 32, 77, 97, 107,
+101, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 39, 110, 111, 116, 95, 116,
+121, 112, 101, 100, 95, 97, 114, 114, 97, 121, 39, 44, 91, 93, 41, 59, 10, 125,
+10, 105, 102, 40, 33, 40, 37, 95, 67, 108, 97, 115, 115, 79, 102, 40, 97, 41,
+61, 61, 61, 39, 70, 117, 110, 99, 116, 105, 111, 110, 39, 41, 41, 123, 10, 116,
+104, 114, 111, 119, 32, 77, 97, 107, 101, 84, 121, 112, 101, 69, 114, 114, 111,
+114, 40, 39, 99, 97, 108, 108, 101, 100, 95, 110, 111, 110, 95, 99, 97, 108,
+108, 97, 98, 108, 101, 39, 44, 91, 97, 93, 41, 59, 10, 125, 10, 118, 97, 114,
+32, 98, 61, 37, 95, 84, 121, 112, 101, 100, 65, 114, 114, 97, 121, 71, 101, 116,
+76, 101, 110, 103, 116, 104, 40, 116, 104, 105, 115, 41, 59, 10, 118, 97, 114,
+32, 99, 59, 10, 105, 102, 40, 37, 95, 65, 114, 103, 117, 109, 101, 110, 116,
+115, 76, 101, 110, 103, 116, 104, 40, 41, 62, 49, 41, 123, 10, 99, 61, 37, 95,
+65, 114, 103, 117, 109, 101, 110, 116, 115, 40, 49, 41, 59, 10, 125, 10, 118,
+97, 114, 32, 100, 61, 102, 97, 108, 115, 101, 59, 10, 105, 102, 40, 40, 99, 61,
+61, 110, 117, 108, 108, 41, 41, 123, 10, 99, 61, 37, 71, 101, 116, 68, 101, 102,
+97, 117, 108, 116, 82, 101, 99, 101, 105, 118, 101, 114, 40, 97, 41, 124, 124,
+99, 59, 10, 125, 101, 108, 115, 101, 123, 10, 100, 61, 40, 33, 40, 37, 95, 73,
+115, 83, 112, 101, 99, 79, 98, 106, 101, 99, 116, 40, 99, 41, 41, 38, 38, 37,
+73, 115, 83, 108, 111, 112, 112, 121, 77, 111, 100, 101, 70, 117, 110, 99, 116,
+105, 111, 110, 40, 97, 41, 41, 59, 10, 125, 10, 118, 97, 114, 32, 101, 61, 40,
+37, 95, 68, 101, 98, 117, 103, 73, 115, 65, 99, 116, 105, 118, 101, 40, 41, 33,
+61, 48, 41, 38, 38, 37, 68, 101, 98, 117, 103, 67, 97, 108, 108, 98, 97, 99,
+107, 83, 117, 112, 112, 111, 114, 116, 115, 83, 116, 101, 112, 112, 105, 110,
+103, 40, 97, 41, 59, 10, 102, 111, 114, 40, 118, 97, 114, 32, 103, 61, 48, 59,
+103, 60, 98, 59, 103, 43, 43, 41, 123, 10, 118, 97, 114, 32, 104, 61, 116, 104,
+105, 115, 91, 103, 93, 59, 10, 105, 102, 40, 101, 41, 37, 68, 101, 98, 117, 103,
+80, 114, 101, 112, 97, 114, 101, 83, 116, 101, 112, 73, 110, 73, 102, 83, 116,
+101, 112, 112, 105, 110, 103, 40, 97, 41, 59, 10, 118, 97, 114, 32, 105, 61,
+100, 63, 84, 111, 79, 98, 106, 101, 99, 116, 40, 99, 41, 58, 99, 59, 10, 37, 95,
+67, 97, 108, 108, 70, 117, 110, 99, 116, 105, 111, 110, 40, 105, 44, 40, 40, 37,
+95, 73, 115, 83, 112, 101, 99, 79, 98, 106, 101, 99, 116, 40, 37, 73, 83, 95,
+86, 65, 82, 40, 104, 41, 41, 41, 63, 104, 58, 84, 111, 79, 98, 106, 101, 99,
+116, 40, 104, 41, 41, 44, 103, 44, 116, 104, 105, 115, 44, 97, 41, 59, 10, 125,
+10, 125, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 85, 105, 110, 116, 51,
+50, 65, 114, 114, 97, 121, 79, 102, 40, 41, 123, 10, 118, 97, 114, 32, 97, 61,
+37, 95, 65, 114, 103, 117, 109, 101, 110, 116, 115, 76, 101, 110, 103, 116, 104,
+40, 41, 59, 10, 118, 97, 114, 32, 98, 61, 110, 101, 119, 32, 116, 104, 105, 115,
+40, 97, 41, 59, 10, 102, 111, 114, 40, 118, 97, 114, 32, 99, 61, 48, 59, 99, 60,
+97, 59, 99, 43, 43, 41, 123, 10, 98, 91, 99, 93, 61, 37, 95, 65, 114, 103, 117,
+109, 101, 110, 116, 115, 40, 99, 41, 59, 10, 125, 10, 114, 101, 116, 117, 114,
+110, 32, 98, 59, 10, 125, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 73,
+110, 116, 51, 50, 65, 114, 114, 97, 121, 70, 111, 114, 69, 97, 99, 104, 40, 97,
+41, 123, 10, 105, 102, 40, 33, 37, 73, 115, 84, 121, 112, 101, 100, 65, 114,
+114, 97, 121, 40, 116, 104, 105, 115, 41, 41, 123, 10, 116, 104, 114, 111, 119,
+32, 77, 97, 107, 101, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 39, 110,
+111, 116, 95, 116, 121, 112, 101, 100, 95, 97, 114, 114, 97, 121, 39, 44, 91,
+93, 41, 59, 10, 125, 10, 105, 102, 40, 33, 40, 37, 95, 67, 108, 97, 115, 115,
+79, 102, 40, 97, 41, 61, 61, 61, 39, 70, 117, 110, 99, 116, 105, 111, 110, 39,
+41, 41, 123, 10, 116, 104, 114, 111, 119, 32, 77, 97, 107, 101, 84, 121, 112,
+101, 69, 114, 114, 111, 114, 40, 39, 99, 97, 108, 108, 101, 100, 95, 110, 111,
+110, 95, 99, 97, 108, 108, 97, 98, 108, 101, 39, 44, 91, 97, 93, 41, 59, 10,
+125, 10, 118, 97, 114, 32, 98, 61, 37, 95, 84, 121, 112, 101, 100, 65, 114, 114,
+97, 121, 71, 101, 116, 76, 101, 110, 103, 116, 104, 40, 116, 104, 105, 115, 41,
+59, 10, 118, 97, 114, 32, 99, 59, 10, 105, 102, 40, 37, 95, 65, 114, 103, 117,
+109, 101, 110, 116, 115, 76, 101, 110, 103, 116, 104, 40, 41, 62, 49, 41, 123,
+10, 99, 61, 37, 95, 65, 114, 103, 117, 109, 101, 110, 116, 115, 40, 49, 41, 59,
+10, 125, 10, 118, 97, 114, 32, 100, 61, 102, 97, 108, 115, 101, 59, 10, 105,
+102, 40, 40, 99, 61, 61, 110, 117, 108, 108, 41, 41, 123, 10, 99, 61, 37, 71,
+101, 116, 68, 101, 102, 97, 117, 108, 116, 82, 101, 99, 101, 105, 118, 101, 114,
+40, 97, 41, 124, 124, 99, 59, 10, 125, 101, 108, 115, 101, 123, 10, 100, 61, 40,
+33, 40, 37, 95, 73, 115, 83, 112, 101, 99, 79, 98, 106, 101, 99, 116, 40, 99,
+41, 41, 38, 38, 37, 73, 115, 83, 108, 111, 112, 112, 121, 77, 111, 100, 101, 70,
+117, 110, 99, 116, 105, 111, 110, 40, 97, 41, 41, 59, 10, 125, 10, 118, 97, 114,
+32, 101, 61, 40, 37, 95, 68, 101, 98, 117, 103, 73, 115, 65, 99, 116, 105, 118,
+101, 40, 41, 33, 61, 48, 41, 38, 38, 37, 68, 101, 98, 117, 103, 67, 97, 108,
+108, 98, 97, 99, 107, 83, 117, 112, 112, 111, 114, 116, 115, 83, 116, 101, 112,
+112, 105, 110, 103, 40, 97, 41, 59, 10, 102, 111, 114, 40, 118, 97, 114, 32,
+103, 61, 48, 59, 103, 60, 98, 59, 103, 43, 43, 41, 123, 10, 118, 97, 114, 32,
+104, 61, 116, 104, 105, 115, 91, 103, 93, 59, 10, 105, 102, 40, 101, 41, 37, 68,
+101, 98, 117, 103, 80, 114, 101, 112, 97, 114, 101, 83, 116, 101, 112, 73, 110,
+73, 102, 83, 116, 101, 112, 112, 105, 110, 103, 40, 97, 41, 59, 10, 118, 97,
+114, 32, 105, 61, 100, 63, 84, 111, 79, 98, 106, 101, 99, 116, 40, 99, 41, 58,
+99, 59, 10, 37, 95, 67, 97, 108, 108, 70, 117, 110, 99, 116, 105, 111, 110, 40,
+105, 44, 40, 40, 37, 95, 73, 115, 83, 112, 101, 99, 79, 98, 106, 101, 99, 116,
+40, 37, 73, 83, 95, 86, 65, 82, 40, 104, 41, 41, 41, 63, 104, 58, 84, 111, 79,
+98, 106, 101, 99, 116, 40, 104, 41, 41, 44, 103, 44, 116, 104, 105, 115, 44, 97,
+41, 59, 10, 125, 10, 125, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 73,
+110, 116, 51, 50, 65, 114, 114, 97, 121, 79, 102, 40, 41, 123, 10, 118, 97, 114,
+32, 97, 61, 37, 95, 65, 114, 103, 117, 109, 101, 110, 116, 115, 76, 101, 110,
+103, 116, 104, 40, 41, 59, 10, 118, 97, 114, 32, 98, 61, 110, 101, 119, 32, 116,
+104, 105, 115, 40, 97, 41, 59, 10, 102, 111, 114, 40, 118, 97, 114, 32, 99, 61,
+48, 59, 99, 60, 97, 59, 99, 43, 43, 41, 123, 10, 98, 91, 99, 93, 61, 37, 95, 65,
+114, 103, 117, 109, 101, 110, 116, 115, 40, 99, 41, 59, 10, 125, 10, 114, 101,
+116, 117, 114, 110, 32, 98, 59, 10, 125, 10, 10, 102, 117, 110, 99, 116, 105,
+111, 110, 32, 70, 108, 111, 97, 116, 51, 50, 65, 114, 114, 97, 121, 70, 111,
+114, 69, 97, 99, 104, 40, 97, 41, 123, 10, 105, 102, 40, 33, 37, 73, 115, 84,
+121, 112, 101, 100, 65, 114, 114, 97, 121, 40, 116, 104, 105, 115, 41, 41, 123,
+10, 116, 104, 114, 111, 119, 32, 77, 97, 107, 101, 84, 121, 112, 101, 69, 114,
+114, 111, 114, 40, 39, 110, 111, 116, 95, 116, 121, 112, 101, 100, 95, 97, 114,
+114, 97, 121, 39, 44, 91, 93, 41, 59, 10, 125, 10, 105, 102, 40, 33, 40, 37, 95,
+67, 108, 97, 115, 115, 79, 102, 40, 97, 41, 61, 61, 61, 39, 70, 117, 110, 99,
+116, 105, 111, 110, 39, 41, 41, 123, 10, 116, 104, 114, 111, 119, 32, 77, 97,
+107, 101, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 39, 99, 97, 108, 108,
+101, 100, 95, 110, 111, 110, 95, 99, 97, 108, 108, 97, 98, 108, 101, 39, 44, 91,
+97, 93, 41, 59, 10, 125, 10, 118, 97, 114, 32, 98, 61, 37, 95, 84, 121, 112,
+101, 100, 65, 114, 114, 97, 121, 71, 101, 116, 76, 101, 110, 103, 116, 104, 40,
+116, 104, 105, 115, 41, 59, 10, 118, 97, 114, 32, 99, 59, 10, 105, 102, 40, 37,
+95, 65, 114, 103, 117, 109, 101, 110, 116, 115, 76, 101, 110, 103, 116, 104, 40,
+41, 62, 49, 41, 123, 10, 99, 61, 37, 95, 65, 114, 103, 117, 109, 101, 110, 116,
+115, 40, 49, 41, 59, 10, 125, 10, 118, 97, 114, 32, 100, 61, 102, 97, 108, 115,
+101, 59, 10, 105, 102, 40, 40, 99, 61, 61, 110, 117, 108, 108, 41, 41, 123, 10,
+99, 61, 37, 71, 101, 116, 68, 101, 102, 97, 117, 108, 116, 82, 101, 99, 101,
+105, 118, 101, 114, 40, 97, 41, 124, 124, 99, 59, 10, 125, 101, 108, 115, 101,
+123, 10, 100, 61, 40, 33, 40, 37, 95, 73, 115, 83, 112, 101, 99, 79, 98, 106,
+101, 99, 116, 40, 99, 41, 41, 38, 38, 37, 73, 115, 83, 108, 111, 112, 112, 121,
+77, 111, 100, 101, 70, 117, 110, 99, 116, 105, 111, 110, 40, 97, 41, 41, 59, 10,
+125, 10, 118, 97, 114, 32, 101, 61, 40, 37, 95, 68, 101, 98, 117, 103, 73, 115,
+65, 99, 116, 105, 118, 101, 40, 41, 33, 61, 48, 41, 38, 38, 37, 68, 101, 98,
+117, 103, 67, 97, 108, 108, 98, 97, 99, 107, 83, 117, 112, 112, 111, 114, 116,
+115, 83, 116, 101, 112, 112, 105, 110, 103, 40, 97, 41, 59, 10, 102, 111, 114,
+40, 118, 97, 114, 32, 103, 61, 48, 59, 103, 60, 98, 59, 103, 43, 43, 41, 123,
+10, 118, 97, 114, 32, 104, 61, 116, 104, 105, 115, 91, 103, 93, 59, 10, 105,
+102, 40, 101, 41, 37, 68, 101, 98, 117, 103, 80, 114, 101, 112, 97, 114, 101,
+83, 116, 101, 112, 73, 110, 73, 102, 83, 116, 101, 112, 112, 105, 110, 103, 40,
+97, 41, 59, 10, 118, 97, 114, 32, 105, 61, 100, 63, 84, 111, 79, 98, 106, 101,
+99, 116, 40, 99, 41, 58, 99, 59, 10, 37, 95, 67, 97, 108, 108, 70, 117, 110, 99,
+116, 105, 111, 110, 40, 105, 44, 40, 40, 37, 95, 73, 115, 83, 112, 101, 99, 79,
+98, 106, 101, 99, 116, 40, 37, 73, 83, 95, 86, 65, 82, 40, 104, 41, 41, 41, 63,
+104, 58, 84, 111, 79, 98, 106, 101, 99, 116, 40, 104, 41, 41, 44, 103, 44, 116,
+104, 105, 115, 44, 97, 41, 59, 10, 125, 10, 125, 10, 102, 117, 110, 99, 116,
+105, 111, 110, 32, 70, 108, 111, 97, 116, 51, 50, 65, 114, 114, 97, 121, 79,
+102, 40, 41, 123, 10, 118, 97, 114, 32, 97, 61, 37, 95, 65, 114, 103, 117, 109,
+101, 110, 116, 115, 76, 101, 110, 103, 116, 104, 40, 41, 59, 10, 118, 97, 114,
+32, 98, 61, 110, 101, 119, 32, 116, 104, 105, 115, 40, 97, 41, 59, 10, 102, 111,
+114, 40, 118, 97, 114, 32, 99, 61, 48, 59, 99, 60, 97, 59, 99, 43, 43, 41, 123,
+10, 98, 91, 99, 93, 61, 37, 95, 65, 114, 103, 117, 109, 101, 110, 116, 115, 40,
+99, 41, 59, 10, 125, 10, 114, 101, 116, 117, 114, 110, 32, 98, 59, 10, 125, 10,
+10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 70, 108, 111, 97, 116, 54, 52,
+65, 114, 114, 97, 121, 70, 111, 114, 69, 97, 99, 104, 40, 97, 41, 123, 10, 105,
+102, 40, 33, 37, 73, 115, 84, 121, 112, 101, 100, 65, 114, 114, 97, 121, 40,
+116, 104, 105, 115, 41, 41, 123, 10, 116, 104, 114, 111, 119, 32, 77, 97, 107,
+101, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 39, 110, 111, 116, 95, 116,
+121, 112, 101, 100, 95, 97, 114, 114, 97, 121, 39, 44, 91, 93, 41, 59, 10, 125,
+10, 105, 102, 40, 33, 40, 37, 95, 67, 108, 97, 115, 115, 79, 102, 40, 97, 41,
+61, 61, 61, 39, 70, 117, 110, 99, 116, 105, 111, 110, 39, 41, 41, 123, 10, 116,
+104, 114, 111, 119, 32, 77, 97, 107, 101, 84, 121, 112, 101, 69, 114, 114, 111,
+114, 40, 39, 99, 97, 108, 108, 101, 100, 95, 110, 111, 110, 95, 99, 97, 108,
+108, 97, 98, 108, 101, 39, 44, 91, 97, 93, 41, 59, 10, 125, 10, 118, 97, 114,
+32, 98, 61, 37, 95, 84, 121, 112, 101, 100, 65, 114, 114, 97, 121, 71, 101, 116,
+76, 101, 110, 103, 116, 104, 40, 116, 104, 105, 115, 41, 59, 10, 118, 97, 114,
+32, 99, 59, 10, 105, 102, 40, 37, 95, 65, 114, 103, 117, 109, 101, 110, 116,
+115, 76, 101, 110, 103, 116, 104, 40, 41, 62, 49, 41, 123, 10, 99, 61, 37, 95,
+65, 114, 103, 117, 109, 101, 110, 116, 115, 40, 49, 41, 59, 10, 125, 10, 118,
+97, 114, 32, 100, 61, 102, 97, 108, 115, 101, 59, 10, 105, 102, 40, 40, 99, 61,
+61, 110, 117, 108, 108, 41, 41, 123, 10, 99, 61, 37, 71, 101, 116, 68, 101, 102,
+97, 117, 108, 116, 82, 101, 99, 101, 105, 118, 101, 114, 40, 97, 41, 124, 124,
+99, 59, 10, 125, 101, 108, 115, 101, 123, 10, 100, 61, 40, 33, 40, 37, 95, 73,
+115, 83, 112, 101, 99, 79, 98, 106, 101, 99, 116, 40, 99, 41, 41, 38, 38, 37,
+73, 115, 83, 108, 111, 112, 112, 121, 77, 111, 100, 101, 70, 117, 110, 99, 116,
+105, 111, 110, 40, 97, 41, 41, 59, 10, 125, 10, 118, 97, 114, 32, 101, 61, 40,
+37, 95, 68, 101, 98, 117, 103, 73, 115, 65, 99, 116, 105, 118, 101, 40, 41, 33,
+61, 48, 41, 38, 38, 37, 68, 101, 98, 117, 103, 67, 97, 108, 108, 98, 97, 99,
+107, 83, 117, 112, 112, 111, 114, 116, 115, 83, 116, 101, 112, 112, 105, 110,
+103, 40, 97, 41, 59, 10, 102, 111, 114, 40, 118, 97, 114, 32, 103, 61, 48, 59,
+103, 60, 98, 59, 103, 43, 43, 41, 123, 10, 118, 97, 114, 32, 104, 61, 116, 104,
+105, 115, 91, 103, 93, 59, 10, 105, 102, 40, 101, 41, 37, 68, 101, 98, 117, 103,
+80, 114, 101, 112, 97, 114, 101, 83, 116, 101, 112, 73, 110, 73, 102, 83, 116,
+101, 112, 112, 105, 110, 103, 40, 97, 41, 59, 10, 118, 97, 114, 32, 105, 61,
+100, 63, 84, 111, 79, 98, 106, 101, 99, 116, 40, 99, 41, 58, 99, 59, 10, 37, 95,
+67, 97, 108, 108, 70, 117, 110, 99, 116, 105, 111, 110, 40, 105, 44, 40, 40, 37,
+95, 73, 115, 83, 112, 101, 99, 79, 98, 106, 101, 99, 116, 40, 37, 73, 83, 95,
+86, 65, 82, 40, 104, 41, 41, 41, 63, 104, 58, 84, 111, 79, 98, 106, 101, 99,
+116, 40, 104, 41, 41, 44, 103, 44, 116, 104, 105, 115, 44, 97, 41, 59, 10, 125,
+10, 125, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 70, 108, 111, 97, 116,
+54, 52, 65, 114, 114, 97, 121, 79, 102, 40, 41, 123, 10, 118, 97, 114, 32, 97,
+61, 37, 95, 65, 114, 103, 117, 109, 101, 110, 116, 115, 76, 101, 110, 103, 116,
+104, 40, 41, 59, 10, 118, 97, 114, 32, 98, 61, 110, 101, 119, 32, 116, 104, 105,
+115, 40, 97, 41, 59, 10, 102, 111, 114, 40, 118, 97, 114, 32, 99, 61, 48, 59,
+99, 60, 97, 59, 99, 43, 43, 41, 123, 10, 98, 91, 99, 93, 61, 37, 95, 65, 114,
+103, 117, 109, 101, 110, 116, 115, 40, 99, 41, 59, 10, 125, 10, 114, 101, 116,
+117, 114, 110, 32, 98, 59, 10, 125, 10, 10, 102, 117, 110, 99, 116, 105, 111,
+110, 32, 85, 105, 110, 116, 56, 67, 108, 97, 109, 112, 101, 100, 65, 114, 114,
+97, 121, 70, 111, 114, 69, 97, 99, 104, 40, 97, 41, 123, 10, 105, 102, 40, 33,
+37, 73, 115, 84, 121, 112, 101, 100, 65, 114, 114, 97, 121, 40, 116, 104, 105,
+115, 41, 41, 123, 10, 116, 104, 114, 111, 119, 32, 77, 97, 107, 101, 84, 121,
+112, 101, 69, 114, 114, 111, 114, 40, 39, 110, 111, 116, 95, 116, 121, 112, 101,
+100, 95, 97, 114, 114, 97, 121, 39, 44, 91, 93, 41, 59, 10, 125, 10, 105, 102,
+40, 33, 40, 37, 95, 67, 108, 97, 115, 115, 79, 102, 40, 97, 41, 61, 61, 61, 39,
+70, 117, 110, 99, 116, 105, 111, 110, 39, 41, 41, 123, 10, 116, 104, 114, 111,
+119, 32, 77, 97, 107, 101, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 39,
+99, 97, 108, 108, 101, 100, 95, 110, 111, 110, 95, 99, 97, 108, 108, 97, 98,
+108, 101, 39, 44, 91, 97, 93, 41, 59, 10, 125, 10, 118, 97, 114, 32, 98, 61, 37,
+95, 84, 121, 112, 101, 100, 65, 114, 114, 97, 121, 71, 101, 116, 76, 101, 110,
+103, 116, 104, 40, 116, 104, 105, 115, 41, 59, 10, 118, 97, 114, 32, 99, 59, 10,
+105, 102, 40, 37, 95, 65, 114, 103, 117, 109, 101, 110, 116, 115, 76, 101, 110,
+103, 116, 104, 40, 41, 62, 49, 41, 123, 10, 99, 61, 37, 95, 65, 114, 103, 117,
+109, 101, 110, 116, 115, 40, 49, 41, 59, 10, 125, 10, 118, 97, 114, 32, 100, 61,
+102, 97, 108, 115, 101, 59, 10, 105, 102, 40, 40, 99, 61, 61, 110, 117, 108,
+108, 41, 41, 123, 10, 99, 61, 37, 71, 101, 116, 68, 101, 102, 97, 117, 108, 116,
+82, 101, 99, 101, 105, 118, 101, 114, 40, 97, 41, 124, 124, 99, 59, 10, 125,
+101, 108, 115, 101, 123, 10, 100, 61, 40, 33, 40, 37, 95, 73, 115, 83, 112, 101,
+99, 79, 98, 106, 101, 99, 116, 40, 99, 41, 41, 38, 38, 37, 73, 115, 83, 108,
+111, 112, 112, 121, 77, 111, 100, 101, 70, 117, 110, 99, 116, 105, 111, 110, 40,
+97, 41, 41, 59, 10, 125, 10, 118, 97, 114, 32, 101, 61, 40, 37, 95, 68, 101, 98,
+117, 103, 73, 115, 65, 99, 116, 105, 118, 101, 40, 41, 33, 61, 48, 41, 38, 38,
+37, 68, 101, 98, 117, 103, 67, 97, 108, 108, 98, 97, 99, 107, 83, 117, 112, 112,
+111, 114, 116, 115, 83, 116, 101, 112, 112, 105, 110, 103, 40, 97, 41, 59, 10,
+102, 111, 114, 40, 118, 97, 114, 32, 103, 61, 48, 59, 103, 60, 98, 59, 103, 43,
+43, 41, 123, 10, 118, 97, 114, 32, 104, 61, 116, 104, 105, 115, 91, 103, 93, 59,
+10, 105, 102, 40, 101, 41, 37, 68, 101, 98, 117, 103, 80, 114, 101, 112, 97,
+114, 101, 83, 116, 101, 112, 73, 110, 73, 102, 83, 116, 101, 112, 112, 105, 110,
+103, 40, 97, 41, 59, 10, 118, 97, 114, 32, 105, 61, 100, 63, 84, 111, 79, 98,
+106, 101, 99, 116, 40, 99, 41, 58, 99, 59, 10, 37, 95, 67, 97, 108, 108, 70,
+117, 110, 99, 116, 105, 111, 110, 40, 105, 44, 40, 40, 37, 95, 73, 115, 83, 112,
+101, 99, 79, 98, 106, 101, 99, 116, 40, 37, 73, 83, 95, 86, 65, 82, 40, 104, 41,
+41, 41, 63, 104, 58, 84, 111, 79, 98, 106, 101, 99, 116, 40, 104, 41, 41, 44,
+103, 44, 116, 104, 105, 115, 44, 97, 41, 59, 10, 125, 10, 125, 10, 102, 117,
+110, 99, 116, 105, 111, 110, 32, 85, 105, 110, 116, 56, 67, 108, 97, 109, 112,
+101, 100, 65, 114, 114, 97, 121, 79, 102, 40, 41, 123, 10, 118, 97, 114, 32, 97,
+61, 37, 95, 65, 114, 103, 117, 109, 101, 110, 116, 115, 76, 101, 110, 103, 116,
+104, 40, 41, 59, 10, 118, 97, 114, 32, 98, 61, 110, 101, 119, 32, 116, 104, 105,
+115, 40, 97, 41, 59, 10, 102, 111, 114, 40, 118, 97, 114, 32, 99, 61, 48, 59,
+99, 60, 97, 59, 99, 43, 43, 41, 123, 10, 98, 91, 99, 93, 61, 37, 95, 65, 114,
+103, 117, 109, 101, 110, 116, 115, 40, 99, 41, 59, 10, 125, 10, 114, 101, 116,
+117, 114, 110, 32, 98, 59, 10, 125, 10, 10, 10, 102, 117, 110, 99, 116, 105,
+111, 110, 32, 72, 97, 114, 109, 111, 110, 121, 84, 121, 112, 101, 100, 65, 114,
+114, 97, 121, 69, 120, 116, 101, 110, 100, 80, 114, 111, 116, 111, 116, 121,
+112, 101, 115, 40, 41, 123, 10, 37, 67, 104, 101, 99, 107, 73, 115, 66, 111,
+111, 116, 115, 116, 114, 97, 112, 112, 105, 110, 103, 40, 41, 59, 10, 73, 110,
+115, 116, 97, 108, 108, 70, 117, 110, 99, 116, 105, 111, 110, 115, 40, 103, 108,
+111, 98, 97, 108, 46, 85, 105, 110, 116, 56, 65, 114, 114, 97, 121, 44, 50, 124,
+52, 124, 49, 44, 36, 65, 114, 114, 97, 121, 40, 10, 34, 111, 102, 34, 44, 85,
+105, 110, 116, 56, 65, 114, 114, 97, 121, 79, 102, 10, 41, 41, 59, 10, 73, 110,
+115, 116, 97, 108, 108, 70, 117, 110, 99, 116, 105, 111, 110, 115, 40, 103, 108,
+111, 98, 97, 108, 46, 85, 105, 110, 116, 56, 65, 114, 114, 97, 121, 46, 112,
+114, 111, 116, 111, 116, 121, 112, 101, 44, 50, 44, 36, 65, 114, 114, 97, 121,
+40, 10, 34, 102, 111, 114, 69, 97, 99, 104, 34, 44, 85, 105, 110, 116, 56, 65,
+114, 114, 97, 121, 70, 111, 114, 69, 97, 99, 104, 10, 41, 41, 59, 10, 10, 37,
+67, 104, 101, 99, 107, 73, 115, 66, 111, 111, 116, 115, 116, 114, 97, 112, 112,
+105, 110, 103, 40, 41, 59, 10, 73, 110, 115, 116, 97, 108, 108, 70, 117, 110,
+99, 116, 105, 111, 110, 115, 40, 103, 108, 111, 98, 97, 108, 46, 73, 110, 116,
+56, 65, 114, 114, 97, 121, 44, 50, 124, 52, 124, 49, 44, 36, 65, 114, 114, 97,
+121, 40, 10, 34, 111, 102, 34, 44, 73, 110, 116, 56, 65, 114, 114, 97, 121, 79,
+102, 10, 41, 41, 59, 10, 73, 110, 115, 116, 97, 108, 108, 70, 117, 110, 99, 116,
+105, 111, 110, 115, 40, 103, 108, 111, 98, 97, 108, 46, 73, 110, 116, 56, 65,
+114, 114, 97, 121, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 44, 50, 44,
+36, 65, 114, 114, 97, 121, 40, 10, 34, 102, 111, 114, 69, 97, 99, 104, 34, 44,
+73, 110, 116, 56, 65, 114, 114, 97, 121, 70, 111, 114, 69, 97, 99, 104, 10, 41,
+41, 59, 10, 10, 37, 67, 104, 101, 99, 107, 73, 115, 66, 111, 111, 116, 115, 116,
+114, 97, 112, 112, 105, 110, 103, 40, 41, 59, 10, 73, 110, 115, 116, 97, 108,
+108, 70, 117, 110, 99, 116, 105, 111, 110, 115, 40, 103, 108, 111, 98, 97, 108,
+46, 85, 105, 110, 116, 49, 54, 65, 114, 114, 97, 121, 44, 50, 124, 52, 124, 49,
+44, 36, 65, 114, 114, 97, 121, 40, 10, 34, 111, 102, 34, 44, 85, 105, 110, 116,
+49, 54, 65, 114, 114, 97, 121, 79, 102, 10, 41, 41, 59, 10, 73, 110, 115, 116,
+97, 108, 108, 70, 117, 110, 99, 116, 105, 111, 110, 115, 40, 103, 108, 111, 98,
+97, 108, 46, 85, 105, 110, 116, 49, 54, 65, 114, 114, 97, 121, 46, 112, 114,
+111, 116, 111, 116, 121, 112, 101, 44, 50, 44, 36, 65, 114, 114, 97, 121, 40,
+10, 34, 102, 111, 114, 69, 97, 99, 104, 34, 44, 85, 105, 110, 116, 49, 54, 65,
+114, 114, 97, 121, 70, 111, 114, 69, 97, 99, 104, 10, 41, 41, 59, 10, 10, 37,
+67, 104, 101, 99, 107, 73, 115, 66, 111, 111, 116, 115, 116, 114, 97, 112, 112,
+105, 110, 103, 40, 41, 59, 10, 73, 110, 115, 116, 97, 108, 108, 70, 117, 110,
+99, 116, 105, 111, 110, 115, 40, 103, 108, 111, 98, 97, 108, 46, 73, 110, 116,
+49, 54, 65, 114, 114, 97, 121, 44, 50, 124, 52, 124, 49, 44, 36, 65, 114, 114,
+97, 121, 40, 10, 34, 111, 102, 34, 44, 73, 110, 116, 49, 54, 65, 114, 114, 97,
+121, 79, 102, 10, 41, 41, 59, 10, 73, 110, 115, 116, 97, 108, 108, 70, 117, 110,
+99, 116, 105, 111, 110, 115, 40, 103, 108, 111, 98, 97, 108, 46, 73, 110, 116,
+49, 54, 65, 114, 114, 97, 121, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101,
+44, 50, 44, 36, 65, 114, 114, 97, 121, 40, 10, 34, 102, 111, 114, 69, 97, 99,
+104, 34, 44, 73, 110, 116, 49, 54, 65, 114, 114, 97, 121, 70, 111, 114, 69, 97,
+99, 104, 10, 41, 41, 59, 10, 10, 37, 67, 104, 101, 99, 107, 73, 115, 66, 111,
+111, 116, 115, 116, 114, 97, 112, 112, 105, 110, 103, 40, 41, 59, 10, 73, 110,
+115, 116, 97, 108, 108, 70, 117, 110, 99, 116, 105, 111, 110, 115, 40, 103, 108,
+111, 98, 97, 108, 46, 85, 105, 110, 116, 51, 50, 65, 114, 114, 97, 121, 44, 50,
+124, 52, 124, 49, 44, 36, 65, 114, 114, 97, 121, 40, 10, 34, 111, 102, 34, 44,
+85, 105, 110, 116, 51, 50, 65, 114, 114, 97, 121, 79, 102, 10, 41, 41, 59, 10,
+73, 110, 115, 116, 97, 108, 108, 70, 117, 110, 99, 116, 105, 111, 110, 115, 40,
+103, 108, 111, 98, 97, 108, 46, 85, 105, 110, 116, 51, 50, 65, 114, 114, 97,
+121, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 44, 50, 44, 36, 65, 114,
+114, 97, 121, 40, 10, 34, 102, 111, 114, 69, 97, 99, 104, 34, 44, 85, 105, 110,
+116, 51, 50, 65, 114, 114, 97, 121, 70, 111, 114, 69, 97, 99, 104, 10, 41, 41,
+59, 10, 10, 37, 67, 104, 101, 99, 107, 73, 115, 66, 111, 111, 116, 115, 116,
+114, 97, 112, 112, 105, 110, 103, 40, 41, 59, 10, 73, 110, 115, 116, 97, 108,
+108, 70, 117, 110, 99, 116, 105, 111, 110, 115, 40, 103, 108, 111, 98, 97, 108,
+46, 73, 110, 116, 51, 50, 65, 114, 114, 97, 121, 44, 50, 124, 52, 124, 49, 44,
+36, 65, 114, 114, 97, 121, 40, 10, 34, 111, 102, 34, 44, 73, 110, 116, 51, 50,
+65, 114, 114, 97, 121, 79, 102, 10, 41, 41, 59, 10, 73, 110, 115, 116, 97, 108,
+108, 70, 117, 110, 99, 116, 105, 111, 110, 115, 40, 103, 108, 111, 98, 97, 108,
+46, 73, 110, 116, 51, 50, 65, 114, 114, 97, 121, 46, 112, 114, 111, 116, 111,
+116, 121, 112, 101, 44, 50, 44, 36, 65, 114, 114, 97, 121, 40, 10, 34, 102, 111,
+114, 69, 97, 99, 104, 34, 44, 73, 110, 116, 51, 50, 65, 114, 114, 97, 121, 70,
+111, 114, 69, 97, 99, 104, 10, 41, 41, 59, 10, 10, 37, 67, 104, 101, 99, 107,
+73, 115, 66, 111, 111, 116, 115, 116, 114, 97, 112, 112, 105, 110, 103, 40, 41,
+59, 10, 73, 110, 115, 116, 97, 108, 108, 70, 117, 110, 99, 116, 105, 111, 110,
+115, 40, 103, 108, 111, 98, 97, 108, 46, 70, 108, 111, 97, 116, 51, 50, 65, 114,
+114, 97, 121, 44, 50, 124, 52, 124, 49, 44, 36, 65, 114, 114, 97, 121, 40, 10,
+34, 111, 102, 34, 44, 70, 108, 111, 97, 116, 51, 50, 65, 114, 114, 97, 121, 79,
+102, 10, 41, 41, 59, 10, 73, 110, 115, 116, 97, 108, 108, 70, 117, 110, 99, 116,
+105, 111, 110, 115, 40, 103, 108, 111, 98, 97, 108, 46, 70, 108, 111, 97, 116,
+51, 50, 65, 114, 114, 97, 121, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101,
+44, 50, 44, 36, 65, 114, 114, 97, 121, 40, 10, 34, 102, 111, 114, 69, 97, 99,
+104, 34, 44, 70, 108, 111, 97, 116, 51, 50, 65, 114, 114, 97, 121, 70, 111, 114,
+69, 97, 99, 104, 10, 41, 41, 59, 10, 10, 37, 67, 104, 101, 99, 107, 73, 115, 66,
+111, 111, 116, 115, 116, 114, 97, 112, 112, 105, 110, 103, 40, 41, 59, 10, 73,
+110, 115, 116, 97, 108, 108, 70, 117, 110, 99, 116, 105, 111, 110, 115, 40, 103,
+108, 111, 98, 97, 108, 46, 70, 108, 111, 97, 116, 54, 52, 65, 114, 114, 97, 121,
+44, 50, 124, 52, 124, 49, 44, 36, 65, 114, 114, 97, 121, 40, 10, 34, 111, 102,
+34, 44, 70, 108, 111, 97, 116, 54, 52, 65, 114, 114, 97, 121, 79, 102, 10, 41,
+41, 59, 10, 73, 110, 115, 116, 97, 108, 108, 70, 117, 110, 99, 116, 105, 111,
+110, 115, 40, 103, 108, 111, 98, 97, 108, 46, 70, 108, 111, 97, 116, 54, 52, 65,
+114, 114, 97, 121, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 44, 50, 44,
+36, 65, 114, 114, 97, 121, 40, 10, 34, 102, 111, 114, 69, 97, 99, 104, 34, 44,
+70, 108, 111, 97, 116, 54, 52, 65, 114, 114, 97, 121, 70, 111, 114, 69, 97, 99,
+104, 10, 41, 41, 59, 10, 10, 37, 67, 104, 101, 99, 107, 73, 115, 66, 111, 111,
+116, 115, 116, 114, 97, 112, 112, 105, 110, 103, 40, 41, 59, 10, 73, 110, 115,
+116, 97, 108, 108, 70, 117, 110, 99, 116, 105, 111, 110, 115, 40, 103, 108, 111,
+98, 97, 108, 46, 85, 105, 110, 116, 56, 67, 108, 97, 109, 112, 101, 100, 65,
+114, 114, 97, 121, 44, 50, 124, 52, 124, 49, 44, 36, 65, 114, 114, 97, 121, 40,
+10, 34, 111, 102, 34, 44, 85, 105, 110, 116, 56, 67, 108, 97, 109, 112, 101,
+100, 65, 114, 114, 97, 121, 79, 102, 10, 41, 41, 59, 10, 73, 110, 115, 116, 97,
+108, 108, 70, 117, 110, 99, 116, 105, 111, 110, 115, 40, 103, 108, 111, 98, 97,
+108, 46, 85, 105, 110, 116, 56, 67, 108, 97, 109, 112, 101, 100, 65, 114, 114,
+97, 121, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 44, 50, 44, 36, 65,
+114, 114, 97, 121, 40, 10, 34, 102, 111, 114, 69, 97, 99, 104, 34, 44, 85, 105,
+110, 116, 56, 67, 108, 97, 109, 112, 101, 100, 65, 114, 114, 97, 121, 70, 111,
+114, 69, 97, 99, 104, 10, 41, 41, 59, 10, 10, 10, 125, 10, 72, 97, 114, 109,
+111, 110, 121, 84, 121, 112, 101, 100, 65, 114, 114, 97, 121, 69, 120, 116, 101,
+110, 100, 80, 114, 111, 116, 111, 116, 121, 112, 101, 115, 40, 41, 59, 10, 10,
+10, 34, 117, 115, 101, 32, 115, 116, 114, 105, 99, 116, 34, 59, 10, 118, 97,
+114, 32, 99, 97, 108, 108, 83, 105, 116, 101, 67, 97, 99, 104, 101, 61, 110,
+101, 119, 32, 36, 77, 97, 112, 59, 10, 102, 117, 110, 99, 116, 105, 111, 110,
+32, 83, 97, 109, 101, 67, 97, 108, 108, 83, 105, 116, 101, 69, 108, 101, 109,
+101, 110, 116, 115, 40, 97, 44, 98, 41, 123, 10, 118, 97, 114, 32, 99, 61, 97,
+46, 108, 101, 110, 103, 116, 104, 59, 10, 118, 97, 114, 32, 98, 61, 98, 46, 114,
+97, 119, 59, 10, 105, 102, 40, 99, 33, 61, 61, 98, 46, 108, 101, 110, 103, 116,
+104, 41, 114, 101, 116, 117, 114, 110, 32, 102, 97, 108, 115, 101, 59, 10, 102,
+111, 114, 40, 118, 97, 114, 32, 100, 61, 48, 59, 100, 60, 99, 59, 43, 43, 100,
+41, 123, 10, 105, 102, 40, 97, 91, 100, 93, 33, 61, 61, 98, 91, 100, 93, 41,
+114, 101, 116, 117, 114, 110, 32, 102, 97, 108, 115, 101, 59, 10, 125, 10, 114,
+101, 116, 117, 114, 110, 32, 116, 114, 117, 101, 59, 10, 125, 10, 102, 117, 110,
+99, 116, 105, 111, 110, 32, 71, 101, 116, 67, 97, 99, 104, 101, 100, 67, 97,
+108, 108, 83, 105, 116, 101, 40, 97, 44, 98, 41, 123, 10, 118, 97, 114, 32, 99,
+61, 37, 77, 97, 112, 71, 101, 116, 40, 99, 97, 108, 108, 83, 105, 116, 101, 67,
+97, 99, 104, 101, 44, 98, 41, 59, 10, 105, 102, 40, 40, 99, 61, 61, 61, 40, 118,
+111, 105, 100, 32, 48, 41, 41, 41, 114, 101, 116, 117, 114, 110, 59, 10, 118,
+97, 114, 32, 100, 61, 99, 46, 108, 101, 110, 103, 116, 104, 59, 10, 102, 111,
+114, 40, 118, 97, 114, 32, 101, 61, 48, 59, 101, 60, 100, 59, 43, 43, 101, 41,
+123, 10, 105, 102, 40, 83, 97, 109, 101, 67, 97, 108, 108, 83, 105, 116, 101,
+69, 108, 101, 109, 101, 110, 116, 115, 40, 97, 44, 99, 91, 101, 93, 41, 41, 114,
+101, 116, 117, 114, 110, 32, 99, 91, 101, 93, 59, 10, 125, 10, 125, 10, 102,
+117, 110, 99, 116, 105, 111, 110, 32, 83, 101, 116, 67, 97, 99, 104, 101, 100,
+67, 97, 108, 108, 83, 105, 116, 101, 40, 97, 44, 98, 41, 123, 10, 118, 97, 114,
+32, 99, 61, 37, 77, 97, 112, 71, 101, 116, 40, 99, 97, 108, 108, 83, 105, 116,
+101, 67, 97, 99, 104, 101, 44, 98, 41, 59, 10, 118, 97, 114, 32, 100, 59, 10,
+105, 102, 40, 40, 99, 61, 61, 61, 40, 118, 111, 105, 100, 32, 48, 41, 41, 41,
+123, 10, 100, 61, 110, 101, 119, 32, 73, 110, 116, 101, 114, 110, 97, 108, 65,
+114, 114, 97, 121, 40, 49, 41, 59, 10, 100, 91, 48, 93, 61, 97, 59, 10, 37, 77,
+97, 112, 83, 101, 116, 40, 99, 97, 108, 108, 83, 105, 116, 101, 67, 97, 99, 104,
+101, 44, 98, 44, 100, 41, 59, 10, 125, 101, 108, 115, 101, 123, 10, 99, 46, 112,
+117, 115, 104, 40, 97, 41, 59, 10, 125, 10, 114, 101, 116, 117, 114, 110, 32,
+97, 59, 10, 125, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 71, 101, 116,
+84, 101, 109, 112, 108, 97, 116, 101, 67, 97, 108, 108, 83, 105, 116, 101, 40,
+97, 44, 98, 44, 99, 41, 123, 10, 118, 97, 114, 32, 100, 61, 71, 101, 116, 67,
+97, 99, 104, 101, 100, 67, 97, 108, 108, 83, 105, 116, 101, 40, 98, 44, 99, 41,
+59, 10, 105, 102, 40, 33, 40, 100, 61, 61, 61, 40, 118, 111, 105, 100, 32, 48,
+41, 41, 41, 114, 101, 116, 117, 114, 110, 32, 100, 59, 10, 37, 65, 100, 100, 78,
+97, 109, 101, 100, 80, 114, 111, 112, 101, 114, 116, 121, 40, 97, 44, 34, 114,
+97, 119, 34, 44, 37, 79, 98, 106, 101, 99, 116, 70, 114, 101, 101, 122, 101, 40,
+98, 41, 44, 10, 49, 124, 50, 124, 52, 41, 59, 10, 114, 101, 116, 117, 114, 110,
+32, 83, 101, 116, 67, 97, 99, 104, 101, 100, 67, 97, 108, 108, 83, 105, 116,
+101, 40, 37, 79, 98, 106, 101, 99, 116, 70, 114, 101, 101, 122, 101, 40, 97, 41,
+44, 99, 41, 59, 10, 125, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 83, 116,
+114, 105, 110, 103, 82, 97, 119, 40, 97, 41, 123, 10, 118, 97, 114, 32, 98, 61,
+37, 95, 65, 114, 103, 117, 109, 101, 110, 116, 115, 76, 101, 110, 103, 116, 104,
+40, 41, 59, 10, 118, 97, 114, 32, 99, 61, 84, 111, 79, 98, 106, 101, 99, 116,
+40, 97, 41, 59, 10, 118, 97, 114, 32, 100, 61, 84, 111, 79, 98, 106, 101, 99,
+116, 40, 99, 46, 114, 97, 119, 41, 59, 10, 118, 97, 114, 32, 101, 61, 84, 111,
+76, 101, 110, 103, 116, 104, 40, 100, 46, 108, 101, 110, 103, 116, 104, 41, 59,
+10, 105, 102, 40, 101, 60, 61, 48, 41, 114, 101, 116, 117, 114, 110, 34, 34, 59,
+10, 118, 97, 114, 32, 103, 61, 84, 111, 83, 116, 114, 105, 110, 103, 40, 100,
+91, 48, 93, 41, 59, 10, 102, 111, 114, 40, 118, 97, 114, 32, 104, 61, 49, 59,
+104, 60, 101, 59, 43, 43, 104, 41, 123, 10, 105, 102, 40, 104, 60, 98, 41, 123,
+10, 103, 43, 61, 84, 111, 83, 116, 114, 105, 110, 103, 40, 37, 95, 65, 114, 103,
+117, 109, 101, 110, 116, 115, 40, 104, 41, 41, 59, 10, 125, 10, 103, 43, 61, 84,
+111, 83, 116, 114, 105, 110, 103, 40, 100, 91, 104, 93, 41, 59, 10, 125, 10,
+114, 101, 116, 117, 114, 110, 32, 103, 59, 10, 125, 10, 102, 117, 110, 99, 116,
+105, 111, 110, 32, 69, 120, 116, 101, 110, 100, 83, 116, 114, 105, 110, 103, 70,
+111, 114, 84, 101, 109, 112, 108, 97, 116, 101, 115, 40, 41, 123, 10, 37, 67,
+104, 101, 99, 107, 73, 115, 66, 111, 111, 116, 115, 116, 114, 97, 112, 112, 105,
+110, 103, 40, 41, 59, 10, 73, 110, 115, 116, 97, 108, 108, 70, 117, 110, 99,
+116, 105, 111, 110, 115, 40, 36, 83, 116, 114, 105, 110, 103, 44, 50, 44, 36,
+65, 114, 114, 97, 121, 40, 10, 34, 114, 97, 119, 34, 44, 83, 116, 114, 105, 110,
+103, 82, 97, 119, 10, 41, 41, 59, 10, 125, 10, 69, 120, 116, 101, 110, 100, 83,
+116, 114, 105, 110, 103, 70, 111, 114, 84, 101, 109, 112, 108, 97, 116, 101,
+115, 40, 41, 59, 10, 10, 10, 39, 117, 115, 101, 32, 115, 116, 114, 105, 99, 116,
+39, 59, 10, 118, 97, 114, 32, 36, 82, 101, 103, 69, 120, 112, 61, 103, 108, 111,
+98, 97, 108, 46, 82, 101, 103, 69, 120, 112, 59, 10, 102, 117, 110, 99, 116,
+105, 111, 110, 32, 82, 101, 103, 69, 120, 112, 71, 101, 116, 70, 108, 97, 103,
+115, 40, 41, 123, 10, 105, 102, 40, 33, 40, 37, 95, 73, 115, 83, 112, 101, 99,
+79, 98, 106, 101, 99, 116, 40, 116, 104, 105, 115, 41, 41, 41, 123, 10, 116,
+104, 114, 111, 119, 32, 77, 97, 107, 101, 84, 121, 112, 101, 69, 114, 114, 111,
+114, 40, 39, 102, 108, 97, 103, 115, 95, 103, 101, 116, 116, 101, 114, 95, 110,
+111, 110, 95, 111, 98, 106, 101, 99, 116, 39, 44, 10, 91, 37, 84, 111, 83, 116,
+114, 105, 110, 103, 40, 116, 104, 105, 115, 41, 93, 41, 59, 10, 125, 10, 118,
+97, 114, 32, 97, 61, 39, 39, 59, 10, 105, 102, 40, 116, 104, 105, 115, 46, 103,
+108, 111, 98, 97, 108, 41, 97, 43, 61, 39, 103, 39, 59, 10, 105, 102, 40, 116,
+104, 105, 115, 46, 105, 103, 110, 111, 114, 101, 67, 97, 115, 101, 41, 97, 43,
+61, 39, 105, 39, 59, 10, 105, 102, 40, 116, 104, 105, 115, 46, 109, 117, 108,
+116, 105, 108, 105, 110, 101, 41, 97, 43, 61, 39, 109, 39, 59, 10, 105, 102, 40,
+116, 104, 105, 115, 46, 117, 110, 105, 99, 111, 100, 101, 41, 97, 43, 61, 39,
+117, 39, 59, 10, 105, 102, 40, 116, 104, 105, 115, 46, 115, 116, 105, 99, 107,
+121, 41, 97, 43, 61, 39, 121, 39, 59, 10, 114, 101, 116, 117, 114, 110, 32, 97,
+59, 10, 125, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 69, 120, 116, 101,
+110, 100, 82, 101, 103, 69, 120, 112, 80, 114, 111, 116, 111, 116, 121, 112,
+101, 40, 41, 123, 10, 37, 67, 104, 101, 99, 107, 73, 115, 66, 111, 111, 116,
+115, 116, 114, 97, 112, 112, 105, 110, 103, 40, 41, 59, 10, 37, 68, 101, 102,
+105, 110, 101, 65, 99, 99, 101, 115, 115, 111, 114, 80, 114, 111, 112, 101, 114,
+116, 121, 85, 110, 99, 104, 101, 99, 107, 101, 100, 40, 36, 82, 101, 103, 69,
+120, 112, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 44, 39, 102, 108, 97,
+103, 115, 39, 44, 82, 101, 103, 69, 120, 112, 71, 101, 116, 70, 108, 97, 103,
+115, 44, 10, 110, 117, 108, 108, 44, 50, 41, 59, 10, 37, 83, 101, 116, 78, 97,
+116, 105, 118, 101, 70, 108, 97, 103, 40, 82, 101, 103, 69, 120, 112, 71, 101,
+116, 70, 108, 97, 103, 115, 41, 59, 10, 125, 10, 69, 120, 116, 101, 110, 100,
+82, 101, 103, 69, 120, 112, 80, 114, 111, 116, 111, 116, 121, 112, 101, 40, 41,
+59, 10, 10 };
+
+  template <>
+  int NativesCollection<EXPERIMENTAL>::GetBuiltinsCount() {
+    return 9;
+  }
+
+  template <>
+  int NativesCollection<EXPERIMENTAL>::GetDebuggerCount() {
+    return 0;
+  }
+
+  template <>
+  int NativesCollection<EXPERIMENTAL>::GetIndex(const char* name) {
+    if (strcmp(name, "proxy") == 0) return 0;
+    if (strcmp(name, "generator") == 0) return 1;
+    if (strcmp(name, "harmony-string") == 0) return 2;
+    if (strcmp(name, "harmony-array") == 0) return 3;
+    if (strcmp(name, "harmony-array-includes") == 0) return 4;
+    if (strcmp(name, "harmony-tostring") == 0) return 5;
+    if (strcmp(name, "harmony-typedarray") == 0) return 6;
+    if (strcmp(name, "harmony-templates") == 0) return 7;
+    if (strcmp(name, "harmony-regexp") == 0) return 8;
+    return -1;
+  }
+
+  template <>
+  Vector<const char> NativesCollection<EXPERIMENTAL>::GetScriptSource(int index) {
+    if (index == 0) return Vector<const char>(sources + 0, 3208);
+    if (index == 1) return Vector<const char>(sources + 3208, 2136);
+    if (index == 2) return Vector<const char>(sources + 5344, 3574);
+    if (index == 3) return Vector<const char>(sources + 8918, 3449);
+    if (index == 4) return Vector<const char>(sources + 12367, 514);
+    if (index == 5) return Vector<const char>(sources + 12881, 946);
+    if (index == 6) return Vector<const char>(sources + 13827, 8698);
+    if (index == 7) return Vector<const char>(sources + 22525, 1165);
+    if (index == 8) return Vector<const char>(sources + 23690, 515);
+    return Vector<const char>("", 0);
+  }
+
+  template <>
+  Vector<const char> NativesCollection<EXPERIMENTAL>::GetScriptName(int index) {
+    if (index == 0) return Vector<const char>("native proxy.js", 15);
+    if (index == 1) return Vector<const char>("native generator.js", 19);
+    if (index == 2) return Vector<const char>("native harmony-string.js", 24);
+    if (index == 3) return Vector<const char>("native harmony-array.js", 23);
+    if (index == 4) return Vector<const char>("native harmony-array-includes.js", 32);
+    if (index == 5) return Vector<const char>("native harmony-tostring.js", 26);
+    if (index == 6) return Vector<const char>("native harmony-typedarray.js", 28);
+    if (index == 7) return Vector<const char>("native harmony-templates.js", 27);
+    if (index == 8) return Vector<const char>("native harmony-regexp.js", 24);
+    return Vector<const char>("", 0);
+  }
+
+  template <>
+  Vector<const char> NativesCollection<EXPERIMENTAL>::GetScriptsSource() {
+    return Vector<const char>(sources, 24205);
+  }
+}  // internal
+}  // v8
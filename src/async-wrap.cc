@@ -152,7 +152,7 @@ Handle<Value> AsyncWrap::MakeCallback(const Handle<Function> cb,
 
   Environment::TickInfo* tick_info = env()->tick_info();
 
-  if (tick_info->in_tick()) {
+  if (tick_info->in_tick() || env()->in_callback_batch()) {
     return ret;
   }
 
@@ -25,6 +25,7 @@ namespace node {
   V(SHUTDOWNWRAP)                                                             \
   V(SIGNALWRAP)                                                               \
   V(STATWATCHER)                                                              \
+  V(STREAMPIPE)                                                               \
   V(TCPWRAP)                                                                  \
   V(TIMERWRAP)                                                                \
   V(TLSWRAP)                                                                  \
@@ -10,6 +10,7 @@
 
 #include <stddef.h>
 #include <stdint.h>
+#include <stdlib.h>
 
 namespace node {
 
@@ -44,7 +45,25 @@ inline Environment::IsolateData::IsolateData(v8::Isolate* isolate,
     PropertyName ## _(isolate, FIXED_ONE_BYTE_STRING(isolate, StringValue)),
     PER_ISOLATE_STRING_PROPERTIES(V)
 #undef V
-    ref_count_(0) {}
+    ref_count_(0) {
+  int index = 0;
+#define V(PropertyName, Name, LowercaseName)                                  \
+  http_header_names_[index++].Set(                                            \
+      isolate,                                                                \
+      v8::String::NewFromOneByte(isolate,                                     \
+                                 reinterpret_cast<const uint8_t*>(Name),      \
+                                 v8::String::kInternalizedString,             \
+                                 sizeof(Name) - 1));                          \
+  http_header_names_[index++].Set(                                            \
+      isolate,                                                                \
+      v8::String::NewFromOneByte(                                             \
+          isolate,                                                            \
+          reinterpret_cast<const uint8_t*>(LowercaseName),                    \
+          v8::String::kInternalizedString,                                    \
+          sizeof(LowercaseName) - 1));
+  PER_ISOLATE_HTTP_HEADER_NAMES(V)
+#undef V
+}
 
 inline uv_loop_t* Environment::IsolateData::event_loop() const {
   return event_loop_;
@@ -131,6 +150,149 @@ inline void Environment::TickInfo::set_last_threw(bool value) {
   last_threw_ = value;
 }
 
+inline Environment::ReadBufferPool::ReadBufferPool() : pooled_(0) {
+  for (int i = 0; i < kFieldsCount; ++i)
+    fields_[i] = 0;
+}
+
+inline Environment::ReadBufferPool::~ReadBufferPool() {
+  while (pooled_ > 0)
+    free(pool_[--pooled_]);
+}
+
+inline double* Environment::ReadBufferPool::fields() {
+  return fields_;
+}
+
+inline int Environment::ReadBufferPool::fields_count() const {
+  return kFieldsCount;
+}
+
+inline char* Environment::ReadBufferPool::Acquire(size_t size) {
+  if (size == kBufferSize && pooled_ > 0) {
+    fields_[kHits] += 1;
+    fields_[kPooled] = --pooled_;
+    return pool_[pooled_];
+  }
+  fields_[kMisses] += 1;
+  return static_cast<char*>(malloc(size));
+}
+
+inline void Environment::ReadBufferPool::Release(char* data, size_t size) {
+  if (size == kBufferSize && pooled_ < kMaxPooled) {
+    pool_[pooled_] = data;
+    fields_[kPooled] = ++pooled_;
+    return;
+  }
+  free(data);
+}
+
+inline void Environment::ReadBufferPool::CountCopy() {
+  fields_[kCopies] += 1;
+}
+
+inline void Environment::ReadBufferPool::CountHandOff() {
+  fields_[kHandOffs] += 1;
+}
+
+inline Environment::BIOBufferPool::BIOBufferPool() : pooled_(0) {
+  for (int i = 0; i < kFieldsCount; ++i)
+    fields_[i] = 0;
+  for (int i = 0; i < kMaxSizes; ++i) {
+    lists_[i].size = 0;
+    lists_[i].head = nullptr;
+  }
+}
+
+inline Environment::BIOBufferPool::~BIOBufferPool() {
+  for (int i = 0; i < kMaxSizes; ++i) {
+    while (char* data = lists_[i].head) {
+      lists_[i].head = *reinterpret_cast<char**>(data);
+      free(data);
+    }
+  }
+}
+
+inline double* Environment::BIOBufferPool::fields() {
+  return fields_;
+}
+
+inline int Environment::BIOBufferPool::fields_count() const {
+  return kFieldsCount;
+}
+
+inline char* Environment::BIOBufferPool::Acquire(size_t size) {
+  fields_[kInUse] += size;
+  for (int i = 0; i < kMaxSizes; ++i) {
+    FreeList* list = &lists_[i];
+    if (list->size != size || list->head == nullptr)
+      continue;
+    char* data = list->head;
+    list->head = *reinterpret_cast<char**>(data);
+    pooled_ -= size;
+    fields_[kPooled] = pooled_;
+    fields_[kHits] += 1;
+    return data;
+  }
+  fields_[kMisses] += 1;
+  return static_cast<char*>(malloc(size));
+}
+
+inline void Environment::BIOBufferPool::Release(char* data, size_t size) {
+  fields_[kInUse] -= size;
+  if (pooled_ + size <= kMaxPooledBytes) {
+    // Use the list for this size, or claim one that has none yet
+    for (int i = 0; i < kMaxSizes; ++i) {
+      FreeList* list = &lists_[i];
+      if (list->size != size && list->size != 0)
+        continue;
+      list->size = size;
+      *reinterpret_cast<char**>(data) = list->head;
+      list->head = data;
+      pooled_ += size;
+      fields_[kPooled] = pooled_;
+      return;
+    }
+  }
+  free(data);
+}
+
+// For buffers that were allocated or freed without going through the pool,
+// see NodeBIO::DeferAccounting().
+inline void Environment::BIOBufferPool::CountInUse(int64_t change) {
+  fields_[kInUse] += change;
+}
+
+inline void Environment::BIOBufferPool::CountIdleRelease() {
+  fields_[kIdleReleases] += 1;
+}
+
+inline Environment::WriteCoalescing::WriteCoalescing() {
+  for (int i = 0; i < kFieldsCount; ++i)
+    fields_[i] = 0;
+}
+
+inline double* Environment::WriteCoalescing::fields() {
+  return fields_;
+}
+
+inline int Environment::WriteCoalescing::fields_count() const {
+  return kFieldsCount;
+}
+
+inline void Environment::WriteCoalescing::CountWrite(size_t bytes) {
+  fields_[kWrites] += 1;
+  fields_[kBytes] += bytes;
+}
+
+// A flush costs one syscall for what would otherwise have been one syscall
+// per coalesced write.
+inline void Environment::WriteCoalescing::CountFlush(size_t writes) {
+  fields_[kFlushes] += 1;
+  if (writes > 1)
+    fields_[kSyscallsSaved] += writes - 1;
+}
+
 inline Environment* Environment::New(v8::Local<v8::Context> context,
                                      uv_loop_t* loop) {
   Environment* env = new Environment(context, loop);
@@ -177,6 +339,7 @@ inline Environment::Environment(v8::Local<v8::Context> context,
       using_asyncwrap_(false),
       printed_error_(false),
       trace_sync_io_(false),
+      in_callback_batch_(false),
       debugger_agent_(this),
       context_(context->GetIsolate(), context) {
   // We'll be creating new objects so make sure we've entered the context.
@@ -192,6 +355,8 @@ inline Environment::Environment(v8::Local<v8::Context> context,
 inline Environment::~Environment() {
   v8::HandleScope handle_scope(isolate());
 
+  uv_loop_set_work_batch_cb(event_loop(), nullptr, nullptr, nullptr);
+
   context()->SetAlignedPointerInEmbedderData(kContextEmbedderDataIndex,
                                              nullptr);
 #define V(PropertyName, TypeName) PropertyName ## _.Reset();
@@ -286,6 +451,22 @@ inline Environment::TickInfo* Environment::tick_info() {
   return &tick_info_;
 }
 
+inline Environment::ReadBufferPool* Environment::read_buffer_pool() {
+  return &read_buffer_pool_;
+}
+
+inline Environment::BIOBufferPool* Environment::bio_buffer_pool() {
+  return &bio_buffer_pool_;
+}
+
+inline Environment::WriteCoalescing* Environment::write_coalescing() {
+  return &write_coalescing_;
+}
+
+inline double* Environment::fs_stats_field_array() {
+  return fs_stats_field_array_;
+}
+
 inline bool Environment::using_smalloc_alloc_cb() const {
   return using_smalloc_alloc_cb_;
 }
@@ -326,6 +507,14 @@ inline void Environment::set_printed_error(bool value) {
   printed_error_ = value;
 }
 
+inline bool Environment::in_callback_batch() const {
+  return in_callback_batch_;
+}
+
+inline void Environment::set_in_callback_batch(bool value) {
+  in_callback_batch_ = value;
+}
+
 inline void Environment::set_trace_sync_io(bool value) {
   trace_sync_io_ = value;
 }
@@ -461,6 +650,18 @@ inline void Environment::SetTemplateMethod(v8::Local<v8::FunctionTemplate> that,
   PER_ISOLATE_STRING_PROPERTIES(V)
 #undef V
 
+inline v8::Local<v8::String>
+Environment::IsolateData::http_header_name(int index) const {
+  CHECK_GE(index, 0);
+  CHECK_LT(index, 2 * kHttpHeaderNamesCount);
+  return const_cast<IsolateData*>(this)->http_header_names_[index].Get(
+      isolate());
+}
+
+inline v8::Local<v8::String> Environment::http_header_name(int index) const {
+  return isolate_data()->http_header_name(index);
+}
+
 #define V(PropertyName, TypeName)                                             \
   inline v8::Local<TypeName> Environment::PropertyName() const {              \
     return StrongPersistentToLocal(PropertyName ## _);                        \
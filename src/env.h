@@ -87,6 +87,7 @@ namespace node {
   V(exponent_string, "exponent")                                              \
   V(exports_string, "exports")                                                \
   V(ext_key_usage_string, "ext_key_usage")                                    \
+  V(external_stream_string, "_externalStream")                                \
   V(family_string, "family")                                                  \
   V(fatal_exception_string, "_fatalException")                                \
   V(fd_string, "fd")                                                          \
@@ -124,6 +125,7 @@ namespace node {
   V(modulus_string, "modulus")                                                \
   V(mtime_string, "mtime")                                                    \
   V(name_string, "name")                                                      \
+  V(names_string, "names")                                                    \
   V(need_imm_cb_string, "_needImmediateCallback")                             \
   V(netmask_string, "netmask")                                                \
   V(nice_string, "nice")                                                      \
@@ -191,6 +193,7 @@ namespace node {
   V(speed_string, "speed")                                                    \
   V(stack_string, "stack")                                                    \
   V(status_string, "status")                                                  \
+  V(stats_string, "stats")                                                    \
   V(stdio_string, "stdio")                                                    \
   V(subject_string, "subject")                                                \
   V(subjectaltname_string, "subjectaltname")                                  \
@@ -208,6 +211,7 @@ namespace node {
   V(tls_string, "tls")                                                        \
   V(tls_ticket_string, "tlsTicket")                                           \
   V(type_string, "type")                                                      \
+  V(types_string, "types")                                                    \
   V(uid_string, "uid")                                                        \
   V(unknown_string, "<unknown>")                                              \
   V(user_string, "user")                                                      \
@@ -224,6 +228,45 @@ namespace node {
   V(x_forwarded_string, "x-forwarded-for")                                    \
   V(zero_return_string, "ZERO_RETURN")                                        \
 
+// Header names that the HTTP parser hands to JS land as interned strings
+// rather than allocating a new string for every request. Both the usual
+// spelling and the lowercase spelling are interned, other spellings are
+// allocated as before so that req.rawHeaders stays faithful to the wire.
+#define PER_ISOLATE_HTTP_HEADER_NAMES(V)                                      \
+  V(accept, "Accept", "accept")                                               \
+  V(accept_charset, "Accept-Charset", "accept-charset")                       \
+  V(accept_encoding, "Accept-Encoding", "accept-encoding")                    \
+  V(accept_language, "Accept-Language", "accept-language")                    \
+  V(authorization, "Authorization", "authorization")                          \
+  V(cache_control, "Cache-Control", "cache-control")                          \
+  V(connection, "Connection", "connection")                                   \
+  V(content_encoding, "Content-Encoding", "content-encoding")                 \
+  V(content_length, "Content-Length", "content-length")                       \
+  V(content_type, "Content-Type", "content-type")                             \
+  V(cookie, "Cookie", "cookie")                                               \
+  V(date, "Date", "date")                                                     \
+  V(etag, "ETag", "etag")                                                     \
+  V(expect, "Expect", "expect")                                               \
+  V(host, "Host", "host")                                                     \
+  V(if_modified_since, "If-Modified-Since", "if-modified-since")              \
+  V(if_none_match, "If-None-Match", "if-none-match")                          \
+  V(keep_alive, "Keep-Alive", "keep-alive")                                   \
+  V(last_modified, "Last-Modified", "last-modified")                          \
+  V(location, "Location", "location")                                         \
+  V(origin, "Origin", "origin")                                               \
+  V(pragma, "Pragma", "pragma")                                               \
+  V(range, "Range", "range")                                                  \
+  V(referer, "Referer", "referer")                                            \
+  V(server, "Server", "server")                                               \
+  V(set_cookie, "Set-Cookie", "set-cookie")                                   \
+  V(transfer_encoding, "Transfer-Encoding", "transfer-encoding")              \
+  V(upgrade, "Upgrade", "upgrade")                                            \
+  V(user_agent, "User-Agent", "user-agent")                                   \
+  V(vary, "Vary", "vary")                                                     \
+  V(x_forwarded_for, "X-Forwarded-For", "x-forwarded-for")                    \
+  V(x_forwarded_proto, "X-Forwarded-Proto", "x-forwarded-proto")              \
+  V(x_requested_with, "X-Requested-With", "x-requested-with")                 \
+
 #define ENVIRONMENT_STRONG_PERSISTENT_PROPERTIES(V)                           \
   V(as_external, v8::External)                                                \
   V(async_hooks_init_function, v8::Function)                                  \
@@ -242,6 +285,7 @@ namespace node {
   V(script_context_constructor_template, v8::FunctionTemplate)                \
   V(script_data_constructor_function, v8::Function)                           \
   V(secure_context_constructor_template, v8::FunctionTemplate)                \
+  V(session_cache_constructor_template, v8::FunctionTemplate)                 \
   V(tcp_constructor_template, v8::FunctionTemplate)                           \
   V(tick_callback_function, v8::Function)                                     \
   V(tls_wrap_constructor_function, v8::Function)                              \
@@ -336,6 +380,115 @@ class Environment {
     DISALLOW_COPY_AND_ASSIGN(TickInfo);
   };
 
+  // Recycles the 64 KB buffers that StreamWrap hands to uv_read_start().
+  // A read that comes back small is copied out and its buffer returned to
+  // the pool so the next socket can reuse it; a large read keeps its buffer,
+  // which is then handed off to JS without a copy.
+  class ReadBufferPool {
+   public:
+    inline double* fields();
+    inline int fields_count() const;
+    inline char* Acquire(size_t size);
+    inline void Release(char* data, size_t size);
+    inline void CountCopy();
+    inline void CountHandOff();
+
+    static const size_t kBufferSize = 64 * 1024;
+    static const size_t kCopyThreshold = 16 * 1024;
+
+   private:
+    friend class Environment;  // So we can call the constructor.
+    inline ReadBufferPool();
+    inline ~ReadBufferPool();
+
+    enum Fields {
+      kHits,
+      kMisses,
+      kCopies,
+      kHandOffs,
+      kPooled,
+      kFieldsCount
+    };
+
+    static const int kMaxPooled = 4;
+
+    double fields_[kFieldsCount];
+    char* pool_[kMaxPooled];
+    int pooled_;
+
+    DISALLOW_COPY_AND_ASSIGN(ReadBufferPool);
+  };
+
+  // Free lists for the buffers of NodeBIO, which sits between OpenSSL and
+  // TLS sockets. BIOs give their buffers back as soon as they are drained,
+  // so that idle connections don't hold on to any, and busy ones take them
+  // from here instead of from malloc(). They only pool their two standard
+  // buffer sizes, see NodeBIO::NewBuffer().
+  class BIOBufferPool {
+   public:
+    inline double* fields();
+    inline int fields_count() const;
+    inline char* Acquire(size_t size);
+    inline void Release(char* data, size_t size);
+    inline void CountInUse(int64_t change);
+    inline void CountIdleRelease();
+
+   private:
+    friend class Environment;  // So we can call the constructor.
+    inline BIOBufferPool();
+    inline ~BIOBufferPool();
+
+    enum Fields {
+      kInUse,
+      kPooled,
+      kHits,
+      kMisses,
+      kIdleReleases,
+      kFieldsCount
+    };
+
+    static const int kMaxSizes = 4;
+    static const size_t kMaxPooledBytes = 4 * 1024 * 1024;
+
+    // Singly linked through the first bytes of the free blocks
+    struct FreeList {
+      size_t size;
+      char* head;
+    };
+
+    double fields_[kFieldsCount];
+    FreeList lists_[kMaxSizes];
+    size_t pooled_;
+
+    DISALLOW_COPY_AND_ASSIGN(BIOBufferPool);
+  };
+
+  // Counters for the streams that have write coalescing enabled, see
+  // StreamWrap::SetWriteCoalescing().
+  class WriteCoalescing {
+   public:
+    inline double* fields();
+    inline int fields_count() const;
+    inline void CountWrite(size_t bytes);
+    inline void CountFlush(size_t writes);
+
+   private:
+    friend class Environment;  // So we can call the constructor.
+    inline WriteCoalescing();
+
+    enum Fields {
+      kWrites,
+      kBytes,
+      kFlushes,
+      kSyscallsSaved,
+      kFieldsCount
+    };
+
+    double fields_[kFieldsCount];
+
+    DISALLOW_COPY_AND_ASSIGN(WriteCoalescing);
+  };
+
   typedef void (*HandleCleanupCb)(Environment* env,
                                   uv_handle_t* handle,
                                   void* arg);
@@ -398,6 +551,15 @@ class Environment {
   inline AsyncHooks* async_hooks();
   inline DomainFlag* domain_flag();
   inline TickInfo* tick_info();
+  inline ReadBufferPool* read_buffer_pool();
+  inline BIOBufferPool* bio_buffer_pool();
+  inline WriteCoalescing* write_coalescing();
+
+  // Scratch space that stat(), lstat() and fstat() write their results to
+  // when JS asks for lazy stats, laid out like the fs.Stats constructor
+  // arguments.  JS copies the numbers out before the next call.
+  static const int kFsStatsFieldsCount = 14;
+  inline double* fs_stats_field_array();
 
   static inline Environment* from_cares_timer_handle(uv_timer_t* handle);
   inline uv_timer_t* cares_timer_handle();
@@ -420,6 +582,12 @@ class Environment {
   inline bool printed_error() const;
   inline void set_printed_error(bool value);
 
+  // Set while the loop runs the callbacks of a batch of threadpool
+  // completions. MakeCallback() leaves the nextTick queue and the microtasks
+  // alone until the whole batch has run.
+  inline bool in_callback_batch() const;
+  inline void set_in_callback_batch(bool value);
+
   void PrintSyncTrace() const;
   inline void set_trace_sync_io(bool value);
 
@@ -465,6 +633,17 @@ class Environment {
   PER_ISOLATE_STRING_PROPERTIES(V)
 #undef V
 
+  enum HttpHeaderNames {
+#define V(PropertyName, Name, LowercaseName) kHttpHeader_ ## PropertyName,
+    PER_ISOLATE_HTTP_HEADER_NAMES(V)
+#undef V
+    kHttpHeaderNamesCount
+  };
+
+  // Entry 2 * n is the usual spelling of header n, 2 * n + 1 the lowercase
+  // spelling.
+  inline v8::Local<v8::String> http_header_name(int index) const;
+
 #define V(PropertyName, TypeName)                                             \
   inline v8::Local<TypeName> PropertyName() const;                            \
   inline void set_ ## PropertyName(v8::Local<TypeName> value);
@@ -501,6 +680,10 @@ class Environment {
   AsyncHooks async_hooks_;
   DomainFlag domain_flag_;
   TickInfo tick_info_;
+  ReadBufferPool read_buffer_pool_;
+  BIOBufferPool bio_buffer_pool_;
+  WriteCoalescing write_coalescing_;
+  double fs_stats_field_array_[kFsStatsFieldsCount];
   uv_timer_t cares_timer_handle_;
   ares_channel cares_channel_;
   ares_task_list cares_task_list_;
@@ -510,6 +693,7 @@ class Environment {
   bool using_asyncwrap_;
   bool printed_error_;
   bool trace_sync_io_;
+  bool in_callback_batch_;
   debugger::Agent debugger_agent_;
 
   HandleWrapQueue handle_wrap_queue_;
@@ -535,6 +719,7 @@ class Environment {
     inline v8::Local<v8::String> PropertyName() const;
     PER_ISOLATE_STRING_PROPERTIES(V)
 #undef V
+    inline v8::Local<v8::String> http_header_name(int index) const;
 
    private:
     inline static IsolateData* Get(v8::Isolate* isolate);
@@ -548,6 +733,7 @@ class Environment {
     v8::Eternal<v8::String> PropertyName ## _;
     PER_ISOLATE_STRING_PROPERTIES(V)
 #undef V
+    v8::Eternal<v8::String> http_header_names_[2 * kHttpHeaderNamesCount];
 
     unsigned int ref_count_;
 
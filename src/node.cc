@@ -193,6 +193,52 @@ static void CheckImmediate(uv_check_t* handle) {
 }
 
 
+static void BeginWorkBatch(uv_loop_t* loop, unsigned int count, void* arg) {
+  // A lone completion processes its nextTick queue right away, as usual.
+  if (count > 1)
+    static_cast<Environment*>(arg)->set_in_callback_batch(true);
+}
+
+
+// Runs the nextTick queue and the microtasks once for all the callbacks of
+// a batch of threadpool completions, rather than after each of them.
+static void EndWorkBatch(uv_loop_t* loop, unsigned int count, void* arg) {
+  Environment* env = static_cast<Environment*>(arg);
+
+  if (!env->in_callback_batch())
+    return;
+  env->set_in_callback_batch(false);
+
+  HandleScope handle_scope(env->isolate());
+  Context::Scope context_scope(env->context());
+  Environment::TickInfo* tick_info = env->tick_info();
+
+  if (tick_info->in_tick())
+    return;
+
+  TryCatch try_catch;
+  try_catch.SetVerbose(true);
+
+  if (tick_info->length() == 0) {
+    env->isolate()->RunMicrotasks();
+  }
+
+  if (tick_info->length() == 0) {
+    tick_info->set_index(0);
+    return;
+  }
+
+  tick_info->set_in_tick(true);
+
+  env->tick_callback_function()->Call(env->process_object(), 0, nullptr);
+
+  tick_info->set_in_tick(false);
+
+  if (try_catch.HasCaught())
+    tick_info->set_last_threw(true);
+}
+
+
 static void IdleImmediateDummy(uv_idle_t* handle) {
   // Do nothing. Only for maintaining event loop.
   // TODO(bnoordhuis) Maybe make libuv accept nullptr idle callbacks.
@@ -3843,6 +3889,11 @@ Environment* CreateEnvironment(Isolate* isolate,
   uv_unref(reinterpret_cast<uv_handle_t*>(env->idle_prepare_handle()));
   uv_unref(reinterpret_cast<uv_handle_t*>(env->idle_check_handle()));
 
+  uv_loop_set_work_batch_cb(env->event_loop(),
+                            BeginWorkBatch,
+                            EndWorkBatch,
+                            env);
+
   // Register handle cleanups
   env->RegisterHandleCleanup(
       reinterpret_cast<uv_handle_t*>(env->immediate_check_handle()),
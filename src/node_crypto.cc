@@ -74,6 +74,7 @@ using v8::Integer;
 using v8::Isolate;
 using v8::Local;
 using v8::Null;
+using v8::Number;
 using v8::Object;
 using v8::Persistent;
 using v8::PropertyAttribute;
@@ -263,6 +264,7 @@ void SecureContext::Initialize(Environment* env, Handle<Object> target) {
                       SecureContext::SetSessionIdContext);
   env->SetProtoMethod(t, "setSessionTimeout",
                       SecureContext::SetSessionTimeout);
+  env->SetProtoMethod(t, "setSessionCache", SecureContext::SetSessionCache);
   env->SetProtoMethod(t, "close", SecureContext::Close);
   env->SetProtoMethod(t, "loadPKCS12", SecureContext::LoadPKCS12);
   env->SetProtoMethod(t, "getTicketKeys", SecureContext::GetTicketKeys);
@@ -361,6 +363,7 @@ void SecureContext::Init(const FunctionCallbackInfo<Value>& args) {
                                  SSL_SESS_CACHE_NO_AUTO_CLEAR);
   SSL_CTX_sess_set_get_cb(sc->ctx_, SSLWrap<Connection>::GetSessionCallback);
   SSL_CTX_sess_set_new_cb(sc->ctx_, SSLWrap<Connection>::NewSessionCallback);
+  SSL_CTX_set_app_data(sc->ctx_, sc);
 
   sc->ca_store_ = nullptr;
 }
@@ -825,6 +828,27 @@ void SecureContext::SetSessionTimeout(const FunctionCallbackInfo<Value>& args) {
 }
 
 
+void SecureContext::SetSessionCache(const FunctionCallbackInfo<Value>& args) {
+  SecureContext* sc = Unwrap<SecureContext>(args.Holder());
+  Environment* env = sc->env();
+
+  if (args[0]->IsNull() || args[0]->IsUndefined()) {
+    sc->session_cache_ = nullptr;
+    sc->session_cache_handle_.Reset();
+    return;
+  }
+
+  if (!args[0]->IsObject() ||
+      !env->session_cache_constructor_template()->HasInstance(args[0])) {
+    return env->ThrowTypeError("Bad parameter");
+  }
+
+  Local<Object> obj = args[0].As<Object>();
+  sc->session_cache_ = Unwrap<SessionCache>(obj);
+  sc->session_cache_handle_.Reset(env->isolate(), obj);
+}
+
+
 void SecureContext::Close(const FunctionCallbackInfo<Value>& args) {
   SecureContext* sc = Unwrap<SecureContext>(args.Holder());
   sc->FreeCTXMem();
@@ -977,6 +1001,176 @@ void SecureContext::GetCertificate(const FunctionCallbackInfo<Value>& args) {
 }
 
 
+void SessionCache::Initialize(Environment* env, Handle<Object> target) {
+  Local<FunctionTemplate> t = env->NewFunctionTemplate(SessionCache::New);
+  t->InstanceTemplate()->SetInternalFieldCount(1);
+  t->SetClassName(FIXED_ONE_BYTE_STRING(env->isolate(), "SessionCache"));
+
+  env->SetProtoMethod(t, "getStats", SessionCache::GetStats);
+  env->SetProtoMethod(t, "flush", SessionCache::Flush);
+
+  target->Set(FIXED_ONE_BYTE_STRING(env->isolate(), "SessionCache"),
+              t->GetFunction());
+  env->set_session_cache_constructor_template(t);
+}
+
+
+SessionCache::SessionCache(Environment* env,
+                           Local<Object> wrap,
+                           unsigned int size,
+                           unsigned int timeout)
+    : BaseObject(env, wrap),
+      size_(size),
+      timeout_(timeout),
+      count_(0),
+      hits_(0),
+      misses_(0),
+      evictions_(0) {
+  MakeWeak<SessionCache>(this);
+
+  // One bucket per entry, rounded up to a power of two.
+  unsigned int buckets = 1;
+  while (buckets < size && buckets < kMaxBuckets)
+    buckets <<= 1;
+  bucket_mask_ = buckets - 1;
+  buckets_ = new Bucket[buckets];
+}
+
+
+SessionCache::~SessionCache() {
+  Flush();
+  delete[] buckets_;
+}
+
+
+// new SessionCache(size, timeout)
+// A timeout of 0 keeps the sessions for as long as they are valid.
+void SessionCache::New(const FunctionCallbackInfo<Value>& args) {
+  Environment* env = Environment::GetCurrent(args);
+
+  if (!args[0]->IsUint32() || args[0]->Uint32Value() == 0 ||
+      !args[1]->IsUint32()) {
+    return env->ThrowTypeError("Bad parameter");
+  }
+
+  new SessionCache(env,
+                   args.This(),
+                   args[0]->Uint32Value(),
+                   args[1]->Uint32Value());
+}
+
+
+void SessionCache::GetStats(const FunctionCallbackInfo<Value>& args) {
+  SessionCache* cache = Unwrap<SessionCache>(args.Holder());
+  Isolate* isolate = args.GetIsolate();
+
+  Local<Object> stats = Object::New(isolate);
+  stats->Set(FIXED_ONE_BYTE_STRING(isolate, "entries"),
+             Integer::NewFromUnsigned(isolate, cache->count_));
+  stats->Set(FIXED_ONE_BYTE_STRING(isolate, "hits"),
+             Number::New(isolate, static_cast<double>(cache->hits_)));
+  stats->Set(FIXED_ONE_BYTE_STRING(isolate, "misses"),
+             Number::New(isolate, static_cast<double>(cache->misses_)));
+  stats->Set(FIXED_ONE_BYTE_STRING(isolate, "evictions"),
+             Number::New(isolate, static_cast<double>(cache->evictions_)));
+  args.GetReturnValue().Set(stats);
+}
+
+
+void SessionCache::Flush(const FunctionCallbackInfo<Value>& args) {
+  SessionCache* cache = Unwrap<SessionCache>(args.Holder());
+  cache->Flush();
+}
+
+
+SessionCache::Bucket* SessionCache::BucketFor(const unsigned char* id,
+                                              unsigned int id_len) {
+  // FNV-1a, session ids are random anyway.
+  uint32_t hash = 2166136261u;
+  for (unsigned int i = 0; i < id_len; i++) {
+    hash ^= id[i];
+    hash *= 16777619u;
+  }
+  return &buckets_[hash & bucket_mask_];
+}
+
+
+SSL_SESSION* SessionCache::Get(const unsigned char* id, unsigned int id_len) {
+  Bucket* bucket = BucketFor(id, id_len);
+  Entry* entry = nullptr;
+
+  for (Entry* e : *bucket) {
+    if (e->session->session_id_length == id_len &&
+        memcmp(e->session->session_id, id, id_len) == 0) {
+      entry = e;
+      break;
+    }
+  }
+
+  if (entry == nullptr) {
+    misses_++;
+    return nullptr;
+  }
+
+  if (entry->expires <= time(nullptr)) {
+    Delete(entry);
+    misses_++;
+    return nullptr;
+  }
+
+  entry->lru_member.Remove();
+  lru_.PushBack(entry);
+  hits_++;
+  return entry->session;
+}
+
+
+void SessionCache::Add(SSL_SESSION* sess) {
+  // A client that offered an unknown session id can end up with the same id
+  // again, replace the old session.
+  Bucket* bucket = BucketFor(sess->session_id, sess->session_id_length);
+  for (Entry* e : *bucket) {
+    if (e->session->session_id_length == sess->session_id_length &&
+        memcmp(e->session->session_id,
+               sess->session_id,
+               sess->session_id_length) == 0) {
+      Delete(e);
+      break;
+    }
+  }
+
+  while (count_ >= size_) {
+    Delete(lru_.PopFront());
+    evictions_++;
+  }
+
+  long timeout = SSL_SESSION_get_timeout(sess);  // NOLINT(runtime/int)
+  if (timeout_ != 0 && timeout_ < timeout)
+    timeout = timeout_;
+
+  Entry* entry = new Entry();
+  entry->session = sess;
+  entry->expires = SSL_SESSION_get_time(sess) + timeout;
+  bucket->PushBack(entry);
+  lru_.PushBack(entry);
+  count_++;
+}
+
+
+void SessionCache::Flush() {
+  while (!lru_.IsEmpty())
+    Delete(lru_.PopFront());
+}
+
+
+void SessionCache::Delete(Entry* entry) {
+  // The destructors of the list nodes unlink the entry.
+  SSL_SESSION_free(entry->session);
+  delete entry;
+  count_--;
+}
+
+
 template <class Base>
 void SSLWrap<Base>::AddMethods(Environment* env, Handle<FunctionTemplate> t) {
   HandleScope scope(env->isolate());
@@ -1051,6 +1245,15 @@ SSL_SESSION* SSLWrap<Base>::GetSessionCallback(SSL* s,
   SSL_SESSION* sess = w->next_sess_;
   w->next_sess_ = nullptr;
 
+  // Without JS handlers, look the session up in the native cache, if any.
+  if (sess == nullptr && !w->session_callbacks_) {
+    SessionCache* cache = SecureContext::session_cache(s);
+    if (cache != nullptr) {
+      sess = cache->Get(key, len);
+      *copy = 1;
+    }
+  }
+
   return sess;
 }
 
@@ -1062,8 +1265,14 @@ int SSLWrap<Base>::NewSessionCallback(SSL* s, SSL_SESSION* sess) {
   HandleScope handle_scope(env->isolate());
   Context::Scope context_scope(env->context());
 
-  if (!w->session_callbacks_)
-    return 0;
+  if (!w->session_callbacks_) {
+    SessionCache* cache = SecureContext::session_cache(s);
+    if (cache == nullptr)
+      return 0;
+    // Returning 1 hands our reference to sess over to the cache.
+    cache->Add(sess);
+    return 1;
+  }
 
   // Check if session is small enough to be stored
   int size = i2d_SSL_SESSION(sess, nullptr);
@@ -1714,20 +1923,23 @@ int SSLWrap<Base>::AdvertiseNextProtoCallback(SSL* s,
                                               unsigned int* len,
                                               void* arg) {
   Base* w = static_cast<Base*>(SSL_get_app_data(s));
-  Environment* env = w->env();
-  HandleScope handle_scope(env->isolate());
-  Context::Scope context_scope(env->context());
 
+  // No initialization - no NPN protocols. This path doesn't touch V8, so it
+  // is safe on the thread pool (see TLSWrap::SSLCertCallback).
   if (w->npn_protos_.IsEmpty()) {
-    // No initialization - no NPN protocols
     *data = reinterpret_cast<const unsigned char*>("");
     *len = 0;
-  } else {
-    Local<Object> obj = PersistentToLocal(env->isolate(), w->npn_protos_);
-    *data = reinterpret_cast<const unsigned char*>(Buffer::Data(obj));
-    *len = Buffer::Length(obj);
+    return SSL_TLSEXT_ERR_OK;
   }
 
+  Environment* env = w->env();
+  HandleScope handle_scope(env->isolate());
+  Context::Scope context_scope(env->context());
+
+  Local<Object> obj = PersistentToLocal(env->isolate(), w->npn_protos_);
+  *data = reinterpret_cast<const unsigned char*>(Buffer::Data(obj));
+  *len = Buffer::Length(obj);
+
   return SSL_TLSEXT_ERR_OK;
 }
 
@@ -1829,9 +2041,10 @@ template <class Base>
 int SSLWrap<Base>::TLSExtStatusCallback(SSL* s, void* arg) {
   Base* w = static_cast<Base*>(SSL_get_app_data(s));
   Environment* env = w->env();
-  HandleScope handle_scope(env->isolate());
 
   if (w->is_client()) {
+    HandleScope handle_scope(env->isolate());
+
     // Incoming response
     const unsigned char* resp;
     int len = SSL_get_tlsext_status_ocsp_resp(s, &resp);
@@ -1854,6 +2067,7 @@ int SSLWrap<Base>::TLSExtStatusCallback(SSL* s, void* arg) {
     if (w->ocsp_response_.IsEmpty())
       return SSL_TLSEXT_ERR_NOACK;
 
+    HandleScope handle_scope(env->isolate());
     Local<Object> obj = PersistentToLocal(env->isolate(), w->ocsp_response_);
     char* resp = Buffer::Data(obj);
     size_t len = Buffer::Length(obj);
@@ -4625,10 +4839,11 @@ void PBKDF2(const FunctionCallbackInfo<Value>& args) {
     // XXX(trevnorris): This will need to go with the rest of domains.
     if (env->in_domain())
       obj->Set(env->domain_string(), env->domain_array()->Get(0));
-    uv_queue_work(env->event_loop(),
-                  req->work_req(),
-                  EIO_PBKDF2,
-                  EIO_PBKDF2After);
+    uv_queue_work_class(env->event_loop(),
+                        req->work_req(),
+                        UV_WORK_CPU,
+                        EIO_PBKDF2,
+                        EIO_PBKDF2After);
   } else {
     env->PrintSyncTrace();
     Local<Value> argv[2];
@@ -4781,10 +4996,11 @@ void RandomBytes(const FunctionCallbackInfo<Value>& args) {
     // XXX(trevnorris): This will need to go with the rest of domains.
     if (env->in_domain())
       obj->Set(env->domain_string(), env->domain_array()->Get(0));
-    uv_queue_work(env->event_loop(),
-                  req->work_req(),
-                  RandomBytesWork,
-                  RandomBytesAfter);
+    uv_queue_work_class(env->event_loop(),
+                        req->work_req(),
+                        UV_WORK_CPU,
+                        RandomBytesWork,
+                        RandomBytesAfter);
     args.GetReturnValue().Set(obj);
   } else {
     env->PrintSyncTrace();
@@ -5136,6 +5352,7 @@ void InitCrypto(Handle<Object> target,
 
   Environment* env = Environment::GetCurrent(context);
   SecureContext::Initialize(env, target);
+  SessionCache::Initialize(env, target);
   Connection::Initialize(env, target);
   CipherBase::Initialize(env, target);
   DiffieHellman::Initialize(env, target);
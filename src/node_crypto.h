@@ -48,6 +48,58 @@ extern X509_STORE* root_cert_store;
 // Forward declaration
 class Connection;
 
+// LRU cache of server side sessions, keyed by session id. It lets a server
+// resume sessions without going through the JS 'newSession' and
+// 'resumeSession' events, and can be shared by several SecureContexts.
+class SessionCache : public BaseObject {
+ public:
+  ~SessionCache() override;
+
+  static void Initialize(Environment* env, v8::Handle<v8::Object> target);
+
+  // Returns a borrowed reference, or nullptr.
+  SSL_SESSION* Get(const unsigned char* id, unsigned int id_len);
+  // Takes over the reference to sess.
+  void Add(SSL_SESSION* sess);
+  void Flush();
+
+  static const unsigned int kMaxBuckets = 64 * 1024;
+
+ protected:
+  struct Entry {
+    SSL_SESSION* session;
+    time_t expires;
+    ListNode<Entry> lru_member;
+    ListNode<Entry> bucket_member;
+  };
+
+  typedef ListHead<Entry, &Entry::lru_member> LRUList;
+  typedef ListHead<Entry, &Entry::bucket_member> Bucket;
+
+  static void New(const v8::FunctionCallbackInfo<v8::Value>& args);
+  static void GetStats(const v8::FunctionCallbackInfo<v8::Value>& args);
+  static void Flush(const v8::FunctionCallbackInfo<v8::Value>& args);
+
+  SessionCache(Environment* env,
+               v8::Local<v8::Object> wrap,
+               unsigned int size,
+               unsigned int timeout);
+
+  Bucket* BucketFor(const unsigned char* id, unsigned int id_len);
+  void Delete(Entry* entry);
+
+  const unsigned int size_;
+  const unsigned int timeout_;
+  unsigned int count_;
+  unsigned int bucket_mask_;
+  Bucket* buckets_;
+  // Least recently used first.
+  LRUList lru_;
+  uint64_t hits_;
+  uint64_t misses_;
+  uint64_t evictions_;
+};
+
 class SecureContext : public BaseObject {
  public:
   ~SecureContext() override {
@@ -60,9 +112,17 @@ class SecureContext : public BaseObject {
   SSL_CTX* ctx_;
   X509* cert_;
   X509* issuer_;
+  SessionCache* session_cache_;
 
   static const int kMaxSessionSize = 10 * 1024;
 
+  // The cache of the context that the session callbacks of s run on, if any.
+  static inline SessionCache* session_cache(SSL* s) {
+    SecureContext* sc =
+        static_cast<SecureContext*>(SSL_CTX_get_app_data(s->session_ctx));
+    return sc == nullptr ? nullptr : sc->session_cache_;
+  }
+
  protected:
   static const int64_t kExternalSize = sizeof(SSL_CTX);
 
@@ -81,6 +141,7 @@ class SecureContext : public BaseObject {
       const v8::FunctionCallbackInfo<v8::Value>& args);
   static void SetSessionTimeout(
       const v8::FunctionCallbackInfo<v8::Value>& args);
+  static void SetSessionCache(const v8::FunctionCallbackInfo<v8::Value>& args);
   static void Close(const v8::FunctionCallbackInfo<v8::Value>& args);
   static void LoadPKCS12(const v8::FunctionCallbackInfo<v8::Value>& args);
   static void GetTicketKeys(const v8::FunctionCallbackInfo<v8::Value>& args);
@@ -98,14 +159,19 @@ class SecureContext : public BaseObject {
         ca_store_(nullptr),
         ctx_(nullptr),
         cert_(nullptr),
-        issuer_(nullptr) {
+        issuer_(nullptr),
+        session_cache_(nullptr) {
     MakeWeak<SecureContext>(this);
     env->isolate()->AdjustAmountOfExternalAllocatedMemory(kExternalSize);
   }
 
   void FreeCTXMem() {
+    session_cache_ = nullptr;
+    session_cache_handle_.Reset();
     if (ctx_) {
       env()->isolate()->AdjustAmountOfExternalAllocatedMemory(-kExternalSize);
+      // Connections can keep ctx_ alive for longer than this object.
+      SSL_CTX_set_app_data(ctx_, nullptr);
       if (ctx_->cert_store == root_cert_store) {
         // SSL_CTX_free() will attempt to free the cert_store as well.
         // Since we want our root_cert_store to stay around forever
@@ -126,6 +192,9 @@ class SecureContext : public BaseObject {
       CHECK_EQ(ca_store_, nullptr);
     }
   }
+
+  // Keeps session_cache_ alive.
+  v8::Persistent<v8::Object> session_cache_handle_;
 };
 
 // SSLWrap implicitly depends on the inheriting class' handle having an
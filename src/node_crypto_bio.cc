@@ -2,6 +2,7 @@
 #include "openssl/bio.h"
 #include "util.h"
 #include "util-inl.h"
+#include <new>
 #include <string.h>
 
 namespace node {
@@ -32,6 +33,105 @@ void NodeBIO::AssignEnvironment(Environment* env) {
 }
 
 
+void NodeBIO::ResumeAccounting() {
+  accounting_deferred_ = false;
+  if (deferred_external_memory_ == 0)
+    return;
+  CHECK_NE(env_, nullptr);
+  env_->isolate()->AdjustAmountOfExternalAllocatedMemory(
+      deferred_external_memory_);
+  env_->bio_buffer_pool()->CountInUse(deferred_external_memory_);
+  deferred_external_memory_ = 0;
+}
+
+
+// Buffers come in two sizes, kInitialBufferLength and
+// kThroughputBufferLength, so that the pool's free lists aren't claimed by
+// whatever odd sizes happen to be released first. Larger buffers are rare
+// and go straight to malloc().
+NodeBIO::Buffer* NodeBIO::NewBuffer(size_t len) {
+  if (len <= kInitialBufferLength)
+    len = kInitialBufferLength;
+  else if (len <= kThroughputBufferLength)
+    len = kThroughputBufferLength;
+
+  size_t size = sizeof(Buffer) + len;
+  char* data;
+  if (env_ == nullptr || accounting_deferred_) {
+    data = static_cast<char*>(malloc(size));
+  } else if (len > kThroughputBufferLength) {
+    data = static_cast<char*>(malloc(size));
+    env_->bio_buffer_pool()->CountInUse(size);
+  } else {
+    data = env_->bio_buffer_pool()->Acquire(size);
+  }
+  CHECK_NE(data, nullptr);
+
+  Buffer* buf = new(data) Buffer(env_, len);
+  AdjustExternalMemory(buf, static_cast<int64_t>(size));
+  return buf;
+}
+
+
+void NodeBIO::DeleteBuffer(Buffer* buf) {
+  Environment* env = buf->env_;
+  size_t size = buf->size();
+  AdjustExternalMemory(buf, -static_cast<int64_t>(size));
+  buf->~Buffer();
+
+  char* data = reinterpret_cast<char*>(buf);
+  if (env == nullptr || accounting_deferred_) {
+    free(data);
+  } else if (size > sizeof(Buffer) + kThroughputBufferLength) {
+    free(data);
+    env->bio_buffer_pool()->CountInUse(-static_cast<int64_t>(size));
+  } else {
+    env->bio_buffer_pool()->Release(data, size);
+  }
+}
+
+
+void NodeBIO::DeleteBuffers() {
+  if (read_head_ == nullptr)
+    return;
+
+  Buffer* current = read_head_;
+  do {
+    Buffer* next = current->next_;
+    DeleteBuffer(current);
+    current = next;
+  } while (current != read_head_);
+
+  read_head_ = nullptr;
+  write_head_ = nullptr;
+}
+
+
+void NodeBIO::ReleaseBuffers() {
+  CHECK_EQ(length_, 0);
+  if (read_head_ == nullptr)
+    return;
+
+  // A BIO that needed more than its initial buffer is likely to need
+  // as much the next time, start it off with a large buffer then.
+  if (read_head_->next_ != read_head_ || read_head_->len_ > initial_)
+    initial_ = kThroughputBufferLength;
+
+  DeleteBuffers();
+  env_->bio_buffer_pool()->CountIdleRelease();
+}
+
+
+void NodeBIO::AdjustExternalMemory(Buffer* buf, int64_t change) {
+  if (buf->env_ == nullptr)
+    return;
+  if (accounting_deferred_)
+    deferred_external_memory_ += change;
+  else
+    buf->env_->isolate()->AdjustAmountOfExternalAllocatedMemory(change);
+}
+
+
 int NodeBIO::New(BIO* bio) {
   bio->ptr = new NodeBIO();
 
@@ -250,6 +350,13 @@ size_t NodeBIO::Read(char* out, size_t size) {
   CHECK_EQ(expected, bytes_read);
   length_ -= bytes_read;
 
+  // Nothing left, don't keep any memory around while idle. The pool makes
+  // getting it back cheap.
+  if (length_ == 0 && env_ != nullptr && !accounting_deferred_) {
+    ReleaseBuffers();
+    return bytes_read;
+  }
+
   // Free all empty buffers, but write_head's child
   FreeEmpty();
 
@@ -273,7 +380,7 @@ void NodeBIO::FreeEmpty() {
     CHECK_EQ(cur->write_pos_, cur->read_pos_);
 
     Buffer* next = cur->next_;
-    delete cur;
+    DeleteBuffer(cur);
     cur = next;
   }
   prev->next_ = cur;
@@ -404,7 +511,7 @@ void NodeBIO::TryAllocateForWrite(size_t hint) {
                              kThroughputBufferLength;
     if (len < hint)
       len = hint;
-    Buffer* next = new Buffer(env_, len);
+    Buffer* next = NewBuffer(len);
 
     if (w == nullptr) {
       next->next_ = next;
@@ -437,18 +544,7 @@ void NodeBIO::Reset() {
 
 
 NodeBIO::~NodeBIO() {
-  if (read_head_ == nullptr)
-    return;
-
-  Buffer* current = read_head_;
-  do {
-    Buffer* next = current->next_;
-    delete current;
-    current = next;
-  } while (current != read_head_);
-
-  read_head_ = nullptr;
-  write_head_ = nullptr;
+  DeleteBuffers();
 }
 
 }  // namespace node
@@ -13,6 +13,8 @@ namespace node {
 class NodeBIO {
  public:
   NodeBIO() : env_(nullptr),
+              accounting_deferred_(false),
+              deferred_external_memory_(0),
               initial_(kInitialBufferLength),
               length_(0),
               read_head_(nullptr),
@@ -25,6 +27,15 @@ class NodeBIO {
 
   void AssignEnvironment(Environment* env);
 
+  // Collect changes of the externally allocated memory instead of reporting
+  // them to V8 and allocate buffers without the environment's pool, so that
+  // the BIO may be used from a thread pool thread until ResumeAccounting()
+  // is called on the loop thread.
+  inline void DeferAccounting() {
+    accounting_deferred_ = true;
+  }
+  void ResumeAccounting();
+
   // Move read head to next buffer if needed
   void TryMoveReadHead();
 
@@ -38,6 +49,9 @@ class NodeBIO {
   // Deallocate children of write head's child if they're empty
   void FreeEmpty();
 
+  // Give all buffers back to the environment's pool once the BIO is empty
+  void ReleaseBuffers();
+
   // Return pointer to internal data and amount of
   // contiguous data available to read
   char* Peek(size_t* size);
@@ -93,26 +107,23 @@ class NodeBIO {
 
   static const BIO_METHOD method;
 
+  // Allocated together with its data, see NewBuffer()
   class Buffer {
    public:
-    Buffer(Environment* env, size_t len) : env_(env),
-                                           read_pos_(0),
-                                           write_pos_(0),
-                                           len_(len),
-                                           next_(nullptr) {
-      data_ = new char[len];
-      if (env_ != nullptr)
-        env_->isolate()->AdjustAmountOfExternalAllocatedMemory(len);
+    Buffer(Environment* env, size_t len)
+        : env_(env),
+          read_pos_(0),
+          write_pos_(0),
+          len_(len),
+          next_(nullptr),
+          data_(reinterpret_cast<char*>(this + 1)) {
     }
 
-    ~Buffer() {
-      delete[] data_;
-      if (env_ != nullptr) {
-        const int64_t len = static_cast<int64_t>(len_);
-        env_->isolate()->AdjustAmountOfExternalAllocatedMemory(-len);
-      }
+    inline size_t size() const {
+      return sizeof(*this) + len_;
     }
 
+    // Taken from the pool of `env_`, if set
     Environment* env_;
     size_t read_pos_;
     size_t write_pos_;
@@ -121,7 +132,14 @@ class NodeBIO {
     char* data_;
   };
 
+  Buffer* NewBuffer(size_t len);
+  void DeleteBuffer(Buffer* buf);
+  void DeleteBuffers();
+  void AdjustExternalMemory(Buffer* buf, int64_t change);
+
   Environment* env_;
+  bool accounting_deferred_;
+  int64_t deferred_external_memory_;
   size_t initial_;
   size_t length_;
   Buffer* read_head_;
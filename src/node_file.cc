@@ -14,6 +14,8 @@
 #include <fcntl.h>
 #include <sys/types.h>
 #include <sys/stat.h>
+#include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 #include <errno.h>
 #include <limits.h>
@@ -27,6 +29,7 @@ namespace node {
 using v8::Array;
 using v8::Context;
 using v8::EscapableHandleScope;
+using v8::Exception;
 using v8::Function;
 using v8::FunctionCallbackInfo;
 using v8::FunctionTemplate;
@@ -38,6 +41,7 @@ using v8::Number;
 using v8::Object;
 using v8::String;
 using v8::Value;
+using v8::kExternalFloat64Array;
 
 #ifndef MIN
 # define MIN(a, b) ((a) < (b) ? (a) : (b))
@@ -127,6 +131,103 @@ static inline bool IsInt64(double x) {
 }
 
 
+// Maps the d_type of a directory entry to the S_IFMT bits of a stat mode,
+// 0 if the file system didn't tell.
+static int DirentTypeToMode(uv_dirent_type_t type) {
+  switch (type) {
+    case UV_DIRENT_FILE:
+      return S_IFREG;
+    case UV_DIRENT_DIR:
+      return S_IFDIR;
+#ifdef S_IFLNK
+    case UV_DIRENT_LINK:
+      return S_IFLNK;
+#endif
+#ifdef S_IFIFO
+    case UV_DIRENT_FIFO:
+      return S_IFIFO;
+#endif
+#ifdef S_IFSOCK
+    case UV_DIRENT_SOCKET:
+      return S_IFSOCK;
+#endif
+#ifdef S_IFCHR
+    case UV_DIRENT_CHAR:
+      return S_IFCHR;
+#endif
+#ifdef S_IFBLK
+    case UV_DIRENT_BLOCK:
+      return S_IFBLK;
+#endif
+    default:
+      return 0;
+  }
+}
+
+
+// Turns the entries of a finished scandir request into an array of names,
+// or into { names, types } with the entries' S_IFMT bits when `with_types`
+// is set.  Returns 0 or a libuv error code.
+static int BuildDirents(Environment* env,
+                        uv_fs_t* req,
+                        bool with_types,
+                        Local<Value>* result) {
+  Local<Array> names = Array::New(env->isolate(), 0);
+  Local<Array> types;
+  if (with_types)
+    types = Array::New(env->isolate(), 0);
+
+  for (int i = 0; ; i++) {
+    uv_dirent_t ent;
+
+    int r = uv_fs_scandir_next(req, &ent);
+    if (r == UV_EOF)
+      break;
+    if (r != 0)
+      return r;
+
+    names->Set(i, String::NewFromUtf8(env->isolate(), ent.name));
+    if (with_types)
+      types->Set(i, Integer::New(env->isolate(), DirentTypeToMode(ent.type)));
+  }
+
+  if (with_types) {
+    Local<Object> dirents = Object::New(env->isolate());
+    dirents->Set(env->names_string(), names);
+    dirents->Set(env->types_string(), types);
+    *result = dirents;
+  } else {
+    *result = names;
+  }
+
+  return 0;
+}
+
+// Writes the fields of `s` to `fields` as plain numbers, in the order of the
+// arguments of the fs.Stats constructor.  Times are in milliseconds.
+static void FillStatFields(const uv_stat_t* s, double* fields) {
+  fields[0] = static_cast<double>(s->st_dev);
+  fields[1] = static_cast<double>(s->st_mode);
+  fields[2] = static_cast<double>(s->st_nlink);
+  fields[3] = static_cast<double>(s->st_uid);
+  fields[4] = static_cast<double>(s->st_gid);
+  fields[5] = static_cast<double>(s->st_rdev);
+  fields[6] = static_cast<double>(s->st_blksize);
+  fields[7] = static_cast<double>(s->st_ino);
+  fields[8] = static_cast<double>(s->st_size);
+  fields[9] = static_cast<double>(s->st_blocks);
+#define X(idx, name)                                                          \
+  fields[idx] = (static_cast<double>(s->st_##name.tv_sec) * 1000) +           \
+                (static_cast<double>(s->st_##name.tv_nsec / 1000000));        \
+
+  X(10, atim)
+  X(11, mtim)
+  X(12, ctim)
+  X(13, birthtim)
+#undef X
+}
+
+
 static void After(uv_fs_t *req) {
   FSReqWrap* req_wrap = static_cast<FSReqWrap*>(req->data);
   CHECK_EQ(&req_wrap->req_, req);
@@ -211,29 +312,14 @@ static void After(uv_fs_t *req) {
 
       case UV_FS_SCANDIR:
         {
-          int r;
-          Local<Array> names = Array::New(env->isolate(), 0);
-
-          for (int i = 0; ; i++) {
-            uv_dirent_t ent;
-
-            r = uv_fs_scandir_next(req, &ent);
-            if (r == UV_EOF)
-              break;
-            if (r != 0) {
-              argv[0] = UVException(r,
-                                    nullptr,
-                                    req_wrap->syscall(),
-                                    static_cast<const char*>(req->path));
-              break;
-            }
-
-            Local<String> name = String::NewFromUtf8(env->isolate(),
-                                                     ent.name);
-            names->Set(i, name);
+          int r = BuildDirents(env, req, false, &argv[1]);
+          if (r != 0) {
+            argv[0] = UVException(r,
+                                  nullptr,
+                                  req_wrap->syscall(),
+                                  static_cast<const char*>(req->path));
+            argc = 1;
           }
-
-          argv[1] = names;
         }
         break;
 
@@ -248,6 +334,74 @@ static void After(uv_fs_t *req) {
   req_wrap->Dispose();
 }
 
+// Completion callback for readdir() with entry types.
+static void AfterScandirWithTypes(uv_fs_t* req) {
+  FSReqWrap* req_wrap = static_cast<FSReqWrap*>(req->data);
+  CHECK_EQ(&req_wrap->req_, req);
+  req_wrap->ReleaseEarly();
+
+  Environment* env = req_wrap->env();
+  HandleScope handle_scope(env->isolate());
+  Context::Scope context_scope(env->context());
+
+  int argc = 1;
+  Local<Value> argv[2];
+
+  int err = req->result;
+  if (err >= 0)
+    err = BuildDirents(env, req, true, &argv[1]);
+
+  if (err < 0) {
+    argv[0] = UVException(env->isolate(),
+                          err,
+                          req_wrap->syscall(),
+                          nullptr,
+                          req->path,
+                          req_wrap->data());
+  } else {
+    argv[0] = Null(env->isolate());
+    argc = 2;
+  }
+
+  req_wrap->MakeCallback(env->oncomplete_string(), argc, argv);
+
+  uv_fs_req_cleanup(&req_wrap->req_);
+  req_wrap->Dispose();
+}
+
+// Completion callback for stat(), lstat() and fstat() in lazy mode.  Rather
+// than building a fs.Stats object, it stores the results in the shared
+// fs_stats_field_array() and leaves it to JS to pick them up.
+static void AfterStatFields(uv_fs_t* req) {
+  FSReqWrap* req_wrap = static_cast<FSReqWrap*>(req->data);
+  CHECK_EQ(&req_wrap->req_, req);
+  req_wrap->ReleaseEarly();
+
+  Environment* env = req_wrap->env();
+  HandleScope handle_scope(env->isolate());
+  Context::Scope context_scope(env->context());
+
+  Local<Value> argv[1];
+
+  if (req->result < 0) {
+    argv[0] = UVException(env->isolate(),
+                          req->result,
+                          req_wrap->syscall(),
+                          nullptr,
+                          req->path,
+                          req_wrap->data());
+  } else {
+    FillStatFields(static_cast<const uv_stat_t*>(req->ptr),
+                   env->fs_stats_field_array());
+    argv[0] = Null(env->isolate());
+  }
+
+  req_wrap->MakeCallback(env->oncomplete_string(), ARRAY_SIZE(argv), argv);
+
+  uv_fs_req_cleanup(&req_wrap->req_);
+  req_wrap->Dispose();
+}
+
 // This struct is only used on sync fs calls.
 // For async calls FSReqWrap is used.
 struct fs_req_wrap {
@@ -258,23 +412,26 @@ struct fs_req_wrap {
 };
 
 
-#define ASYNC_DEST_CALL(func, req, dest, ...)                                 \
+#define ASYNC_DEST_CALL_AFTER(func, after, req, dest, ...)                    \
   Environment* env = Environment::GetCurrent(args);                           \
   CHECK(req->IsObject());                                                     \
   FSReqWrap* req_wrap = FSReqWrap::New(env, req.As<Object>(), #func, dest);   \
   int err = uv_fs_ ## func(env->event_loop(),                                 \
                            &req_wrap->req_,                                   \
                            __VA_ARGS__,                                       \
-                           After);                                            \
+                           after);                                            \
   req_wrap->Dispatched();                                                     \
   if (err < 0) {                                                              \
     uv_fs_t* uv_req = &req_wrap->req_;                                        \
     uv_req->result = err;                                                     \
     uv_req->path = nullptr;                                                   \
-    After(uv_req);                                                            \
+    after(uv_req);                                                            \
   }                                                                           \
   args.GetReturnValue().Set(req_wrap->persistent());
 
+#define ASYNC_DEST_CALL(func, req, dest, ...)                                 \
+  ASYNC_DEST_CALL_AFTER(func, After, req, dest, __VA_ARGS__)                  \
+
 #define ASYNC_CALL(func, req, ...)                                            \
   ASYNC_DEST_CALL(func, req, nullptr, __VA_ARGS__)                            \
 
@@ -443,12 +600,21 @@ static void Stat(const FunctionCallbackInfo<Value>& args) {
 
   node::Utf8Value path(env->isolate(), args[0]);
 
+  const bool lazy = args[2]->IsTrue();
+
   if (args[1]->IsObject()) {
-    ASYNC_CALL(stat, args[1], *path)
+    if (lazy) {
+      ASYNC_DEST_CALL_AFTER(stat, AfterStatFields, args[1], nullptr, *path)
+    } else {
+      ASYNC_CALL(stat, args[1], *path)
+    }
   } else {
     SYNC_CALL(stat, *path, *path)
-    args.GetReturnValue().Set(
-        BuildStatsObject(env, static_cast<const uv_stat_t*>(SYNC_REQ.ptr)));
+    const uv_stat_t* s = static_cast<const uv_stat_t*>(SYNC_REQ.ptr);
+    if (lazy)
+      FillStatFields(s, env->fs_stats_field_array());
+    else
+      args.GetReturnValue().Set(BuildStatsObject(env, s));
   }
 }
 
@@ -462,12 +628,21 @@ static void LStat(const FunctionCallbackInfo<Value>& args) {
 
   node::Utf8Value path(env->isolate(), args[0]);
 
+  const bool lazy = args[2]->IsTrue();
+
   if (args[1]->IsObject()) {
-    ASYNC_CALL(lstat, args[1], *path)
+    if (lazy) {
+      ASYNC_DEST_CALL_AFTER(lstat, AfterStatFields, args[1], nullptr, *path)
+    } else {
+      ASYNC_CALL(lstat, args[1], *path)
+    }
   } else {
     SYNC_CALL(lstat, *path, *path)
-    args.GetReturnValue().Set(
-        BuildStatsObject(env, static_cast<const uv_stat_t*>(SYNC_REQ.ptr)));
+    const uv_stat_t* s = static_cast<const uv_stat_t*>(SYNC_REQ.ptr);
+    if (lazy)
+      FillStatFields(s, env->fs_stats_field_array());
+    else
+      args.GetReturnValue().Set(BuildStatsObject(env, s));
   }
 }
 
@@ -480,12 +655,195 @@ static void FStat(const FunctionCallbackInfo<Value>& args) {
 
   int fd = args[0]->Int32Value();
 
+  const bool lazy = args[2]->IsTrue();
+
   if (args[1]->IsObject()) {
-    ASYNC_CALL(fstat, args[1], fd)
+    if (lazy) {
+      ASYNC_DEST_CALL_AFTER(fstat, AfterStatFields, args[1], nullptr, fd)
+    } else {
+      ASYNC_CALL(fstat, args[1], fd)
+    }
   } else {
     SYNC_CALL(fstat, 0, fd)
-    args.GetReturnValue().Set(
-        BuildStatsObject(env, static_cast<const uv_stat_t*>(SYNC_REQ.ptr)));
+    const uv_stat_t* s = static_cast<const uv_stat_t*>(SYNC_REQ.ptr);
+    if (lazy)
+      FillStatFields(s, env->fs_stats_field_array());
+    else
+      args.GetReturnValue().Set(BuildStatsObject(env, s));
+  }
+}
+
+// fs.statMany() stats a whole list of paths in a single threadpool work
+// item and writes the results into a Float64Array, kStatManyFields slots
+// per path: the libuv error code (0 on success) followed by the numeric
+// fields from FillStatFields().
+static const size_t kStatManyFields = 15;
+
+class StatManyReqWrap : public ReqWrap<uv_work_t> {
+ public:
+  StatManyReqWrap(Environment* env,
+                  Local<Object> req,
+                  char** paths,
+                  uint32_t count,
+                  double* results,
+                  bool lstat)
+      : ReqWrap(env, req, AsyncWrap::PROVIDER_FSREQWRAP),
+        paths_(paths),
+        count_(count),
+        results_(results),
+        lstat_(lstat) {
+    Wrap(object(), this);
+  }
+
+  ~StatManyReqWrap() override {
+    FreePaths(paths_, count_);
+  }
+
+  // Runs the stat calls, either on the threadpool or, for the synchronous
+  // version, on the main thread.
+  static void StatAll(uv_loop_t* loop,
+                      char** paths,
+                      uint32_t count,
+                      double* results,
+                      bool lstat);
+
+  static void FreePaths(char** paths, uint32_t count) {
+    for (uint32_t i = 0; i < count; i++)
+      delete[] paths[i];
+    delete[] paths;
+  }
+
+  inline void Dispatch();
+
+ private:
+  static void DoWork(uv_work_t* req);
+  static void AfterWork(uv_work_t* req, int status);
+
+  char** const paths_;
+  const uint32_t count_;
+  // Points into the Float64Array, which the JS side keeps alive.
+  double* const results_;
+  const bool lstat_;
+
+  DISALLOW_COPY_AND_ASSIGN(StatManyReqWrap);
+};
+
+
+void StatManyReqWrap::StatAll(uv_loop_t* loop,
+                              char** paths,
+                              uint32_t count,
+                              double* results,
+                              bool lstat) {
+  for (uint32_t i = 0; i < count; i++) {
+    double* fields = results + i * kStatManyFields;
+    uv_fs_t req;
+    int err = lstat ? uv_fs_lstat(loop, &req, paths[i], nullptr) :
+                      uv_fs_stat(loop, &req, paths[i], nullptr);
+    fields[0] = err;
+    if (err == 0)
+      FillStatFields(&req.statbuf, fields + 1);
+    uv_fs_req_cleanup(&req);
+  }
+}
+
+
+void StatManyReqWrap::Dispatch() {
+  // DoWork() looks at req_.data on the threadpool, set it up front.
+  Dispatched();
+  int err = uv_queue_work_class(env()->event_loop(),
+                                &req_,
+                                UV_WORK_FS,
+                                DoWork,
+                                AfterWork);
+  // uv_queue_work_class() only fails for a null work_cb or a bad class.
+  CHECK_EQ(err, 0);
+}
+
+
+void StatManyReqWrap::DoWork(uv_work_t* work_req) {
+  StatManyReqWrap* req_wrap = static_cast<StatManyReqWrap*>(work_req->data);
+  // Synchronous uv_fs_*() calls don't touch the loop.
+  StatAll(work_req->loop,
+          req_wrap->paths_,
+          req_wrap->count_,
+          req_wrap->results_,
+          req_wrap->lstat_);
+}
+
+
+void StatManyReqWrap::AfterWork(uv_work_t* work_req, int status) {
+  StatManyReqWrap* req_wrap = static_cast<StatManyReqWrap*>(work_req->data);
+  CHECK_EQ(&req_wrap->req_, work_req);
+  CHECK_EQ(status, 0);  // Nothing cancels these.
+
+  Environment* env = req_wrap->env();
+  HandleScope handle_scope(env->isolate());
+  Context::Scope context_scope(env->context());
+
+  Local<Value> arg = Null(env->isolate());
+  req_wrap->MakeCallback(env->oncomplete_string(), 1, &arg);
+
+  delete req_wrap;
+}
+
+
+/* fs.statMany(paths, results, lstat[, req])
+ *
+ * `results` is a Float64Array with room for kStatManyFields numbers per
+ * path.  Failing paths don't fail the call, they get their error code in
+ * the first slot.
+ */
+static void StatMany(const FunctionCallbackInfo<Value>& args) {
+  Environment* env = Environment::GetCurrent(args);
+
+  if (args.Length() < 3)
+    return THROW_BAD_ARGS;
+  if (!args[0]->IsArray())
+    return TYPE_ERROR("paths must be an array");
+  if (!args[1]->IsFloat64Array())
+    return TYPE_ERROR("results must be a Float64Array");
+
+  Local<Array> path_list = args[0].As<Array>();
+  Local<Object> results_obj = args[1].As<Object>();
+  const uint32_t count = path_list->Length();
+
+  // Typed arrays that big are never allocated on the V8 heap, their memory
+  // doesn't move and can be written from the threadpool.
+  CHECK(results_obj->HasIndexedPropertiesInExternalArrayData());
+  CHECK_GE(results_obj->GetIndexedPropertiesExternalArrayDataLength(),
+           static_cast<int>(count * kStatManyFields));
+  double* results = static_cast<double*>(
+      results_obj->GetIndexedPropertiesExternalArrayData());
+
+  char** paths = new char*[count];
+  for (uint32_t i = 0; i < count; i++) {
+    Local<Value> path = path_list->Get(i);
+    if (!path->IsString()) {
+      StatManyReqWrap::FreePaths(paths, i);
+      return TYPE_ERROR("path must be a string");
+    }
+    node::Utf8Value path_value(env->isolate(), path);
+    paths[i] = new char[path_value.length() + 1];
+    memcpy(paths[i], *path_value, path_value.length() + 1);
+  }
+
+  if (args[3]->IsObject()) {
+    StatManyReqWrap* req_wrap = new StatManyReqWrap(env,
+                                                    args[3].As<Object>(),
+                                                    paths,
+                                                    count,
+                                                    results,
+                                                    args[2]->IsTrue());
+    req_wrap->Dispatch();
+    args.GetReturnValue().Set(req_wrap->persistent());
+  } else {
+    env->PrintSyncTrace();
+    StatManyReqWrap::StatAll(env->event_loop(),
+                             paths,
+                             count,
+                             results,
+                             args[2]->IsTrue());
+    StatManyReqWrap::FreePaths(paths, count);
   }
 }
 
@@ -710,31 +1068,25 @@ static void ReadDir(const FunctionCallbackInfo<Value>& args) {
     return TYPE_ERROR("path must be a string");
 
   node::Utf8Value path(env->isolate(), args[0]);
+  const bool with_types = args[2]->IsTrue();
 
   if (args[1]->IsObject()) {
-    ASYNC_CALL(scandir, args[1], *path, 0 /*flags*/)
+    if (with_types) {
+      ASYNC_DEST_CALL_AFTER(scandir, AfterScandirWithTypes, args[1], nullptr,
+                            *path, 0 /*flags*/)
+    } else {
+      ASYNC_CALL(scandir, args[1], *path, 0 /*flags*/)
+    }
   } else {
     SYNC_CALL(scandir, *path, *path, 0 /*flags*/)
 
     CHECK_GE(SYNC_REQ.result, 0);
-    int r;
-    Local<Array> names = Array::New(env->isolate(), 0);
-
-    for (int i = 0; ; i++) {
-      uv_dirent_t ent;
-
-      r = uv_fs_scandir_next(&SYNC_REQ, &ent);
-      if (r == UV_EOF)
-        break;
-      if (r != 0)
-        return env->ThrowUVException(r, "readdir", "", *path);
-
-      Local<String> name = String::NewFromUtf8(env->isolate(),
-                                               ent.name);
-      names->Set(i, name);
-    }
+    Local<Value> result;
+    int r = BuildDirents(env, &SYNC_REQ, with_types, &result);
+    if (r != 0)
+      return env->ThrowUVException(r, "readdir", "", *path);
 
-    args.GetReturnValue().Set(names);
+    args.GetReturnValue().Set(result);
   }
 }
 
@@ -952,6 +1304,431 @@ static void Read(const FunctionCallbackInfo<Value>& args) {
 }
 
 
+// Turns the array of Buffers that readBuffers() and writeBuffers() take into
+// a list of uv_buf_t's.  Only the first kMaxBuffers are used because readv()
+// and writev() reject anything longer than IOV_MAX, callers have to deal with
+// partial reads and writes anyway.
+class BufferList {
+ public:
+  static const uint32_t kMaxBuffers = 1024;
+
+  BufferList() : bufs_(bufs_storage_), count_(0) {}
+
+  ~BufferList() {
+    if (bufs_ != bufs_storage_)
+      delete[] bufs_;
+  }
+
+  // Returns false if not all elements are Buffers.
+  bool Init(Local<Array> chunks) {
+    count_ = MIN(chunks->Length(), kMaxBuffers);
+    if (count_ > ARRAY_SIZE(bufs_storage_))
+      bufs_ = new uv_buf_t[count_];
+
+    for (uint32_t i = 0; i < count_; i++) {
+      Local<Value> chunk = chunks->Get(i);
+      if (!Buffer::HasInstance(chunk))
+        return false;
+      bufs_[i] = uv_buf_init(Buffer::Data(chunk), Buffer::Length(chunk));
+    }
+
+    return true;
+  }
+
+  uv_buf_t* bufs() const { return bufs_; }
+  uint32_t count() const { return count_; }
+
+ private:
+  uv_buf_t bufs_storage_[16];
+  uv_buf_t* bufs_;
+  uint32_t count_;
+
+  DISALLOW_COPY_AND_ASSIGN(BufferList);
+};
+
+
+// Wrapper for writev(2).
+//
+// 0 fd        integer. file descriptor
+// 1 buffers   array of buffers to write
+// 2 position  if integer, position to write at in the file.
+//             if null, write from the current position
+static void WriteBuffers(const FunctionCallbackInfo<Value>& args) {
+  Environment* env = Environment::GetCurrent(args);
+
+  if (!args[0]->IsInt32())
+    return env->ThrowTypeError("First argument must be file descriptor");
+  if (!args[1]->IsArray())
+    return env->ThrowTypeError("Second argument must be an array of buffers");
+
+  int fd = args[0]->Int32Value();
+  int64_t pos = GET_OFFSET(args[2]);
+  Local<Value> req = args[3];
+
+  BufferList list;
+  if (!list.Init(args[1].As<Array>()))
+    return env->ThrowTypeError("Array elements all need to be buffers");
+
+  if (req->IsObject()) {
+    ASYNC_CALL(write, req, fd, list.bufs(), list.count(), pos)
+    return;
+  }
+
+  SYNC_CALL(write, nullptr, fd, list.bufs(), list.count(), pos)
+  args.GetReturnValue().Set(SYNC_RESULT);
+}
+
+
+// Wrapper for readv(2).
+//
+// 0 fd        integer. file descriptor
+// 1 buffers   array of buffers to read into, filled in order
+// 2 position  file position - null for current position
+static void ReadBuffers(const FunctionCallbackInfo<Value>& args) {
+  Environment* env = Environment::GetCurrent(args);
+
+  if (!args[0]->IsInt32())
+    return env->ThrowTypeError("First argument must be file descriptor");
+  if (!args[1]->IsArray())
+    return env->ThrowTypeError("Second argument must be an array of buffers");
+
+  int fd = args[0]->Int32Value();
+  int64_t pos = GET_OFFSET(args[2]);
+  Local<Value> req = args[3];
+
+  BufferList list;
+  if (!list.Init(args[1].As<Array>()))
+    return env->ThrowTypeError("Array elements all need to be buffers");
+
+  if (req->IsObject()) {
+    ASYNC_CALL(read, req, fd, list.bufs(), list.count(), pos)
+    return;
+  }
+
+  SYNC_CALL(read, 0, fd, list.bufs(), list.count(), pos)
+  args.GetReturnValue().Set(SYNC_RESULT);
+}
+
+
+// Backs fs.readFile() and fs.writeFile().  The whole open/fstat/read/close
+// (or open/write/close) sequence runs as a single work item on the
+// threadpool, instead of making a round trip to the main thread after
+// every step like the FSReqWrap-based calls do.
+class FileWorkReqWrap : public ReqWrap<uv_work_t> {
+ public:
+  enum Type { READ, WRITE };
+
+  FileWorkReqWrap(Environment* env,
+                  Local<Object> req,
+                  Type type,
+                  const char* path,
+                  int flags)
+      : ReqWrap(env, req, AsyncWrap::PROVIDER_FSREQWRAP),
+        type_(type),
+        path_(strdup(path)),
+        flags_(flags),
+        mode_(0),
+        position_(-1),
+        data_(nullptr),
+        length_(0),
+        err_(0),
+        syscall_(nullptr),
+        too_large_(false) {
+    Wrap(object(), this);
+  }
+
+  ~FileWorkReqWrap() override {
+    free(path_);
+    if (type_ == READ)
+      free(data_);
+  }
+
+  // For WRITE requests, the caller keeps `data` alive until completion.
+  void SetContents(char* data, size_t length, int mode, int64_t position) {
+    CHECK_EQ(type_, WRITE);
+    data_ = data;
+    length_ = length;
+    mode_ = mode;
+    position_ = position;
+  }
+
+  inline void Dispatch();
+
+ private:
+  void Fail(int err, const char* syscall) {
+    if (err_ == 0) {
+      err_ = err;
+      syscall_ = syscall;
+    }
+  }
+
+  void ReadAll(uv_loop_t* loop, int fd);
+  void WriteAll(uv_loop_t* loop, int fd);
+
+  static void DoWork(uv_work_t* req);
+  static void AfterWork(uv_work_t* req, int status);
+
+  const Type type_;
+  char* const path_;
+  const int flags_;
+  int mode_;
+  int64_t position_;
+  // Contents of the file for READ, owned by us until it is handed over to
+  // a Buffer.  Points into the (persistent) source Buffer for WRITE.
+  char* data_;
+  size_t length_;
+  int err_;
+  const char* syscall_;
+  bool too_large_;
+
+  DISALLOW_COPY_AND_ASSIGN(FileWorkReqWrap);
+};
+
+
+void FileWorkReqWrap::Dispatch() {
+  // DoWork() looks at req_.data on the threadpool, set it up front.
+  Dispatched();
+  int err = uv_queue_work_class(env()->event_loop(),
+                                &req_,
+                                UV_WORK_FS,
+                                DoWork,
+                                AfterWork);
+  // uv_queue_work_class() only fails for a null work_cb or a bad class.
+  CHECK_EQ(err, 0);
+}
+
+
+void FileWorkReqWrap::ReadAll(uv_loop_t* loop, int fd) {
+  // Regular files are read in a single go, everything else (pipes, character
+  // devices, files in /proc that report a zero size) is read until EOF.
+  static const size_t kChunkSize = 8 * 1024;
+
+  uv_fs_t req;
+  int err = uv_fs_fstat(loop, &req, fd, nullptr);
+  const uv_stat_t& s = req.statbuf;
+  uint64_t size = 0;
+  if (err == 0 && (s.st_mode & S_IFMT) == S_IFREG)
+    size = s.st_size;
+  uv_fs_req_cleanup(&req);
+
+  if (err < 0)
+    return Fail(err, "fstat");
+
+  if (size > Buffer::kMaxLength) {
+    too_large_ = true;
+    return;
+  }
+
+  const bool known_size = (size != 0);
+  size_t capacity = known_size ? size : kChunkSize;
+  char* data = static_cast<char*>(malloc(capacity));
+  CHECK_NE(data, nullptr);
+  size_t length = 0;
+
+  for (;;) {
+    if (length == capacity) {
+      if (known_size)
+        break;
+      if (capacity == Buffer::kMaxLength) {
+        too_large_ = true;
+        break;
+      }
+      capacity = MIN(2 * capacity, Buffer::kMaxLength);
+      data = static_cast<char*>(realloc(data, capacity));
+      CHECK_NE(data, nullptr);
+    }
+
+    uv_buf_t buf = uv_buf_init(data + length, capacity - length);
+    int nread = uv_fs_read(loop, &req, fd, &buf, 1, -1, nullptr);
+    uv_fs_req_cleanup(&req);
+
+    if (nread < 0) {
+      Fail(nread, "read");
+      break;
+    }
+    if (nread == 0)
+      break;
+    length += nread;
+  }
+
+  if (err_ < 0 || too_large_ || length == 0) {
+    free(data);
+    return;
+  }
+
+  // Don't hold on to the slack of the growth strategy for the lifetime of
+  // the Buffer.
+  if (length < capacity)
+    data = static_cast<char*>(realloc(data, length));
+
+  data_ = data;
+  length_ = length;
+}
+
+
+void FileWorkReqWrap::WriteAll(uv_loop_t* loop, int fd) {
+  uv_fs_t req;
+  size_t offset = 0;
+  int64_t position = position_;
+
+  while (offset < length_) {
+    uv_buf_t buf = uv_buf_init(data_ + offset, length_ - offset);
+    int nwritten = uv_fs_write(loop, &req, fd, &buf, 1, position, nullptr);
+    uv_fs_req_cleanup(&req);
+
+    if (nwritten < 0)
+      return Fail(nwritten, "write");
+
+    offset += nwritten;
+    if (position >= 0)
+      position += nwritten;
+  }
+}
+
+
+void FileWorkReqWrap::DoWork(uv_work_t* work_req) {
+  FileWorkReqWrap* req_wrap = static_cast<FileWorkReqWrap*>(work_req->data);
+  // Synchronous uv_fs_*() calls don't touch the loop, it's safe to pass it
+  // in from the threadpool.
+  uv_loop_t* loop = work_req->loop;
+  uv_fs_t req;
+
+  int mode = req_wrap->type_ == READ ? 0666 : req_wrap->mode_;
+  int fd = uv_fs_open(loop, &req, req_wrap->path_, req_wrap->flags_, mode,
+                      nullptr);
+  uv_fs_req_cleanup(&req);
+
+  if (fd < 0)
+    return req_wrap->Fail(fd, "open");
+
+  if (req_wrap->type_ == READ)
+    req_wrap->ReadAll(loop, fd);
+  else
+    req_wrap->WriteAll(loop, fd);
+
+  int err = uv_fs_close(loop, &req, fd, nullptr);
+  uv_fs_req_cleanup(&req);
+
+  if (err < 0)
+    req_wrap->Fail(err, "close");
+}
+
+
+void FileWorkReqWrap::AfterWork(uv_work_t* work_req, int status) {
+  FileWorkReqWrap* req_wrap = static_cast<FileWorkReqWrap*>(work_req->data);
+  CHECK_EQ(&req_wrap->req_, work_req);
+  CHECK_EQ(status, 0);  // Nothing cancels these.
+
+  Environment* env = req_wrap->env();
+  HandleScope handle_scope(env->isolate());
+  Context::Scope context_scope(env->context());
+
+  int argc = 1;
+  Local<Value> argv[2];
+
+  if (req_wrap->too_large_) {
+    char message[64];
+    snprintf(message,
+             sizeof(message),
+             "File size is greater than possible Buffer: 0x%x bytes",
+             Buffer::kMaxLength);
+    argv[0] = Exception::RangeError(OneByteString(env->isolate(), message));
+  } else if (req_wrap->err_ < 0) {
+    argv[0] = UVException(env->isolate(),
+                          req_wrap->err_,
+                          req_wrap->syscall_,
+                          nullptr,
+                          req_wrap->path_);
+  } else {
+    argv[0] = Null(env->isolate());
+    if (req_wrap->type_ == READ) {
+      if (req_wrap->data_ == nullptr) {
+        argv[1] = Buffer::New(env, static_cast<size_t>(0));
+      } else {
+        argv[1] = Buffer::Use(env, req_wrap->data_, req_wrap->length_);
+        req_wrap->data_ = nullptr;
+      }
+      argc = 2;
+    }
+  }
+
+  req_wrap->MakeCallback(env->oncomplete_string(), argc, argv);
+
+  delete req_wrap;
+}
+
+
+/* fs.readFile(path, flags, req)
+ *
+ * Opens, reads and closes `path` on the threadpool in one go and passes a
+ * Buffer with the file's contents to req.oncomplete.
+ */
+static void ReadFile(const FunctionCallbackInfo<Value>& args) {
+  Environment* env = Environment::GetCurrent(args);
+
+  if (args.Length() < 3)
+    return THROW_BAD_ARGS;
+  if (!args[0]->IsString())
+    return TYPE_ERROR("path must be a string");
+  if (!args[1]->IsInt32())
+    return TYPE_ERROR("flags must be an int");
+  CHECK(args[2]->IsObject());
+
+  node::Utf8Value path(env->isolate(), args[0]);
+  int flags = args[1]->Int32Value();
+
+  FileWorkReqWrap* req_wrap =
+      new FileWorkReqWrap(env,
+                          args[2].As<Object>(),
+                          FileWorkReqWrap::READ,
+                          *path,
+                          flags);
+  req_wrap->Dispatch();
+  args.GetReturnValue().Set(req_wrap->persistent());
+}
+
+
+/* fs.writeFile(path, buffer, flags, mode, position, req)
+ *
+ * Opens `path`, writes all of `buffer` starting at `position` (-1 for the
+ * current file position) and closes it again, all on the threadpool.
+ */
+static void WriteFile(const FunctionCallbackInfo<Value>& args) {
+  Environment* env = Environment::GetCurrent(args);
+
+  if (args.Length() < 6)
+    return THROW_BAD_ARGS;
+  if (!args[0]->IsString())
+    return TYPE_ERROR("path must be a string");
+  if (!Buffer::HasInstance(args[1]))
+    return TYPE_ERROR("data must be a buffer");
+  if (!args[2]->IsInt32())
+    return TYPE_ERROR("flags must be an int");
+  if (!args[3]->IsInt32())
+    return TYPE_ERROR("mode must be an int");
+  CHECK(args[5]->IsObject());
+
+  node::Utf8Value path(env->isolate(), args[0]);
+  Local<Object> buffer_obj = args[1].As<Object>();
+  int flags = args[2]->Int32Value();
+
+  FileWorkReqWrap* req_wrap =
+      new FileWorkReqWrap(env,
+                          args[5].As<Object>(),
+                          FileWorkReqWrap::WRITE,
+                          *path,
+                          flags);
+  req_wrap->SetContents(Buffer::Data(buffer_obj),
+                        Buffer::Length(buffer_obj),
+                        args[3]->Int32Value(),
+                        GET_OFFSET(args[4]));
+  // Keep the buffer alive while the threadpool is writing it out.
+  req_wrap->object()->Set(env->buffer_string(), buffer_obj);
+  req_wrap->Dispatch();
+  args.GetReturnValue().Set(req_wrap->persistent());
+}
+
+
 /* fs.chmod(path, mode);
  * Wrapper for chmod(1) / EIO_CHMOD
  */
@@ -1126,6 +1903,15 @@ void InitFs(Handle<Object> target,
             void* priv) {
   Environment* env = Environment::GetCurrent(context);
 
+  // Where stat(), lstat() and fstat() leave their results in lazy mode.
+  Local<Object> stat_values = Object::New(env->isolate());
+  stat_values->SetIndexedPropertiesToExternalArrayData(
+      env->fs_stats_field_array(),
+      kExternalFloat64Array,
+      Environment::kFsStatsFieldsCount);
+  target->Set(FIXED_ONE_BYTE_STRING(env->isolate(), "statValues"),
+              stat_values);
+
   // Function which creates a new Stats object.
   target->Set(FIXED_ONE_BYTE_STRING(env->isolate(), "FSInitialize"),
               env->NewFunctionTemplate(FSInitialize)->GetFunction());
@@ -1144,12 +1930,17 @@ void InitFs(Handle<Object> target,
   env->SetMethod(target, "stat", Stat);
   env->SetMethod(target, "lstat", LStat);
   env->SetMethod(target, "fstat", FStat);
+  env->SetMethod(target, "statMany", StatMany);
   env->SetMethod(target, "link", Link);
   env->SetMethod(target, "symlink", Symlink);
   env->SetMethod(target, "readlink", ReadLink);
   env->SetMethod(target, "unlink", Unlink);
   env->SetMethod(target, "writeBuffer", WriteBuffer);
   env->SetMethod(target, "writeString", WriteString);
+  env->SetMethod(target, "writeBuffers", WriteBuffers);
+  env->SetMethod(target, "readBuffers", ReadBuffers);
+  env->SetMethod(target, "readFile", ReadFile);
+  env->SetMethod(target, "writeFile", WriteFile);
 
   env->SetMethod(target, "chmod", Chmod);
   env->SetMethod(target, "fchmod", FChmod);
@@ -1,17 +1,19 @@
 #include "node.h"
 #include "node_buffer.h"
 #include "node_http_parser.h"
+#include "node_internals.h"
 
 #include "base-object.h"
 #include "base-object-inl.h"
 #include "env.h"
 #include "env-inl.h"
+#include "stream_base.h"
 #include "util.h"
 #include "util-inl.h"
 #include "v8.h"
 
 #include <stdlib.h>  // free()
-#include <string.h>  // strdup()
+#include <string.h>  // strdup(), memcmp()
 
 #if defined(_MSC_VER)
 #define strcasecmp _stricmp
@@ -29,6 +31,11 @@
 //     ...
 // No copying is performed when slicing the buffer, only small reference
 // allocations.
+//
+// Alternatively, parser.consume() takes over the read callbacks of a
+// StreamBase so that incoming data is fed to http_parser_execute() without
+// a round trip through JS land. parser[kOnExecute] is then invoked once
+// per read with the result that parser.execute() would have returned.
 
 
 namespace node {
@@ -36,7 +43,9 @@ namespace node {
 using v8::Array;
 using v8::Boolean;
 using v8::Context;
+using v8::EscapableHandleScope;
 using v8::Exception;
+using v8::External;
 using v8::Function;
 using v8::FunctionCallbackInfo;
 using v8::FunctionTemplate;
@@ -54,6 +63,7 @@ const uint32_t kOnHeaders = 0;
 const uint32_t kOnHeadersComplete = 1;
 const uint32_t kOnBody = 2;
 const uint32_t kOnMessageComplete = 3;
+const uint32_t kOnExecute = 4;
 
 
 #define HTTP_CB(name)                                                         \
@@ -109,6 +119,18 @@ struct StringPtr {
   }
 
 
+  // Hands the string over to |other|, leaving this one empty.
+  void MoveTo(StringPtr* other) {
+    other->Reset();
+    other->str_ = str_;
+    other->on_heap_ = on_heap_;
+    other->size_ = size_;
+    str_ = nullptr;
+    on_heap_ = false;
+    size_ = 0;
+  }
+
+
   void Update(const char* str, size_t size) {
     if (str_ == nullptr)
       str_ = str;
@@ -144,12 +166,37 @@ struct StringPtr {
 };
 
 
+// Spellings of the header names in PER_ISOLATE_HTTP_HEADER_NAMES, indexed
+// like Environment::http_header_name().
+struct HeaderName {
+  const char* name;
+  size_t length;
+};
+
+static const HeaderName header_names[] = {
+#define V(PropertyName, Name, LowercaseName)                                  \
+  { Name, sizeof(Name) - 1 },                                                 \
+  { LowercaseName, sizeof(LowercaseName) - 1 },
+  PER_ISOLATE_HTTP_HEADER_NAMES(V)
+#undef V
+};
+
+
 class Parser : public BaseObject {
  public:
   Parser(Environment* env, Local<Object> wrap, enum http_parser_type type)
       : BaseObject(env, wrap),
+        fields_(new StringPtr[kInitialHeaderSlots]),
+        values_(new StringPtr[kInitialHeaderSlots]),
+        header_slots_(kInitialHeaderSlots),
         current_buffer_len_(0),
-        current_buffer_data_(nullptr) {
+        current_buffer_data_(nullptr),
+        prev_alloc_cb_(nullptr),
+        prev_alloc_ctx_(nullptr),
+        prev_read_cb_(nullptr),
+        prev_read_ctx_(nullptr),
+        in_on_execute_(false),
+        pending_close_(false) {
     Wrap(object(), this);
     Init(type);
   }
@@ -158,6 +205,8 @@ class Parser : public BaseObject {
   ~Parser() override {
     ClearWrap(object());
     persistent().Reset();
+    delete[] fields_;
+    delete[] values_;
   }
 
 
@@ -185,7 +234,7 @@ class Parser : public BaseObject {
     if (num_fields_ == num_values_) {
       // start of new field name
       num_fields_++;
-      if (num_fields_ == ARRAY_SIZE(fields_)) {
+      if (num_fields_ == header_slots_ && !GrowHeaders()) {
         // ran out of space - flush to javascript land
         Flush();
         num_fields_ = 1;
@@ -194,7 +243,7 @@ class Parser : public BaseObject {
       fields_[num_fields_ - 1].Reset();
     }
 
-    CHECK_LT(num_fields_, static_cast<int>(ARRAY_SIZE(fields_)));
+    CHECK_LT(num_fields_, header_slots_);
     CHECK_EQ(num_fields_, num_values_ + 1);
 
     fields_[num_fields_ - 1].Update(at, length);
@@ -210,7 +259,7 @@ class Parser : public BaseObject {
       values_[num_values_ - 1].Reset();
     }
 
-    CHECK_LT(num_values_, static_cast<int>(ARRAY_SIZE(values_)));
+    CHECK_LT(num_values_, header_slots_);
     CHECK_EQ(num_values_, num_fields_);
 
     values_[num_values_ - 1].Update(at, length);
@@ -295,6 +344,13 @@ class Parser : public BaseObject {
 
 
   HTTP_DATA_CB(on_body) {
+    // Data read by a consumed stream has no JS buffer backing it yet.
+    // Create it in the caller's scope so that it outlives this callback.
+    if (current_buffer_.IsEmpty()) {
+      current_buffer_ =
+          Buffer::New(env(), current_buffer_data_, current_buffer_len_);
+    }
+
     HandleScope scope(env()->isolate());
 
     Local<Object> obj = object();
@@ -326,6 +382,13 @@ class Parser : public BaseObject {
     if (num_fields_)
       Flush();  // Flush trailing HTTP headers.
 
+    num_fields_ = 0;
+    num_values_ = 0;
+
+    // Don't let one message with many headers keep the large arrays around
+    // in a keep-alive connection or in the parser free list.
+    ShrinkHeaders();
+
     Local<Object> obj = object();
     Local<Value> cb = obj->Get(kOnMessageComplete);
 
@@ -354,7 +417,12 @@ class Parser : public BaseObject {
 
   static void Close(const FunctionCallbackInfo<Value>& args) {
     Parser* parser = Unwrap<Parser>(args.Holder());
-    delete parser;
+    // Deleting the parser from within parser[kOnExecute] would pull the rug
+    // from under OnReadImpl(), let it clean up when the callback returns.
+    if (parser->in_on_execute_)
+      parser->pending_close_ = true;
+    else
+      delete parser;
   }
 
 
@@ -374,8 +442,6 @@ class Parser : public BaseObject {
 
   // var bytesParsed = parser->execute(buffer);
   static void Execute(const FunctionCallbackInfo<Value>& args) {
-    Environment* env = Environment::GetCurrent(args);
-
     Parser* parser = Unwrap<Parser>(args.Holder());
     CHECK(parser->current_buffer_.IsEmpty());
     CHECK_EQ(parser->current_buffer_len_, 0);
@@ -390,40 +456,11 @@ class Parser : public BaseObject {
     // amount of overhead. Nothing else will run while http_parser_execute()
     // runs, therefore this pointer can be set and used for the execution.
     parser->current_buffer_ = buffer_obj;
-    parser->current_buffer_len_ = buffer_len;
-    parser->current_buffer_data_ = buffer_data;
-    parser->got_exception_ = false;
-
-    size_t nparsed =
-      http_parser_execute(&parser->parser_, &settings, buffer_data, buffer_len);
-
-    parser->Save();
-
-    // Unassign the 'buffer_' variable
-    parser->current_buffer_.Clear();
-    parser->current_buffer_len_ = 0;
-    parser->current_buffer_data_ = nullptr;
-
-    // If there was an exception in one of the callbacks
-    if (parser->got_exception_)
-      return;
-
-    Local<Integer> nparsed_obj = Integer::New(env->isolate(), nparsed);
-    // If there was a parse error in one of the callbacks
-    // TODO(bnoordhuis) What if there is an error on EOF?
-    if (!parser->parser_.upgrade && nparsed != buffer_len) {
-      enum http_errno err = HTTP_PARSER_ERRNO(&parser->parser_);
 
-      Local<Value> e = Exception::Error(env->parse_error_string());
-      Local<Object> obj = e->ToObject(env->isolate());
-      obj->Set(env->bytes_parsed_string(), nparsed_obj);
-      obj->Set(env->code_string(),
-               OneByteString(env->isolate(), http_errno_name(err)));
+    Local<Value> ret = parser->Execute(buffer_data, buffer_len);
 
-      args.GetReturnValue().Set(e);
-    } else {
-      args.GetReturnValue().Set(nparsed_obj);
-    }
+    if (!ret.IsEmpty())
+      args.GetReturnValue().Set(ret);
   }
 
 
@@ -468,6 +505,68 @@ class Parser : public BaseObject {
   }
 
 
+  // parser.consume(stream._externalStream)
+  static void Consume(const FunctionCallbackInfo<Value>& args) {
+    Parser* parser = Unwrap<Parser>(args.Holder());
+    CHECK(args[0]->IsExternal());
+    CHECK_EQ(parser->prev_read_cb_, nullptr);
+
+    Local<External> stream_obj = args[0].As<External>();
+    StreamBase* stream = static_cast<StreamBase*>(stream_obj->Value());
+    CHECK_NE(stream, nullptr);
+
+    stream->Consume();
+
+    parser->prev_alloc_cb_ = stream->alloc_cb();
+    parser->prev_alloc_ctx_ = stream->alloc_ctx();
+    parser->prev_read_cb_ = stream->read_cb();
+    parser->prev_read_ctx_ = stream->read_ctx();
+
+    stream->set_alloc_cb(OnAllocImpl, parser);
+    stream->set_read_cb(OnReadImpl, parser);
+  }
+
+
+  // parser.unconsume([stream._externalStream])
+  // Without an argument the stream is assumed to be gone and the saved
+  // callbacks are simply forgotten.
+  static void Unconsume(const FunctionCallbackInfo<Value>& args) {
+    Parser* parser = Unwrap<Parser>(args.Holder());
+
+    if (parser->prev_read_cb_ == nullptr)
+      return;
+
+    if (args[0]->IsExternal()) {
+      Local<External> stream_obj = args[0].As<External>();
+      StreamBase* stream = static_cast<StreamBase*>(stream_obj->Value());
+      CHECK_NE(stream, nullptr);
+
+      stream->set_alloc_cb(parser->prev_alloc_cb_, parser->prev_alloc_ctx_);
+      stream->set_read_cb(parser->prev_read_cb_, parser->prev_read_ctx_);
+      stream->Unconsume();
+    }
+
+    parser->prev_alloc_cb_ = nullptr;
+    parser->prev_alloc_ctx_ = nullptr;
+    parser->prev_read_cb_ = nullptr;
+    parser->prev_read_ctx_ = nullptr;
+  }
+
+
+  // Returns a copy of the data that is being parsed. Only meaningful from
+  // within parser[kOnExecute], e.g. to get at the head of an upgrade.
+  static void GetCurrentBuffer(const FunctionCallbackInfo<Value>& args) {
+    Environment* env = Environment::GetCurrent(args);
+    Parser* parser = Unwrap<Parser>(args.Holder());
+
+    Local<Object> ret = Buffer::New(env,
+                                    parser->current_buffer_data_,
+                                    parser->current_buffer_len_);
+
+    args.GetReturnValue().Set(ret);
+  }
+
+
   template <bool should_pause>
   static void Pause(const FunctionCallbackInfo<Value>& args) {
     Environment* env = Environment::GetCurrent(args);
@@ -479,6 +578,154 @@ class Parser : public BaseObject {
 
 
  private:
+  Local<Value> Execute(char* data, size_t len) {
+    EscapableHandleScope scope(env()->isolate());
+
+    current_buffer_len_ = len;
+    current_buffer_data_ = data;
+    got_exception_ = false;
+
+    size_t nparsed = http_parser_execute(&parser_, &settings, data, len);
+
+    Save();
+
+    // Unassign the 'buffer_' variable
+    current_buffer_.Clear();
+    current_buffer_len_ = 0;
+    current_buffer_data_ = nullptr;
+
+    // If there was an exception in one of the callbacks
+    if (got_exception_)
+      return scope.Escape(Local<Value>());
+
+    Local<Integer> nparsed_obj = Integer::New(env()->isolate(), nparsed);
+    // If there was a parse error in one of the callbacks
+    // TODO(bnoordhuis) What if there is an error on EOF?
+    if (!parser_.upgrade && nparsed != len) {
+      enum http_errno err = HTTP_PARSER_ERRNO(&parser_);
+
+      Local<Value> e = Exception::Error(env()->parse_error_string());
+      Local<Object> obj = e->ToObject(env()->isolate());
+      obj->Set(env()->bytes_parsed_string(), nparsed_obj);
+      obj->Set(env()->code_string(),
+               OneByteString(env()->isolate(), http_errno_name(err)));
+
+      return scope.Escape(e);
+    }
+
+    return scope.Escape(nparsed_obj);
+  }
+
+
+  static void OnAllocImpl(size_t suggested_size, uv_buf_t* buf, void* ctx) {
+    Parser* parser = static_cast<Parser*>(ctx);
+    Environment* env = parser->env();
+
+    buf->base = env->read_buffer_pool()->Acquire(suggested_size);
+    buf->len = suggested_size;
+
+    if (buf->base == nullptr && suggested_size > 0) {
+      FatalError(
+          "node::Parser::OnAllocImpl(size_t, uv_buf_t*, void*)",
+          "Out Of Memory");
+    }
+  }
+
+
+  static void OnReadImpl(ssize_t nread,
+                         const uv_buf_t* buf,
+                         uv_handle_type pending,
+                         void* ctx) {
+    Parser* parser = static_cast<Parser*>(ctx);
+    Environment* env = parser->env();
+    HandleScope scope(env->isolate());
+
+    if (nread <= 0) {
+      if (buf != nullptr && buf->base != nullptr)
+        env->read_buffer_pool()->Release(buf->base, buf->len);
+
+      // Errors and EOF are for the stream's owner to handle.
+      if (nread < 0) {
+        uv_buf_t tmp_buf;
+        tmp_buf.base = nullptr;
+        tmp_buf.len = 0;
+        parser->prev_read_cb_(nread,
+                              &tmp_buf,
+                              pending,
+                              parser->prev_read_ctx_);
+      }
+      return;
+    }
+
+    Local<Value> ret = parser->Execute(buf->base, nread);
+
+    // Exception, already reported by the message listener.
+    if (ret.IsEmpty()) {
+      env->read_buffer_pool()->Release(buf->base, buf->len);
+      return;
+    }
+
+    Local<Object> obj = parser->object();
+    Local<Value> cb = obj->Get(kOnExecute);
+
+    if (cb->IsFunction()) {
+      // Hooks for GetCurrentBuffer
+      parser->current_buffer_len_ = nread;
+      parser->current_buffer_data_ = buf->base;
+      parser->in_on_execute_ = true;
+
+      MakeCallback(env, obj.As<Value>(), cb.As<Function>(), 1, &ret);
+
+      parser->in_on_execute_ = false;
+      parser->current_buffer_len_ = 0;
+      parser->current_buffer_data_ = nullptr;
+    }
+
+    env->read_buffer_pool()->Release(buf->base, buf->len);
+
+    if (parser->pending_close_)
+      delete parser;
+  }
+
+
+  // Doubles the header arrays so that the headers can be delivered to JS
+  // land in one go instead of being flushed half way through. Returns false
+  // once the arrays have reached kMaxHeaderSlots.
+  bool GrowHeaders() {
+    if (header_slots_ >= kMaxHeaderSlots)
+      return false;
+
+    int slots = 2 * header_slots_;
+    StringPtr* fields = new StringPtr[slots];
+    StringPtr* values = new StringPtr[slots];
+
+    for (int i = 0; i < header_slots_; i++) {
+      fields_[i].MoveTo(&fields[i]);
+      values_[i].MoveTo(&values[i]);
+    }
+
+    delete[] fields_;
+    delete[] values_;
+    fields_ = fields;
+    values_ = values;
+    header_slots_ = slots;
+
+    return true;
+  }
+
+
+  // Goes back to kInitialHeaderSlots once the headers have been delivered.
+  void ShrinkHeaders() {
+    if (header_slots_ == kInitialHeaderSlots)
+      return;
+
+    delete[] fields_;
+    delete[] values_;
+    fields_ = new StringPtr[kInitialHeaderSlots];
+    values_ = new StringPtr[kInitialHeaderSlots];
+    header_slots_ = kInitialHeaderSlots;
+  }
+
 
   Local<Array> CreateHeaders() {
     // num_values_ is either -1 or the entry # of the last header
@@ -486,7 +733,7 @@ class Parser : public BaseObject {
     Local<Array> headers = Array::New(env()->isolate(), 2 * num_values_);
 
     for (int i = 0; i < num_values_; ++i) {
-      headers->Set(2 * i, fields_[i].ToString(env()));
+      headers->Set(2 * i, HeaderNameToString(fields_[i]));
       headers->Set(2 * i + 1, values_[i].ToString(env()));
     }
 
@@ -494,6 +741,28 @@ class Parser : public BaseObject {
   }
 
 
+  // Returns the interned string for well-known header names when the field
+  // matches one of its spellings exactly, a new string otherwise. Names are
+  // matched here rather than in on_header_field() because a name can be
+  // split over several reads.
+  Local<String> HeaderNameToString(const StringPtr& field) {
+    const size_t length = field.size_;
+    const char* const data = field.str_;
+
+    for (size_t i = 0; i < ARRAY_SIZE(header_names); i++) {
+      const HeaderName& h = header_names[i];
+      // The length and first byte rule out nearly every candidate before
+      // memcmp() gets involved.
+      if (h.length != length || h.name[0] != data[0])
+        continue;
+      if (memcmp(h.name, data, length) == 0)
+        return env()->http_header_name(i);
+    }
+
+    return field.ToString(env());
+  }
+
+
   // spill headers and request path to JS land
   void Flush() {
     HandleScope scope(env()->isolate());
@@ -527,12 +796,19 @@ class Parser : public BaseObject {
     num_values_ = 0;
     have_flushed_ = false;
     got_exception_ = false;
+    ShrinkHeaders();
   }
 
 
+  // Requests rarely carry more than a few dozen headers. Past the maximum
+  // the headers are flushed to JS land in batches through kOnHeaders.
+  static const int kInitialHeaderSlots = 32;
+  static const int kMaxHeaderSlots = 1024;
+
   http_parser parser_;
-  StringPtr fields_[32];  // header fields
-  StringPtr values_[32];  // header values
+  StringPtr* fields_;  // header fields
+  StringPtr* values_;  // header values
+  int header_slots_;
   StringPtr url_;
   StringPtr status_message_;
   int num_fields_;
@@ -542,6 +818,12 @@ class Parser : public BaseObject {
   Local<Object> current_buffer_;
   size_t current_buffer_len_;
   char* current_buffer_data_;
+  StreamResource::AllocCb prev_alloc_cb_;
+  void* prev_alloc_ctx_;
+  StreamResource::ReadCb prev_read_cb_;
+  void* prev_read_ctx_;
+  bool in_on_execute_;
+  bool pending_close_;
   static const struct http_parser_settings settings;
 };
 
@@ -581,6 +863,8 @@ void InitHttpParser(Handle<Object> target,
          Integer::NewFromUnsigned(env->isolate(), kOnBody));
   t->Set(FIXED_ONE_BYTE_STRING(env->isolate(), "kOnMessageComplete"),
          Integer::NewFromUnsigned(env->isolate(), kOnMessageComplete));
+  t->Set(FIXED_ONE_BYTE_STRING(env->isolate(), "kOnExecute"),
+         Integer::NewFromUnsigned(env->isolate(), kOnExecute));
 
   Local<Array> methods = Array::New(env->isolate());
 #define V(num, name, string)                                                  \
@@ -595,6 +879,9 @@ void InitHttpParser(Handle<Object> target,
   env->SetProtoMethod(t, "reinitialize", Parser::Reinitialize);
   env->SetProtoMethod(t, "pause", Parser::Pause<true>);
   env->SetProtoMethod(t, "resume", Parser::Pause<false>);
+  env->SetProtoMethod(t, "consume", Parser::Consume);
+  env->SetProtoMethod(t, "unconsume", Parser::Unconsume);
+  env->SetProtoMethod(t, "getCurrentBuffer", Parser::GetCurrentBuffer);
 
   target->Set(FIXED_ONE_BYTE_STRING(env->isolate(), "HTTPParser"),
               t->GetFunction());
@@ -20,12 +20,15 @@ namespace node {
 
 using v8::Array;
 using v8::Context;
+using v8::Exception;
 using v8::FunctionCallbackInfo;
 using v8::FunctionTemplate;
 using v8::Handle;
 using v8::HandleScope;
 using v8::Integer;
+using v8::Isolate;
 using v8::Local;
+using v8::Null;
 using v8::Number;
 using v8::Object;
 using v8::String;
@@ -67,7 +70,8 @@ class ZCtx : public AsyncWrap {
         windowBits_(0),
         write_in_progress_(false),
         pending_close_(false),
-        refs_(0) {
+        refs_(0),
+        out_chunk_count_(0) {
     MakeWeak<ZCtx>(this);
   }
 
@@ -189,10 +193,11 @@ class ZCtx : public AsyncWrap {
     }
 
     // async version
-    uv_queue_work(ctx->env()->event_loop(),
-                  work_req,
-                  ZCtx::Process,
-                  ZCtx::After);
+    uv_queue_work_class(ctx->env()->event_loop(),
+                        work_req,
+                        UV_WORK_CPU,
+                        ZCtx::Process,
+                        ZCtx::After);
 
     args.GetReturnValue().Set(ctx->object());
   }
@@ -216,6 +221,162 @@ class ZCtx : public AsyncWrap {
   }
 
 
+  // writeAll(flush, in, in_off, in_len, chunk_size)
+  // Like write(), but keeps going in the thread pool for as long as the
+  // output fills up, collecting it in buffers of chunk_size bytes that it
+  // allocates itself. Calls back with (avail_in, avail_out, chunks) once the
+  // input has been consumed or kMaxOutChunks chunks have been produced; in
+  // the latter case avail_out is 0 and the caller writes the rest again.
+  template <bool async>
+  static void WriteAll(const FunctionCallbackInfo<Value>& args) {
+    CHECK_EQ(args.Length(), 5);
+
+    ZCtx* ctx = Unwrap<ZCtx>(args.Holder());
+    CHECK(ctx->init_done_ && "write before init");
+    CHECK(ctx->mode_ != NONE && "already finalized");
+
+    CHECK_EQ(false, ctx->write_in_progress_ && "write already in progress");
+    CHECK_EQ(false, ctx->pending_close_ && "close is pending");
+
+    unsigned int flush = args[0]->Uint32Value();
+    CHECK(flush == Z_NO_FLUSH ||
+          flush == Z_PARTIAL_FLUSH ||
+          flush == Z_SYNC_FLUSH ||
+          flush == Z_FULL_FLUSH ||
+          flush == Z_FINISH ||
+          flush == Z_BLOCK);
+
+    Bytef* in = nullptr;
+    size_t in_len = 0;
+
+    if (!args[1]->IsNull()) {
+      CHECK(Buffer::HasInstance(args[1]));
+      Local<Object> in_buf = args[1]->ToObject(args.GetIsolate());
+      size_t in_off = args[2]->Uint32Value();
+      in_len = args[3]->Uint32Value();
+
+      CHECK(Buffer::IsWithinBounds(in_off, in_len, Buffer::Length(in_buf)));
+      in = reinterpret_cast<Bytef*>(Buffer::Data(in_buf) + in_off);
+    }
+
+    int chunk_size = args[4]->Int32Value();
+    CHECK_GT(chunk_size, 0);
+
+    ctx->write_in_progress_ = true;
+    ctx->Ref();
+
+    ctx->strm_.avail_in = in_len;
+    ctx->strm_.next_in = in;
+    ctx->flush_ = flush;
+    ctx->chunk_size_ = chunk_size;
+
+    uv_work_t* work_req = &(ctx->work_req_);
+
+    if (!async) {
+      ctx->env()->PrintSyncTrace();
+      ProcessAll(work_req);
+      if (!CheckError(ctx)) {
+        ctx->FreeOutChunks();
+        return;
+      }
+      Isolate* isolate = ctx->env()->isolate();
+      Local<Array> result = Array::New(isolate, 3);
+      result->Set(0, Integer::NewFromUnsigned(isolate, ctx->strm_.avail_in));
+      result->Set(1, Integer::NewFromUnsigned(isolate, ctx->strm_.avail_out));
+      result->Set(2, TakeOutChunks(ctx));
+      args.GetReturnValue().Set(result);
+      ctx->write_in_progress_ = false;
+      ctx->Unref();
+      return;
+    }
+
+    uv_queue_work_class(ctx->env()->event_loop(),
+                        work_req,
+                        UV_WORK_CPU,
+                        ZCtx::ProcessAll,
+                        ZCtx::AfterAll);
+
+    args.GetReturnValue().Set(ctx->object());
+  }
+
+
+  // thread pool!
+  static void ProcessAll(uv_work_t* work_req) {
+    ZCtx* ctx = ContainerOf(&ZCtx::work_req_, work_req);
+
+    do {
+      char* chunk = static_cast<char*>(malloc(ctx->chunk_size_));
+      if (chunk == nullptr) {
+        ctx->err_ = Z_MEM_ERROR;
+        break;
+      }
+
+      ctx->strm_.next_out = reinterpret_cast<Bytef*>(chunk);
+      ctx->strm_.avail_out = ctx->chunk_size_;
+      Process(work_req);
+
+      size_t have = ctx->chunk_size_ - ctx->strm_.avail_out;
+      if (have == 0) {
+        free(chunk);
+        break;
+      }
+      if (have < static_cast<size_t>(ctx->chunk_size_))
+        chunk = static_cast<char*>(realloc(chunk, have));
+
+      ctx->out_chunks_[ctx->out_chunk_count_].base = chunk;
+      ctx->out_chunks_[ctx->out_chunk_count_].len = have;
+      ctx->out_chunk_count_++;
+    } while (ctx->strm_.avail_out == 0 &&
+             ctx->out_chunk_count_ < kMaxOutChunks &&
+             (ctx->err_ == Z_OK || ctx->err_ == Z_STREAM_END));
+  }
+
+
+  // Hands the output chunks over to JS land.
+  static Local<Array> TakeOutChunks(ZCtx* ctx) {
+    Local<Array> chunks = Array::New(ctx->env()->isolate(),
+                                     ctx->out_chunk_count_);
+    for (size_t i = 0; i < ctx->out_chunk_count_; i++) {
+      uv_buf_t* buf = &ctx->out_chunks_[i];
+      chunks->Set(i, Buffer::Use(ctx->env(), buf->base, buf->len));
+    }
+    ctx->out_chunk_count_ = 0;
+    return chunks;
+  }
+
+
+  // v8 land!
+  static void AfterAll(uv_work_t* work_req, int status) {
+    CHECK_EQ(status, 0);
+
+    ZCtx* ctx = ContainerOf(&ZCtx::work_req_, work_req);
+    Environment* env = ctx->env();
+
+    HandleScope handle_scope(env->isolate());
+    Context::Scope context_scope(env->context());
+
+    if (!CheckError(ctx)) {
+      ctx->FreeOutChunks();
+      return;
+    }
+
+    Local<Value> args[3] = {
+      Integer::NewFromUnsigned(env->isolate(), ctx->strm_.avail_in),
+      Integer::NewFromUnsigned(env->isolate(), ctx->strm_.avail_out),
+      TakeOutChunks(ctx)
+    };
+
+    ctx->write_in_progress_ = false;
+
+    // call the write() cb
+    ctx->MakeCallback(env->callback_string(), ARRAY_SIZE(args), args);
+
+    ctx->Unref();
+    if (ctx->pending_close_)
+      ctx->Close();
+  }
+
+
   // thread pool!
   // This function may be called multiple times on the uv_work pool
   // for a single write() call, until all of the input bytes have
@@ -536,6 +697,12 @@ class ZCtx : public AsyncWrap {
   }
 
  private:
+  void FreeOutChunks() {
+    for (size_t i = 0; i < out_chunk_count_; i++)
+      free(out_chunks_[i].base);
+    out_chunk_count_ = 0;
+  }
+
   void Ref() {
     if (++refs_ == 1) {
       ClearWeak();
@@ -551,6 +718,9 @@ class ZCtx : public AsyncWrap {
 
   static const int kDeflateContextSize = 16384;  // approximate
   static const int kInflateContextSize = 10240;  // approximate
+  // Bounds the output of a single writeAll() call, 2 MB at the default
+  // chunk size.
+  static const size_t kMaxOutChunks = 128;
 
   int chunk_size_;
   Bytef* dictionary_;
@@ -568,9 +738,316 @@ class ZCtx : public AsyncWrap {
   bool write_in_progress_;
   bool pending_close_;
   unsigned int refs_;
+  uv_buf_t out_chunks_[kMaxOutChunks];
+  size_t out_chunk_count_;
+};
+
+
+
+/**
+ * One-shot deflate/inflate of a whole buffer, without a ZCtx.
+ */
+class ZlibBufferRequest : public AsyncWrap {
+ public:
+  ZlibBufferRequest(Environment* env,
+                    Local<Object> object,
+                    node_zlib_mode mode,
+                    Bytef* in,
+                    size_t in_len,
+                    int level,
+                    int window_bits,
+                    int mem_level,
+                    int strategy)
+      : AsyncWrap(env, object, AsyncWrap::PROVIDER_ZLIB),
+        mode_(mode),
+        in_(in),
+        in_len_(in_len),
+        level_(level),
+        window_bits_(window_bits),
+        mem_level_(mem_level),
+        strategy_(strategy),
+        err_(Z_OK),
+        msg_(nullptr),
+        out_(nullptr),
+        out_len_(0) {
+  }
+
+  ~ZlibBufferRequest() override {
+    free(out_);
+    persistent().Reset();
+  }
+
+  uv_work_t* work_req() {
+    return &work_req_;
+  }
+
+  uv_work_t work_req_;
+
+  // thread pool!
+  static void Work(uv_work_t* work_req) {
+    ZlibBufferRequest* req =
+        ContainerOf(&ZlibBufferRequest::work_req_, work_req);
+    z_stream strm;
+
+    memset(&strm, 0, sizeof(strm));
+
+    int window_bits = req->window_bits_;
+    if (req->mode_ == GZIP || req->mode_ == GUNZIP)
+      window_bits += 16;
+    if (req->mode_ == UNZIP)
+      window_bits += 32;
+    if (req->mode_ == DEFLATERAW || req->mode_ == INFLATERAW)
+      window_bits *= -1;
+
+    switch (req->mode_) {
+      case DEFLATE:
+      case GZIP:
+      case DEFLATERAW:
+        req->err_ = deflateInit2(&strm,
+                                 req->level_,
+                                 Z_DEFLATED,
+                                 window_bits,
+                                 req->mem_level_,
+                                 req->strategy_);
+        if (req->err_ != Z_OK) {
+          req->msg_ = "Init error";
+          return;
+        }
+        req->Deflate(&strm);
+        (void)deflateEnd(&strm);
+        break;
+      case INFLATE:
+      case GUNZIP:
+      case INFLATERAW:
+      case UNZIP:
+        req->err_ = inflateInit2(&strm, window_bits);
+        if (req->err_ != Z_OK) {
+          req->msg_ = "Init error";
+          return;
+        }
+        req->Inflate(&strm);
+        (void)inflateEnd(&strm);
+        break;
+      default:
+        CHECK(0 && "wtf?");
+    }
+  }
+
+  // v8 land!
+  static void After(uv_work_t* work_req, int status) {
+    CHECK_EQ(status, 0);
+    ZlibBufferRequest* req =
+        ContainerOf(&ZlibBufferRequest::work_req_, work_req);
+    Environment* env = req->env();
+    HandleScope handle_scope(env->isolate());
+    Context::Scope context_scope(env->context());
+    Local<Value> argv[2];
+    req->Check(argv);
+    req->MakeCallback(env->ondone_string(), ARRAY_SIZE(argv), argv);
+    delete req;
+  }
+
+  // argv[0] is an error with an errno property, or null if argv[1] holds
+  // the output.
+  void Check(Local<Value> argv[2]) {
+    Isolate* isolate = env()->isolate();
+
+    if (err_ != Z_OK && err_ != Z_STREAM_END) {
+      Local<Object> error =
+          Exception::Error(OneByteString(isolate, msg_)).As<Object>();
+      error->Set(env()->errno_string(), Integer::New(isolate, err_));
+      argv[0] = error;
+      argv[1] = Null(isolate);
+      return;
+    }
+
+    if (out_len_ == 0) {
+      argv[1] = Buffer::New(env(), 0);
+    } else {
+      char* out = static_cast<char*>(realloc(out_, out_len_));
+      if (out != nullptr)
+        out_ = out;
+      argv[1] = Buffer::Use(env(), out_, out_len_);
+      out_ = nullptr;
+    }
+    argv[0] = Null(isolate);
+  }
+
+ private:
+  // The output can't be larger than deflateBound(), so it takes a single
+  // call with Z_FINISH.
+  void Deflate(z_stream* strm) {
+    size_t out_size = deflateBound(strm, in_len_);
+    if (out_size > Buffer::kMaxLength)
+      return TooLarge();
+
+    out_ = static_cast<char*>(malloc(out_size));
+    if (out_ == nullptr)
+      return OutOfMemory();
+
+    strm->next_in = in_;
+    strm->avail_in = in_len_;
+    strm->next_out = reinterpret_cast<Bytef*>(out_);
+    strm->avail_out = out_size;
+
+    err_ = deflate(strm, Z_FINISH);
+    out_len_ = out_size - strm->avail_out;
+    if (err_ != Z_STREAM_END) {
+      msg_ = strm->msg != nullptr ? strm->msg : "Zlib error";
+      if (err_ == Z_OK || err_ == Z_BUF_ERROR)
+        err_ = Z_BUF_ERROR;
+    }
+  }
+
+  // Guesses the output size and doubles it until the stream ends or the
+  // input runs out. Like the streaming interface, truncated input is not an
+  // error; it produces what could be decompressed.
+  void Inflate(z_stream* strm) {
+    size_t out_size = in_len_ < kInitialInflateSize / 4 ?
+        kInitialInflateSize : in_len_ * 4;
+    if (out_size > Buffer::kMaxLength)
+      out_size = Buffer::kMaxLength;
+
+    out_ = static_cast<char*>(malloc(out_size));
+    if (out_ == nullptr)
+      return OutOfMemory();
+
+    strm->next_in = in_;
+    strm->avail_in = in_len_;
+    strm->next_out = reinterpret_cast<Bytef*>(out_);
+    strm->avail_out = out_size;
+
+    for (;;) {
+      err_ = inflate(strm, Z_FINISH);
+      out_len_ = out_size - strm->avail_out;
+
+      if (err_ == Z_STREAM_END)
+        return;
+      if (err_ == Z_NEED_DICT) {
+        msg_ = "Missing dictionary";
+        return;
+      }
+      if (err_ != Z_OK && err_ != Z_BUF_ERROR) {
+        msg_ = strm->msg != nullptr ? strm->msg : "Zlib error";
+        return;
+      }
+      if (strm->avail_out != 0) {
+        err_ = Z_OK;
+        return;
+      }
+
+      if (out_size == Buffer::kMaxLength)
+        return TooLarge();
+      out_size *= 2;
+      if (out_size > Buffer::kMaxLength)
+        out_size = Buffer::kMaxLength;
+
+      char* out = static_cast<char*>(realloc(out_, out_size));
+      if (out == nullptr)
+        return OutOfMemory();
+      out_ = out;
+      strm->next_out = reinterpret_cast<Bytef*>(out_ + out_len_);
+      strm->avail_out = out_size - out_len_;
+    }
+  }
+
+  void OutOfMemory() {
+    err_ = Z_MEM_ERROR;
+    msg_ = "Out of memory";
+  }
+
+  void TooLarge() {
+    err_ = Z_BUF_ERROR;
+    msg_ = "Output exceeds the maximum buffer size";
+  }
+
+  static const size_t kInitialInflateSize = 16 * 1024;
+
+  node_zlib_mode mode_;
+  Bytef* in_;
+  size_t in_len_;
+  int level_;
+  int window_bits_;
+  int mem_level_;
+  int strategy_;
+  int err_;
+  const char* msg_;
+  char* out_;
+  size_t out_len_;
 };
 
 
+// deflateBuffer(mode, buffer, level, windowBits, memLevel, strategy[, cb])
+// inflateBuffer(mode, buffer, windowBits[, cb])
+// Without a callback the work is done synchronously and the function returns
+// what the callback would have been called with, the output buffer or an
+// error.
+template <bool deflate>
+static void ProcessBuffer(const FunctionCallbackInfo<Value>& args) {
+  Environment* env = Environment::GetCurrent(args);
+
+  node_zlib_mode mode = static_cast<node_zlib_mode>(args[0]->Int32Value());
+  if (deflate) {
+    CHECK(mode == DEFLATE || mode == GZIP || mode == DEFLATERAW);
+  } else {
+    CHECK(mode == INFLATE || mode == GUNZIP || mode == INFLATERAW ||
+          mode == UNZIP);
+  }
+
+  CHECK(Buffer::HasInstance(args[1]));
+  Local<Object> in_buf = args[1].As<Object>();
+  Bytef* in = reinterpret_cast<Bytef*>(Buffer::Data(in_buf));
+  size_t in_len = Buffer::Length(in_buf);
+
+  int level = 0;
+  int window_bits;
+  int mem_level = 0;
+  int strategy = 0;
+  Local<Value> cb;
+  if (deflate) {
+    level = args[2]->Int32Value();
+    window_bits = args[3]->Int32Value();
+    mem_level = args[4]->Int32Value();
+    strategy = args[5]->Int32Value();
+    cb = args[6];
+  } else {
+    window_bits = args[2]->Int32Value();
+    cb = args[3];
+  }
+
+  Local<Object> obj = Object::New(env->isolate());
+  ZlibBufferRequest* req = new ZlibBufferRequest(env,
+                                                 obj,
+                                                 mode,
+                                                 in,
+                                                 in_len,
+                                                 level,
+                                                 window_bits,
+                                                 mem_level,
+                                                 strategy);
+
+  if (cb->IsFunction()) {
+    obj->Set(env->ondone_string(), cb);
+    // Keep the input alive until the thread pool is done with it.
+    obj->Set(env->buffer_string(), in_buf);
+    if (env->in_domain())
+      obj->Set(env->domain_string(), env->domain_array()->Get(0));
+    uv_queue_work_class(env->event_loop(),
+                        req->work_req(),
+                        UV_WORK_CPU,
+                        ZlibBufferRequest::Work,
+                        ZlibBufferRequest::After);
+    args.GetReturnValue().Set(obj);
+  } else {
+    env->PrintSyncTrace();
+    Local<Value> argv[2];
+    ZlibBufferRequest::Work(req->work_req());
+    req->Check(argv);
+    delete req;
+    args.GetReturnValue().Set(argv[0]->IsNull() ? argv[1] : argv[0]);
+  }
+}
+
 void InitZlib(Handle<Object> target,
               Handle<Value> unused,
               Handle<Context> context,
@@ -582,6 +1059,8 @@ void InitZlib(Handle<Object> target,
 
   env->SetProtoMethod(z, "write", ZCtx::Write<true>);
   env->SetProtoMethod(z, "writeSync", ZCtx::Write<false>);
+  env->SetProtoMethod(z, "writeAll", ZCtx::WriteAll<true>);
+  env->SetProtoMethod(z, "writeAllSync", ZCtx::WriteAll<false>);
   env->SetProtoMethod(z, "init", ZCtx::Init);
   env->SetProtoMethod(z, "close", ZCtx::Close);
   env->SetProtoMethod(z, "params", ZCtx::Params);
@@ -590,6 +1069,9 @@ void InitZlib(Handle<Object> target,
   z->SetClassName(FIXED_ONE_BYTE_STRING(env->isolate(), "Zlib"));
   target->Set(FIXED_ONE_BYTE_STRING(env->isolate(), "Zlib"), z->GetFunction());
 
+  env->SetMethod(target, "deflateBuffer", ProcessBuffer<true>);
+  env->SetMethod(target, "inflateBuffer", ProcessBuffer<false>);
+
   // valid flush values.
   NODE_DEFINE_CONSTANT(target, Z_NO_FLUSH);
   NODE_DEFINE_CONSTANT(target, Z_PARTIAL_FLUSH);
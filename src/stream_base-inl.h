@@ -10,10 +10,12 @@
 
 namespace node {
 
+using v8::External;
 using v8::FunctionCallbackInfo;
 using v8::FunctionTemplate;
 using v8::Handle;
 using v8::HandleScope;
+using v8::Isolate;
 using v8::Local;
 using v8::Object;
 using v8::PropertyAttribute;
@@ -36,6 +38,20 @@ void StreamBase::AddMethods(Environment* env,
                                      v8::DEFAULT,
                                      attributes);
 
+  t->InstanceTemplate()->SetAccessor(env->external_stream_string(),
+                                     GetExternal<Base>,
+                                     nullptr,
+                                     env->as_external(),
+                                     v8::DEFAULT,
+                                     attributes);
+
+  t->InstanceTemplate()->SetAccessor(env->stats_string(),
+                                     GetStats<Base>,
+                                     nullptr,
+                                     env->as_external(),
+                                     v8::DEFAULT,
+                                     attributes);
+
   env->SetProtoMethod(t, "readStart", JSMethod<Base, &StreamBase::ReadStart>);
   env->SetProtoMethod(t, "readStop", JSMethod<Base, &StreamBase::ReadStop>);
   if ((flags & kFlagNoShutdown) == 0)
@@ -45,6 +61,7 @@ void StreamBase::AddMethods(Environment* env,
   env->SetProtoMethod(t,
                       "writeBuffer",
                       JSMethod<Base, &StreamBase::WriteBuffer>);
+  env->SetProtoMethod(t, "sendFile", JSMethod<Base, &StreamBase::SendFile>);
   env->SetProtoMethod(t,
                       "writeAsciiString",
                       JSMethod<Base, &StreamBase::WriteString<ASCII> >);
@@ -72,6 +89,37 @@ void StreamBase::GetFD(Local<String> key,
 }
 
 
+template <class Base>
+void StreamBase::GetExternal(Local<String> key,
+                             const PropertyCallbackInfo<Value>& args) {
+  StreamBase* wrap = Unwrap<Base>(args.Holder());
+
+  Local<External> ext = External::New(args.GetIsolate(), wrap);
+  args.GetReturnValue().Set(ext);
+}
+
+
+// Returns a live view of the stream's counters, see StatsFields. Reading
+// the view doesn't call into C++, so hang on to it rather than getting it
+// over and over. The view goes empty when the stream is destroyed.
+template <class Base>
+void StreamBase::GetStats(Local<String> key,
+                          const PropertyCallbackInfo<Value>& args) {
+  StreamBase* wrap = Unwrap<Base>(args.Holder());
+  Isolate* isolate = args.GetIsolate();
+
+  if (wrap->stats_object_.IsEmpty()) {
+    Local<Object> stats = Object::New(isolate);
+    stats->SetIndexedPropertiesToExternalArrayData(wrap->stats_fields(),
+                                                   v8::kExternalFloat64Array,
+                                                   wrap->stats_fields_count());
+    wrap->stats_object_.Reset(isolate, stats);
+  }
+
+  args.GetReturnValue().Set(PersistentToLocal(isolate, wrap->stats_object_));
+}
+
+
 template <class Base,
           int (StreamBase::*Method)(const FunctionCallbackInfo<Value>& args)>
 void StreamBase::JSMethod(const FunctionCallbackInfo<Value>& args) {
@@ -2,6 +2,8 @@
 #include "stream_base-inl.h"
 #include "stream_wrap.h"
 
+#include "async-wrap.h"
+#include "async-wrap-inl.h"
 #include "node.h"
 #include "node_buffer.h"
 #include "env.h"
@@ -18,7 +20,10 @@ namespace node {
 
 using v8::Array;
 using v8::Context;
+using v8::External;
+using v8::Function;
 using v8::FunctionCallbackInfo;
+using v8::FunctionTemplate;
 using v8::Handle;
 using v8::HandleScope;
 using v8::Integer;
@@ -38,6 +43,25 @@ template int StreamBase::WriteString<BINARY>(
     const FunctionCallbackInfo<Value>& args);
 
 
+StreamBase::~StreamBase() {
+  if (read_pipe_ != nullptr)
+    read_pipe_->OnStreamGone(this);
+  if (write_pipe_ != nullptr)
+    write_pipe_->OnStreamGone(this);
+
+  if (stats_object_.IsEmpty())
+    return;
+
+  // JS land may still hold on to the view, don't let it read freed memory.
+  HandleScope scope(env_->isolate());
+  Local<Object> stats = PersistentToLocal(env_->isolate(), stats_object_);
+  stats->SetIndexedPropertiesToExternalArrayData(nullptr,
+                                                 v8::kExternalFloat64Array,
+                                                 0);
+  stats_object_.Reset();
+}
+
+
 int StreamBase::ReadStart(const FunctionCallbackInfo<Value>& args) {
   return ReadStart();
 }
@@ -99,41 +123,60 @@ int StreamBase::Writev(const FunctionCallbackInfo<Value>& args) {
 
   Local<Object> req_wrap_obj = args[0].As<Object>();
   Local<Array> chunks = args[1].As<Array>();
+  bool all_buffers = args[2]->IsTrue();
 
-  size_t count = chunks->Length() >> 1;
+  // With all_buffers, chunks is a plain list of buffers rather than a list
+  // of chunk/encoding pairs.
+  size_t count = all_buffers ? chunks->Length() : chunks->Length() >> 1;
 
   uv_buf_t bufs_[16];
   uv_buf_t* bufs = bufs_;
 
+  if (ARRAY_SIZE(bufs_) < count)
+    bufs = new uv_buf_t[count];
+
   // Determine storage size first
   size_t storage_size = 0;
-  for (size_t i = 0; i < count; i++) {
-    storage_size = ROUND_UP(storage_size, WriteWrap::kAlignSize);
-
-    Handle<Value> chunk = chunks->Get(i * 2);
-
-    if (Buffer::HasInstance(chunk))
-      continue;
-      // Buffer chunk, no additional storage required
-
-    // String chunk
-    Handle<String> string = chunk->ToString(env->isolate());
-    enum encoding encoding = ParseEncoding(env->isolate(),
-                                           chunks->Get(i * 2 + 1));
-    size_t chunk_size;
-    if (encoding == UTF8 && string->Length() > 65535)
-      chunk_size = StringBytes::Size(env->isolate(), string, encoding);
-    else
-      chunk_size = StringBytes::StorageSize(env->isolate(), string, encoding);
-
-    storage_size += chunk_size;
+  uint32_t bytes = 0;
+  if (all_buffers) {
+    // Fast path: a single pass and no storage needed. JS land has checked
+    // that every chunk is a buffer.
+    for (size_t i = 0; i < count; i++) {
+      Local<Value> chunk = chunks->Get(i);
+      CHECK(Buffer::HasInstance(chunk));
+      bufs[i].base = Buffer::Data(chunk);
+      bufs[i].len = Buffer::Length(chunk);
+      bytes += bufs[i].len;
+    }
+  } else {
+    for (size_t i = 0; i < count; i++) {
+      storage_size = ROUND_UP(storage_size, WriteWrap::kAlignSize);
+
+      Handle<Value> chunk = chunks->Get(i * 2);
+
+      if (Buffer::HasInstance(chunk))
+        continue;
+        // Buffer chunk, no additional storage required
+
+      // String chunk
+      Handle<String> string = chunk->ToString(env->isolate());
+      enum encoding encoding = ParseEncoding(env->isolate(),
+                                             chunks->Get(i * 2 + 1));
+      size_t chunk_size;
+      if (encoding == UTF8 && string->Length() > 65535)
+        chunk_size = StringBytes::Size(env->isolate(), string, encoding);
+      else
+        chunk_size = StringBytes::StorageSize(env->isolate(), string, encoding);
+
+      storage_size += chunk_size;
+    }
   }
 
-  if (storage_size > INT_MAX)
+  if (storage_size > INT_MAX) {
+    if (bufs != bufs_)
+      delete[] bufs;
     return UV_ENOBUFS;
-
-  if (ARRAY_SIZE(bufs_) < count)
-    bufs = new uv_buf_t[count];
+  }
 
   WriteWrap* req_wrap = WriteWrap::New(env,
                                        req_wrap_obj,
@@ -141,9 +184,8 @@ int StreamBase::Writev(const FunctionCallbackInfo<Value>& args) {
                                        AfterWrite,
                                        storage_size);
 
-  uint32_t bytes = 0;
   size_t offset = 0;
-  for (size_t i = 0; i < count; i++) {
+  for (size_t i = 0; !all_buffers && i < count; i++) {
     Handle<Value> chunk = chunks->Get(i * 2);
 
     // Write buffer
@@ -175,6 +217,8 @@ int StreamBase::Writev(const FunctionCallbackInfo<Value>& args) {
   }
 
   int err = DoWrite(req_wrap, bufs, count, nullptr);
+  if (err == 0)
+    CountWrite(bytes, bytes);
 
   // Deallocate space
   if (bufs != bufs_)
@@ -218,8 +262,10 @@ int StreamBase::WriteBuffer(const FunctionCallbackInfo<Value>& args) {
   int err = DoTryWrite(&bufs, &count);
   if (err != 0)
     goto done;
-  if (count == 0)
+  if (count == 0) {
+    CountWrite(length, 0);
     goto done;
+  }
   CHECK_EQ(count, 1);
 
   // Allocate, or write rest
@@ -230,6 +276,8 @@ int StreamBase::WriteBuffer(const FunctionCallbackInfo<Value>& args) {
 
   if (err)
     req_wrap->Dispose();
+  else
+    CountWrite(length, bufs[0].len);
 
  done:
   const char* msg = Error();
@@ -243,6 +291,59 @@ int StreamBase::WriteBuffer(const FunctionCallbackInfo<Value>& args) {
 }
 
 
+int StreamBase::SendFile(const FunctionCallbackInfo<Value>& args) {
+  CHECK(args[0]->IsObject());
+  CHECK(args[1]->IsInt32());
+  CHECK(args[2]->IsNumber());
+  CHECK(args[3]->IsNumber());
+  Environment* env = Environment::GetCurrent(args);
+
+  Local<Object> req_wrap_obj = args[0].As<Object>();
+  uv_file fd = args[1]->Int32Value();
+  int64_t offset = args[2]->IntegerValue();
+  int64_t total = args[3]->IntegerValue();
+  CHECK_GE(offset, 0);
+  CHECK_GE(total, 0);
+
+  WriteWrap* req_wrap;
+  size_t length = static_cast<size_t>(total);
+
+  // Try sending immediately, the kernel copies straight from the page cache
+  int err = DoTrySendFile(fd, &offset, &length);
+  if (err != 0)
+    goto done;
+  if (length == 0) {
+    CountWrite(total, 0);
+    goto done;
+  }
+
+  // Send the rest once the stream becomes writable
+  req_wrap = WriteWrap::New(env,
+                            req_wrap_obj,
+                            this,
+                            AfterWrite,
+                            sizeof(SendFileReq));
+
+  err = DoSendFile(req_wrap, fd, offset, length);
+  req_wrap_obj->Set(env->async(), True(env->isolate()));
+
+  if (err)
+    req_wrap->Dispose();
+  else
+    CountWrite(total, length);
+
+ done:
+  const char* msg = Error();
+  if (msg != nullptr) {
+    req_wrap_obj->Set(env->error_string(), OneByteString(env->isolate(), msg));
+    ClearError();
+  }
+  req_wrap_obj->Set(env->bytes_string(),
+                    Number::New(env->isolate(), static_cast<double>(total)));
+  return err;
+}
+
+
 template <enum encoding enc>
 int StreamBase::WriteString(const FunctionCallbackInfo<Value>& args) {
   Environment* env = Environment::GetCurrent(args);
@@ -274,6 +375,7 @@ int StreamBase::WriteString(const FunctionCallbackInfo<Value>& args) {
   char* data;
   char stack_storage[16384];  // 16kb
   size_t data_size;
+  size_t total_size;
   uv_buf_t buf;
 
   bool try_write = storage_size <= sizeof(stack_storage) &&
@@ -295,8 +397,10 @@ int StreamBase::WriteString(const FunctionCallbackInfo<Value>& args) {
       goto done;
 
     // Success
-    if (count == 0)
+    if (count == 0) {
+      CountWrite(data_size, 0);
       goto done;
+    }
 
     // Partial write
     CHECK_EQ(count, 1);
@@ -309,6 +413,7 @@ int StreamBase::WriteString(const FunctionCallbackInfo<Value>& args) {
   if (try_write) {
     // Copy partial data
     memcpy(data, buf.base, buf.len);
+    total_size = data_size;
     data_size = buf.len;
   } else {
     // Write it
@@ -320,6 +425,8 @@ int StreamBase::WriteString(const FunctionCallbackInfo<Value>& args) {
   }
 
   CHECK_LE(data_size, storage_size);
+  if (!try_write)
+    total_size = data_size;
 
   buf = uv_buf_init(data, data_size);
 
@@ -348,6 +455,8 @@ int StreamBase::WriteString(const FunctionCallbackInfo<Value>& args) {
 
   if (err)
     req_wrap->Dispose();
+  else
+    CountWrite(total_size, data_size);
 
  done:
   const char* msg = Error();
@@ -434,6 +543,21 @@ int StreamResource::DoTryWrite(uv_buf_t** bufs, size_t* count) {
 }
 
 
+int StreamResource::DoTrySendFile(uv_file fd,
+                                  int64_t* offset,
+                                  size_t* length) {
+  return UV_ENOSYS;
+}
+
+
+int StreamResource::DoSendFile(WriteWrap* w,
+                               uv_file fd,
+                               int64_t offset,
+                               size_t length) {
+  return UV_ENOSYS;
+}
+
+
 const char* StreamResource::Error() const {
   return nullptr;
 }
@@ -443,4 +567,330 @@ void StreamResource::ClearError() {
   // No-op
 }
 
+
+void StreamPipe::Initialize(Environment* env, Handle<Object> target) {
+  HandleScope scope(env->isolate());
+
+  Local<FunctionTemplate> t = env->NewFunctionTemplate(StreamPipe::New);
+  t->InstanceTemplate()->SetInternalFieldCount(1);
+  t->SetClassName(FIXED_ONE_BYTE_STRING(env->isolate(), "StreamPipe"));
+
+  env->SetProtoMethod(t, "start", StreamPipe::Start);
+  env->SetProtoMethod(t, "unpipe", StreamPipe::Unpipe);
+
+  target->Set(FIXED_ONE_BYTE_STRING(env->isolate(), "StreamPipe"),
+              t->GetFunction());
+}
+
+
+StreamPipe::StreamPipe(Environment* env, Local<Object> object)
+    : AsyncWrap(env, object, AsyncWrap::PROVIDER_STREAMPIPE),
+      source_(nullptr),
+      sink_(nullptr),
+      piping_(false),
+      paused_(false),
+      pending_eof_(0),
+      pending_bytes_(0),
+      pending_writes_(0),
+      prev_alloc_cb_(nullptr),
+      prev_alloc_ctx_(nullptr),
+      prev_read_cb_(nullptr),
+      prev_read_ctx_(nullptr) {
+  MakeWeak<StreamPipe>(this);
+}
+
+
+StreamPipe::~StreamPipe() {
+  // Only collectable once stopped and done writing
+  CHECK_EQ(piping_, false);
+  CHECK_EQ(pending_writes_, 0);
+}
+
+
+void StreamPipe::New(const FunctionCallbackInfo<Value>& args) {
+  CHECK(args.IsConstructCall());
+  Environment* env = Environment::GetCurrent(args);
+  new StreamPipe(env, args.This());
+}
+
+
+// pipe.start(source._externalStream, sink._externalStream)
+void StreamPipe::Start(const FunctionCallbackInfo<Value>& args) {
+  StreamPipe* pipe = Unwrap<StreamPipe>(args.Holder());
+  CHECK(args[0]->IsExternal());
+  CHECK(args[1]->IsExternal());
+
+  StreamBase* source =
+      static_cast<StreamBase*>(args[0].As<External>()->Value());
+  StreamBase* sink = static_cast<StreamBase*>(args[1].As<External>()->Value());
+  CHECK_NE(source, nullptr);
+  CHECK_NE(sink, nullptr);
+
+  args.GetReturnValue().Set(pipe->Start(source, sink));
+}
+
+
+int StreamPipe::Start(StreamBase* source, StreamBase* sink) {
+  CHECK_EQ(piping_, false);
+
+  if (source == sink)
+    return UV_EINVAL;
+
+  if (!source->IsAlive() || source->IsClosing() ||
+      !sink->IsAlive() || sink->IsClosing()) {
+    return UV_EINVAL;
+  }
+
+  // Handles sent over IPC pipes can't be written to another stream
+  if (source->IsIPCPipe() || sink->IsIPCPipe())
+    return UV_EINVAL;
+
+  if (source->IsConsumed() || sink->write_pipe_ != nullptr)
+    return UV_EBUSY;
+
+  prev_alloc_cb_ = source->alloc_cb();
+  prev_alloc_ctx_ = source->alloc_ctx();
+  prev_read_cb_ = source->read_cb();
+  prev_read_ctx_ = source->read_ctx();
+
+  source->Consume();
+  source->set_alloc_cb(OnAllocImpl, this);
+  source->set_read_cb(OnReadImpl, this);
+  source->read_pipe_ = this;
+  sink->write_pipe_ = this;
+
+  source_ = source;
+  sink_ = sink;
+  piping_ = true;
+  paused_ = false;
+  pending_eof_ = 0;
+  ClearWeak();
+
+  int err = source->ReadStart();
+  if (err)
+    Stop();
+  return err;
+}
+
+
+void StreamPipe::Unpipe(const FunctionCallbackInfo<Value>& args) {
+  StreamPipe* pipe = Unwrap<StreamPipe>(args.Holder());
+  pipe->Stop();
+}
+
+
+// Hands the source back to its owner. Writes that are still in progress
+// complete in the background.
+void StreamPipe::Stop() {
+  if (!piping_)
+    return;
+
+  StreamBase* source = source_;
+  ssize_t eof = pending_eof_;
+
+  if (source != nullptr) {
+    source->set_alloc_cb(prev_alloc_cb_, prev_alloc_ctx_);
+    source->set_read_cb(prev_read_cb_, prev_read_ctx_);
+    source->Unconsume();
+    source->read_pipe_ = nullptr;
+
+    // The owner still thinks that the source is reading
+    if (paused_ && eof == 0 && source->IsAlive() && !source->IsClosing())
+      source->ReadStart();
+  }
+
+  if (sink_ != nullptr)
+    sink_->write_pipe_ = nullptr;
+
+  source_ = nullptr;
+  sink_ = nullptr;
+  piping_ = false;
+  paused_ = false;
+  pending_eof_ = 0;
+  prev_alloc_cb_ = nullptr;
+  prev_alloc_ctx_ = nullptr;
+  prev_read_cb_ = nullptr;
+  prev_read_ctx_ = nullptr;
+
+  if (pending_writes_ == 0)
+    MakeWeak<StreamPipe>(this);
+
+  if (eof != 0 && source != nullptr) {
+    uv_buf_t buf = uv_buf_init(nullptr, 0);
+    source->OnRead(eof, &buf);
+  }
+}
+
+
+// Stops piping because the sink failed and lets JS land know.
+void StreamPipe::Fail(int status) {
+  Environment* env = this->env();
+  HandleScope handle_scope(env->isolate());
+  Context::Scope context_scope(env->context());
+
+  // Stop() may call into JS land, don't let the pipe be collected meanwhile
+  Local<Object> object = this->object();
+  Stop();
+
+  Local<Value> argv[] = {
+    Integer::New(env->isolate(), status)
+  };
+  Local<Value> cb = object->Get(env->oncomplete_string());
+  CHECK(cb->IsFunction());
+  MakeCallback(cb.As<Function>(), ARRAY_SIZE(argv), argv);
+}
+
+
+void StreamPipe::OnStreamGone(StreamBase* stream) {
+  // Nothing to give back to a source that is being destroyed, and no one to
+  // tell about its EOF if the sink is.
+  if (stream == source_)
+    source_ = nullptr;
+  if (stream == sink_)
+    sink_ = nullptr;
+  pending_eof_ = 0;
+  Stop();
+}
+
+
+void StreamPipe::OnAllocImpl(size_t size, uv_buf_t* buf, void* ctx) {
+  StreamPipe* pipe = static_cast<StreamPipe*>(ctx);
+  Environment::ReadBufferPool* pool = pipe->env()->read_buffer_pool();
+
+  // Streams that ask for less (e.g. TLS) get a whole buffer anyway, so that
+  // it can go back to the pool.
+  if (size < Environment::ReadBufferPool::kBufferSize)
+    size = Environment::ReadBufferPool::kBufferSize;
+
+  buf->base = pool->Acquire(size);
+  buf->len = size;
+
+  if (buf->base == nullptr) {
+    FatalError(
+        "node::StreamPipe::OnAllocImpl(size_t, uv_buf_t*, void*)",
+        "Out Of Memory");
+  }
+}
+
+
+void StreamPipe::OnReadImpl(ssize_t nread,
+                            const uv_buf_t* buf,
+                            uv_handle_type pending,
+                            void* ctx) {
+  StreamPipe* pipe = static_cast<StreamPipe*>(ctx);
+  Environment* env = pipe->env();
+
+  if (nread <= 0) {
+    if (buf != nullptr && buf->base != nullptr)
+      env->read_buffer_pool()->Release(buf->base, buf->len);
+    if (nread == 0)
+      return;
+
+    // Hold EOF and errors back until the sink has caught up
+    pipe->pending_eof_ = nread;
+    if (pipe->pending_writes_ == 0)
+      pipe->Stop();
+    return;
+  }
+
+  CHECK_EQ(pending, UV_UNKNOWN_HANDLE);
+  CHECK_LE(static_cast<size_t>(nread), buf->len);
+  pipe->Write(buf->base, buf->len, nread);
+}
+
+
+void StreamPipe::Write(char* base, size_t size, size_t nread) {
+  Environment* env = this->env();
+
+  // Destroyed from JS land in the meantime
+  if (!sink_->IsAlive() || sink_->IsClosing()) {
+    env->read_buffer_pool()->Release(base, size);
+    return Fail(UV_EPIPE);
+  }
+
+  uv_buf_t buf = uv_buf_init(base, nread);
+  uv_buf_t* bufs = &buf;
+  size_t count = 1;
+
+  // Try writing immediately, the read buffer can go straight back then
+  int err = sink_->DoTryWrite(&bufs, &count);
+  if (err == 0 && count == 0) {
+    sink_->CountWrite(nread, 0);
+    env->read_buffer_pool()->Release(base, size);
+    return;
+  }
+
+  if (err == 0) {
+    HandleScope handle_scope(env->isolate());
+    Local<Object> req_wrap_obj =
+        env->write_wrap_constructor_function()->NewInstance();
+    WriteWrap* req_wrap = WriteWrap::New(env,
+                                         req_wrap_obj,
+                                         sink_,
+                                         AfterWrite,
+                                         sizeof(WriteReq));
+    size_t pending = bufs[0].len;
+    WriteReq* req = reinterpret_cast<WriteReq*>(req_wrap->Extra());
+    req->pipe = this;
+    req->base = base;
+    req->size = size;
+    req->pending = pending;
+
+    // Some streams (e.g. TLS) may complete the write before DoWrite()
+    // returns, don't touch `req` after it.
+    StreamBase* sink = sink_;
+    pending_writes_++;
+    pending_bytes_ += pending;
+    err = sink->DoWrite(req_wrap, bufs, count, nullptr);
+    if (err == 0) {
+      sink->CountWrite(nread, pending);
+      if (piping_ && !paused_ && pending_bytes_ > kMaxPendingBytes) {
+        paused_ = true;
+        source_->ReadStop();
+      }
+      return;
+    }
+    pending_writes_--;
+    pending_bytes_ -= pending;
+    req_wrap->Dispose();
+  }
+
+  env->read_buffer_pool()->Release(base, size);
+  if (sink_ != nullptr)
+    sink_->ClearError();
+  Fail(err);
+}
+
+
+void StreamPipe::AfterWrite(WriteWrap* req_wrap, int status) {
+  WriteReq* req = reinterpret_cast<WriteReq*>(req_wrap->Extra());
+  StreamPipe* pipe = req->pipe;
+
+  req_wrap->wrap()->OnAfterWrite(req_wrap);
+  pipe->env()->read_buffer_pool()->Release(req->base, req->size);
+  pipe->pending_writes_--;
+  pipe->pending_bytes_ -= req->pending;
+  req_wrap->Dispose();
+
+  if (!pipe->piping_) {
+    if (pipe->pending_writes_ == 0)
+      pipe->MakeWeak<StreamPipe>(pipe);
+    return;
+  }
+
+  if (status != 0)
+    return pipe->Fail(status);
+
+  if (pipe->pending_eof_ != 0) {
+    if (pipe->pending_writes_ == 0)
+      pipe->Stop();
+    return;
+  }
+
+  if (pipe->paused_ && pipe->pending_bytes_ <= kMaxPendingBytes) {
+    pipe->paused_ = false;
+    pipe->source_->ReadStart();
+  }
+}
+
 }  // namespace node
@@ -13,6 +13,7 @@ namespace node {
 
 // Forward declarations
 class StreamBase;
+class StreamPipe;
 
 template <class Req>
 class StreamReq {
@@ -98,6 +99,19 @@ class WriteWrap: public ReqWrap<uv_write_t>,
   StreamBase* const wrap_;
 };
 
+// Progress of a sendFile() request, kept in its WriteWrap's extra storage.
+// The file descriptor has to stay open, and nothing else may be written to
+// the stream, until the request completes.
+struct SendFileReq {
+  uv_file fd;
+  int64_t offset;
+  size_t length;
+  size_t cached;  // Bytes from `offset` on that were in the page cache.
+  char* chunk;
+  uv_fs_t read_req;  // Reads the parts that aren't in the page cache.
+  ListNode<SendFileReq> member;  // In the stream's list while reading.
+};
+
 class StreamResource {
  public:
   typedef void (*AfterWriteCb)(WriteWrap* w, void* ctx);
@@ -107,9 +121,24 @@ class StreamResource {
                          uv_handle_type pending,
                          void* ctx);
 
+  // Per-stream counters, exposed to JS as handle.stats.
+  enum StatsFields {
+    kReads,
+    kBytesRead,
+    kWrites,
+    kBytesWritten,
+    kTryWrites,  // Completed synchronously by DoTryWrite().
+    kQueuedWrites,  // Handed to DoWrite(), possibly after a partial write.
+    kPartialWrites,  // DoTryWrite() got some but not all of the data out.
+    kMaxWriteQueueSize,
+    kStatsFieldsCount
+  };
+
   StreamResource() : after_write_cb_(nullptr),
                      alloc_cb_(nullptr),
                      read_cb_(nullptr) {
+    for (int i = 0; i < kStatsFieldsCount; i++)
+      stats_fields_[i] = 0;
   }
 
   virtual ~StreamResource() = default;
@@ -120,6 +149,11 @@ class StreamResource {
                       uv_buf_t* bufs,
                       size_t count,
                       uv_stream_t* send_handle) = 0;
+  virtual int DoTrySendFile(uv_file fd, int64_t* offset, size_t* length);
+  virtual int DoSendFile(WriteWrap* w,
+                         uv_file fd,
+                         int64_t offset,
+                         size_t length);
   virtual const char* Error() const;
   virtual void ClearError();
 
@@ -137,6 +171,10 @@ class StreamResource {
   inline void OnRead(size_t nread,
                      const uv_buf_t* buf,
                      uv_handle_type pending = UV_UNKNOWN_HANDLE) {
+    if (static_cast<ssize_t>(nread) > 0) {
+      stats_fields_[kReads] += 1;
+      stats_fields_[kBytesRead] += nread;
+    }
     if (read_cb_ != nullptr)
       read_cb_(nread, buf, pending, read_ctx_);
   }
@@ -156,6 +194,32 @@ class StreamResource {
     read_ctx_ = ctx;
   }
 
+  // `unsent` is what was left for DoWrite() after DoTryWrite().
+  inline void CountWrite(size_t bytes, size_t unsent) {
+    stats_fields_[kWrites] += 1;
+    stats_fields_[kBytesWritten] += bytes;
+    if (unsent == 0) {
+      stats_fields_[kTryWrites] += 1;
+    } else {
+      stats_fields_[kQueuedWrites] += 1;
+      if (unsent < bytes)
+        stats_fields_[kPartialWrites] += 1;
+    }
+  }
+
+  inline void CountWriteQueueSize(size_t size) {
+    if (size > stats_fields_[kMaxWriteQueueSize])
+      stats_fields_[kMaxWriteQueueSize] = size;
+  }
+
+  inline double* stats_fields() { return stats_fields_; }
+  inline int stats_fields_count() const { return kStatsFieldsCount; }
+
+  inline AllocCb alloc_cb() const { return alloc_cb_; }
+  inline void* alloc_ctx() const { return alloc_ctx_; }
+  inline ReadCb read_cb() const { return read_cb_; }
+  inline void* read_ctx() const { return read_ctx_; }
+
  private:
   AfterWriteCb after_write_cb_;
   void* after_write_ctx_;
@@ -163,6 +227,7 @@ class StreamResource {
   void* alloc_ctx_;
   ReadCb read_cb_;
   void* read_ctx_;
+  double stats_fields_[kStatsFieldsCount];
 };
 
 class StreamBase : public StreamResource {
@@ -192,6 +257,13 @@ class StreamBase : public StreamResource {
     consumed_ = true;
   }
 
+  inline void Unconsume() {
+    CHECK_EQ(consumed_, true);
+    consumed_ = false;
+  }
+
+  inline bool IsConsumed() const { return consumed_; }
+
   template <class Outer>
   inline Outer* Cast() { return static_cast<Outer*>(Cast()); }
 
@@ -200,10 +272,13 @@ class StreamBase : public StreamResource {
                 v8::Local<v8::Object> handle);
 
  protected:
-  explicit StreamBase(Environment* env) : env_(env), consumed_(false) {
+  explicit StreamBase(Environment* env) : env_(env),
+                                          consumed_(false),
+                                          read_pipe_(nullptr),
+                                          write_pipe_(nullptr) {
   }
 
-  virtual ~StreamBase() = default;
+  virtual ~StreamBase();
 
   virtual AsyncWrap* GetAsyncWrap() = 0;
 
@@ -217,6 +292,7 @@ class StreamBase : public StreamResource {
   int Shutdown(const v8::FunctionCallbackInfo<v8::Value>& args);
   int Writev(const v8::FunctionCallbackInfo<v8::Value>& args);
   int WriteBuffer(const v8::FunctionCallbackInfo<v8::Value>& args);
+  int SendFile(const v8::FunctionCallbackInfo<v8::Value>& args);
   template <enum encoding enc>
   int WriteString(const v8::FunctionCallbackInfo<v8::Value>& args);
 
@@ -224,14 +300,88 @@ class StreamBase : public StreamResource {
   static void GetFD(v8::Local<v8::String>,
                     const v8::PropertyCallbackInfo<v8::Value>&);
 
+  template <class Base>
+  static void GetExternal(v8::Local<v8::String>,
+                          const v8::PropertyCallbackInfo<v8::Value>&);
+
+  template <class Base>
+  static void GetStats(v8::Local<v8::String>,
+                       const v8::PropertyCallbackInfo<v8::Value>&);
+
   template <class Base,
             int (StreamBase::*Method)(  // NOLINT(whitespace/parens)
       const v8::FunctionCallbackInfo<v8::Value>& args)>
   static void JSMethod(const v8::FunctionCallbackInfo<v8::Value>& args);
 
  private:
+  friend class StreamPipe;
+
   Environment* env_;
   bool consumed_;
+  v8::Persistent<v8::Object> stats_object_;
+
+  // The pipes that read from and write to this stream, if any
+  StreamPipe* read_pipe_;
+  StreamPipe* write_pipe_;
+};
+
+
+// Moves everything that one stream reads to another stream without going
+// through JS land. The source stops reading while more than kMaxPendingBytes
+// wait to be written and resumes when the sink catches up. EOF and read
+// errors are handed to the source's own read callback once everything that
+// was read before them has been written.
+class StreamPipe : public AsyncWrap {
+ public:
+  ~StreamPipe() override;
+
+  static void Initialize(Environment* env, v8::Handle<v8::Object> target);
+
+  // Called by ~StreamBase()
+  void OnStreamGone(StreamBase* stream);
+
+  static const size_t kMaxPendingBytes = 64 * 1024;
+
+ private:
+  // Lives in the extra storage of the WriteWraps that go to the sink
+  struct WriteReq {
+    StreamPipe* pipe;
+    char* base;  // Read buffer to give back once written
+    size_t size;
+    size_t pending;
+  };
+
+  StreamPipe(Environment* env, v8::Local<v8::Object> object);
+
+  static void New(const v8::FunctionCallbackInfo<v8::Value>& args);
+  static void Start(const v8::FunctionCallbackInfo<v8::Value>& args);
+  static void Unpipe(const v8::FunctionCallbackInfo<v8::Value>& args);
+
+  static void OnAllocImpl(size_t size, uv_buf_t* buf, void* ctx);
+  static void OnReadImpl(ssize_t nread,
+                         const uv_buf_t* buf,
+                         uv_handle_type pending,
+                         void* ctx);
+  static void AfterWrite(WriteWrap* req_wrap, int status);
+
+  int Start(StreamBase* source, StreamBase* sink);
+  void Write(char* base, size_t size, size_t nread);
+  void Stop();
+  void Fail(int status);
+
+  StreamBase* source_;
+  StreamBase* sink_;
+  bool piping_;
+  bool paused_;
+  ssize_t pending_eof_;
+  size_t pending_bytes_;
+  int pending_writes_;
+
+  // The source's callbacks, restored by Stop()
+  StreamResource::AllocCb prev_alloc_cb_;
+  void* prev_alloc_ctx_;
+  StreamResource::ReadCb prev_read_cb_;
+  void* prev_read_ctx_;
 };
 
 }  // namespace node
@@ -18,6 +18,12 @@
 #include <stdlib.h>  // abort()
 #include <string.h>  // memcpy()
 #include <limits.h>  // INT_MAX
+#include <new>
+
+#ifdef __POSIX__
+# include <sys/mman.h>  // mmap(), mincore()
+# include <unistd.h>  // sysconf()
+#endif  // __POSIX__
 
 
 namespace node {
@@ -25,11 +31,13 @@ namespace node {
 using v8::Array;
 using v8::Context;
 using v8::EscapableHandleScope;
+using v8::Function;
 using v8::FunctionCallbackInfo;
 using v8::FunctionTemplate;
 using v8::Handle;
 using v8::HandleScope;
 using v8::Integer;
+using v8::kExternalFloat64Array;
 using v8::Local;
 using v8::Number;
 using v8::Object;
@@ -59,6 +67,27 @@ void StreamWrap::Initialize(Handle<Object> target,
   target->Set(FIXED_ONE_BYTE_STRING(env->isolate(), "WriteWrap"),
               ww->GetFunction());
   env->set_write_wrap_constructor_function(ww->GetFunction());
+
+  StreamPipe::Initialize(env, target);
+
+  // Read buffer pool counters, see Environment::ReadBufferPool::Fields.
+  Environment::ReadBufferPool* pool = env->read_buffer_pool();
+  Local<Object> pool_stats = Object::New(env->isolate());
+  pool_stats->SetIndexedPropertiesToExternalArrayData(pool->fields(),
+                                                      kExternalFloat64Array,
+                                                      pool->fields_count());
+  target->Set(FIXED_ONE_BYTE_STRING(env->isolate(), "readBufferPoolStats"),
+              pool_stats);
+
+  // Write coalescing counters, see Environment::WriteCoalescing::Fields.
+  Environment::WriteCoalescing* coalescing = env->write_coalescing();
+  Local<Object> coalescing_stats = Object::New(env->isolate());
+  coalescing_stats->SetIndexedPropertiesToExternalArrayData(
+      coalescing->fields(),
+      kExternalFloat64Array,
+      coalescing->fields_count());
+  target->Set(FIXED_ONE_BYTE_STRING(env->isolate(), "writeCoalescingStats"),
+              coalescing_stats);
 }
 
 
@@ -73,17 +102,45 @@ StreamWrap::StreamWrap(Environment* env,
                  provider,
                  parent),
       StreamBase(env),
-      stream_(stream) {
+      stream_(stream),
+      coalesce_limit_(0),
+      coalesce_buf_(nullptr),
+      coalesce_size_(0),
+      coalesce_count_(0),
+      coalesce_error_(0),
+      coalesce_check_(nullptr),
+      coalesce_idle_(nullptr) {
   set_after_write_cb(OnAfterWriteImpl, this);
   set_alloc_cb(OnAllocImpl, this);
   set_read_cb(OnReadImpl, this);
 }
 
 
+template <typename T>
+static void DeleteHandle(uv_handle_t* handle) {
+  delete reinterpret_cast<T*>(handle);
+}
+
+
+StreamWrap::~StreamWrap() {
+  // Anything still coalesced goes the way of the writes that uv_close()
+  // cancelled. sendfile_reads_ lets go of pending reads when it is
+  // destroyed, see AfterSendFileRead().
+  free(coalesce_buf_);
+  if (coalesce_check_ != nullptr) {
+    uv_close(reinterpret_cast<uv_handle_t*>(coalesce_check_),
+             DeleteHandle<uv_check_t>);
+    uv_close(reinterpret_cast<uv_handle_t*>(coalesce_idle_),
+             DeleteHandle<uv_idle_t>);
+  }
+}
+
+
 void StreamWrap::AddMethods(Environment* env,
                             v8::Handle<v8::FunctionTemplate> target,
                             int flags) {
   env->SetProtoMethod(target, "setBlocking", SetBlocking);
+  env->SetProtoMethod(target, "setWriteCoalescing", SetWriteCoalescing);
   StreamBase::AddMethods<StreamWrap>(env, target, flags);
 }
 
@@ -124,6 +181,7 @@ bool StreamWrap::IsIPCPipe() {
 
 
 void StreamWrap::UpdateWriteQueueSize() {
+  CountWriteQueueSize(stream()->write_queue_size);
   HandleScope scope(env()->isolate());
   Local<Integer> write_queue_size =
       Integer::NewFromUnsigned(env()->isolate(), stream()->write_queue_size);
@@ -155,7 +213,8 @@ void StreamWrap::OnAlloc(uv_handle_t* handle,
 
 
 void StreamWrap::OnAllocImpl(size_t size, uv_buf_t* buf, void* ctx) {
-  buf->base = static_cast<char*>(malloc(size));
+  StreamWrap* wrap = static_cast<StreamWrap*>(ctx);
+  buf->base = wrap->env()->read_buffer_pool()->Acquire(size);
   buf->len = size;
 
   if (buf->base == nullptr && size > 0) {
@@ -192,6 +251,7 @@ void StreamWrap::OnReadImpl(ssize_t nread,
                             void* ctx) {
   StreamWrap* wrap = static_cast<StreamWrap*>(ctx);
   Environment* env = wrap->env();
+  Environment::ReadBufferPool* pool = env->read_buffer_pool();
   HandleScope handle_scope(env->isolate());
   Context::Scope context_scope(env->context());
 
@@ -199,20 +259,33 @@ void StreamWrap::OnReadImpl(ssize_t nread,
 
   if (nread < 0)  {
     if (buf->base != nullptr)
-      free(buf->base);
+      pool->Release(buf->base, buf->len);
     wrap->EmitData(nread, Local<Object>(), pending_obj);
     return;
   }
 
   if (nread == 0) {
     if (buf->base != nullptr)
-      free(buf->base);
+      pool->Release(buf->base, buf->len);
     return;
   }
 
-  char* base = static_cast<char*>(realloc(buf->base, nread));
   CHECK_LE(static_cast<size_t>(nread), buf->len);
 
+  // Small reads are copied out so that the read buffer can go back to the
+  // pool, large ones take ownership of the read buffer itself.
+  Local<Object> buf_obj;
+  const size_t copy_threshold = Environment::ReadBufferPool::kCopyThreshold;
+  if (static_cast<size_t>(nread) < copy_threshold) {
+    buf_obj = Buffer::New(env, buf->base, nread);
+    pool->Release(buf->base, buf->len);
+    pool->CountCopy();
+  } else {
+    char* base = static_cast<char*>(realloc(buf->base, nread));
+    buf_obj = Buffer::Use(env, base, nread);
+    pool->CountHandOff();
+  }
+
   if (pending == UV_TCP) {
     pending_obj = AcceptHandle<TCPWrap, uv_tcp_t>(env, wrap);
   } else if (pending == UV_NAMED_PIPE) {
@@ -223,7 +296,7 @@ void StreamWrap::OnReadImpl(ssize_t nread,
     CHECK_EQ(pending, UV_UNKNOWN_HANDLE);
   }
 
-  wrap->EmitData(nread, Buffer::Use(env, base, nread), pending_obj);
+  wrap->EmitData(nread, buf_obj, pending_obj);
 }
 
 
@@ -278,9 +351,159 @@ void StreamWrap::SetBlocking(const FunctionCallbackInfo<Value>& args) {
 }
 
 
+// handle.setWriteCoalescing(maxBytes)
+// Writes issued while nothing is queued are collected and written out with
+// a single syscall at the end of the loop iteration, or as soon as more than
+// `maxBytes` would have to be held back. Zero turns coalescing off again.
+void StreamWrap::SetWriteCoalescing(const FunctionCallbackInfo<Value>& args) {
+  StreamWrap* wrap = Unwrap<StreamWrap>(args.Holder());
+
+  CHECK_GT(args.Length(), 0);
+  if (!wrap->IsAlive())
+    return args.GetReturnValue().Set(UV_EINVAL);
+
+  int err = wrap->FlushCoalescedWrites();
+  free(wrap->coalesce_buf_);
+  wrap->coalesce_buf_ = nullptr;
+  wrap->coalesce_limit_ = args[0]->Uint32Value();
+
+  args.GetReturnValue().Set(err);
+}
+
+
+void StreamWrap::CoalesceWrite(uv_buf_t* bufs, size_t count, size_t size) {
+  for (size_t i = 0; i < count; i++) {
+    memcpy(coalesce_buf_ + coalesce_size_, bufs[i].base, bufs[i].len);
+    coalesce_size_ += bufs[i].len;
+  }
+  coalesce_count_ += 1;
+  env()->write_coalescing()->CountWrite(size);
+
+  if (coalesce_check_ == nullptr) {
+    coalesce_check_ = new uv_check_t;
+    coalesce_idle_ = new uv_idle_t;
+    uv_check_init(env()->event_loop(), coalesce_check_);
+    uv_idle_init(env()->event_loop(), coalesce_idle_);
+    coalesce_check_->data = this;
+    coalesce_idle_->data = this;
+  }
+
+  // The idle handle keeps the loop from blocking in the poll phase when the
+  // check phase has already passed in this iteration.
+  uv_check_start(coalesce_check_, OnCoalesceCheck);
+  uv_idle_start(coalesce_idle_, OnCoalesceIdle);
+}
+
+
+// Writes out the coalesced data, whatever the socket doesn't take right
+// away is queued with a write request that takes over the buffer.
+int StreamWrap::FlushCoalescedWrites() {
+  if (coalesce_check_ != nullptr) {
+    uv_check_stop(coalesce_check_);
+    uv_idle_stop(coalesce_idle_);
+  }
+
+  if (coalesce_size_ == 0)
+    return 0;
+
+  char* data = coalesce_buf_;
+  size_t size = coalesce_size_;
+
+  env()->write_coalescing()->CountFlush(coalesce_count_);
+  coalesce_size_ = 0;
+  coalesce_count_ = 0;
+
+  if (IsClosing())
+    return 0;
+
+  uv_buf_t buf = uv_buf_init(data, size);
+  int err = uv_try_write(stream(), &buf, 1);
+  if (err == UV_ENOSYS || err == UV_EAGAIN)
+    err = 0;
+  if (err < 0)
+    return err;
+
+  if (static_cast<size_t>(err) < size) {
+    buf.base += err;
+    buf.len -= err;
+
+    uv_write_t* req = new uv_write_t;
+    req->data = data;
+    err = uv_write(req, stream(), &buf, 1, AfterCoalescedWrite);
+    if (err) {
+      delete req;
+      return err;
+    }
+
+    // The buffer belongs to the write request now.
+    coalesce_buf_ = nullptr;
+    UpdateWriteQueueSize();
+  }
+
+  if (is_tcp()) {
+    NODE_COUNT_NET_BYTES_SENT(size);
+  } else if (is_named_pipe()) {
+    NODE_COUNT_PIPE_BYTES_SENT(size);
+  }
+
+  return 0;
+}
+
+
+void StreamWrap::OnCoalesceCheck(uv_check_t* handle) {
+  StreamWrap* wrap = static_cast<StreamWrap*>(handle->data);
+  HandleScope scope(wrap->env()->isolate());
+  Context::Scope context_scope(wrap->env()->context());
+
+  int err = wrap->FlushCoalescedWrites();
+  if (err != 0)
+    wrap->OnCoalesceError(err);
+}
+
+
+void StreamWrap::OnCoalesceIdle(uv_idle_t* handle) {
+  // Nothing to do, see CoalesceWrite().
+}
+
+
+void StreamWrap::AfterCoalescedWrite(uv_write_t* req, int status) {
+  StreamWrap* wrap = static_cast<StreamWrap*>(req->handle->data);
+  free(req->data);
+  delete req;
+
+  if (status == UV_ECANCELED)
+    return;
+
+  HandleScope scope(wrap->env()->isolate());
+  Context::Scope context_scope(wrap->env()->context());
+  wrap->UpdateWriteQueueSize();
+  if (status != 0)
+    wrap->OnCoalesceError(status);
+}
+
+
+// The writes that the data came from have completed already, so there is no
+// write request to report the error to. Tell handle.onerror right away, the
+// stream may never see another write. Without a handler the next write gets
+// the error.
+void StreamWrap::OnCoalesceError(int err) {
+  Local<Value> cb = object()->Get(env()->onerror_string());
+  if (!cb->IsFunction()) {
+    if (coalesce_error_ == 0)
+      coalesce_error_ = err;
+    return;
+  }
+
+  Local<Value> arg = Integer::New(env()->isolate(), err);
+  MakeCallback(cb.As<Function>(), 1, &arg);
+}
+
+
 int StreamWrap::DoShutdown(ShutdownWrap* req_wrap) {
   int err;
-  err = uv_shutdown(&req_wrap->req_, stream(), AfterShutdown);
+  err = FlushCoalescedWrites();
+  if (err == 0)
+    err = uv_shutdown(&req_wrap->req_, stream(), AfterShutdown);
   req_wrap->Dispatched();
   return err;
 }
@@ -304,6 +527,41 @@ int StreamWrap::DoTryWrite(uv_buf_t** bufs, size_t* count) {
   uv_buf_t* vbufs = *bufs;
   size_t vcount = *count;
 
+  if (coalesce_limit_ > 0) {
+    if (coalesce_error_ != 0) {
+      err = coalesce_error_;
+      coalesce_error_ = 0;
+      return err;
+    }
+
+    size_t size = 0;
+    for (size_t i = 0; i < vcount; i++)
+      size += vbufs[i].len;
+
+    // Write out what has been held back so far when this write doesn't fit
+    // in the remaining space or has to go out directly.
+    if (stream()->write_queue_size != 0 ||
+        size > coalesce_limit_ - coalesce_size_) {
+      err = FlushCoalescedWrites();
+      if (err != 0)
+        return err;
+    }
+
+    // Only coalesce while nothing is queued, held back data must not get
+    // around the backpressure that writeQueueSize signals.
+    if (stream()->write_queue_size == 0 && size <= coalesce_limit_) {
+      if (coalesce_buf_ == nullptr)
+        coalesce_buf_ = static_cast<char*>(malloc(coalesce_limit_));
+      if (coalesce_buf_ != nullptr) {
+        CoalesceWrite(vbufs, vcount, size);
+        *bufs = vbufs + vcount;
+        *count = 0;
+        return 0;
+      }
+      // Out of memory, write it out directly.
+    }
+  }
+
   err = uv_try_write(stream(), vbufs, vcount);
   if (err == UV_ENOSYS || err == UV_EAGAIN)
     return 0;
@@ -338,11 +596,14 @@ int StreamWrap::DoWrite(WriteWrap* w,
                         uv_buf_t* bufs,
                         size_t count,
                         uv_stream_t* send_handle) {
-  int r;
-  if (send_handle == nullptr) {
-    r = uv_write(&w->req_, stream(), bufs, count, AfterWrite);
-  } else {
-    r = uv_write2(&w->req_, stream(), bufs, count, send_handle, AfterWrite);
+  // Data that write coalescing held back has to go out first.
+  int r = FlushCoalescedWrites();
+  if (r == 0) {
+    if (send_handle == nullptr) {
+      r = uv_write(&w->req_, stream(), bufs, count, AfterWrite);
+    } else {
+      r = uv_write2(&w->req_, stream(), bufs, count, send_handle, AfterWrite);
+    }
   }
 
   if (!r) {
@@ -363,6 +624,311 @@ int StreamWrap::DoWrite(WriteWrap* w,
 }
 
 
+// How much of the file at `offset` is in the page cache, looking at up to
+// 1 MB. sendfile() on the loop thread is limited to that much, it would block
+// the event loop while the kernel reads the rest from disk.
+static size_t CachedLength(uv_file fd, int64_t offset, size_t length) {
+#ifdef __POSIX__
+#if defined(__linux__)
+  typedef unsigned char mincore_vec_t;
+#else
+  typedef char mincore_vec_t;
+#endif
+  static const size_t kWindow = 1024 * 1024;
+  static const size_t kPageSize = sysconf(_SC_PAGESIZE);
+  mincore_vec_t vec[kWindow / 4096 + 2];
+
+  size_t skew = static_cast<size_t>(offset % kPageSize);
+  size_t size = skew + (length < kWindow ? length : kWindow);
+  size_t pages = (size + kPageSize - 1) / kPageSize;
+  if (pages > ARRAY_SIZE(vec)) {
+    pages = ARRAY_SIZE(vec);
+    size = pages * kPageSize;
+  }
+
+  void* addr = mmap(nullptr,
+                    size,
+                    PROT_READ,
+                    MAP_SHARED,
+                    fd,
+                    static_cast<off_t>(offset - skew));
+  if (addr == MAP_FAILED)
+    return 0;
+  int err = mincore(static_cast<char*>(addr), size, vec);
+  munmap(addr, size);
+  if (err != 0)
+    return 0;
+
+  size_t cached = 0;
+  while (cached < pages && (vec[cached] & 1))
+    cached++;
+  cached *= kPageSize;
+  if (cached <= skew)
+    return 0;
+  cached -= skew;
+  return cached < length ? cached : length;
+#else
+  return 0;
+#endif  // __POSIX__
+}
+
+
+// Sends as much of the file as the socket takes without blocking. `offset`
+// and `length` are advanced past the data that has been sent. Stops early at
+// data that isn't in the page cache, DoSendFile() reads that in the thread
+// pool.
+int StreamWrap::DoTrySendFile(uv_file fd, int64_t* offset, size_t* length) {
+  size_t cached = 0;
+  return TrySendFile(fd, offset, length, &cached);
+}
+
+
+// Like DoTrySendFile(), but `cached` carries what is known to be in the page
+// cache from `offset` on over from the previous call, so that a sendFile()
+// request looks at the page cache once per window rather than once per
+// sendfile(). Pages that were evicted since just make sendfile() block
+// for a moment.
+int StreamWrap::TrySendFile(uv_file fd,
+                            int64_t* offset,
+                            size_t* length,
+                            size_t* cached) {
+  int out_fd = GetFD();
+  if (out_fd < 0)
+    return UV_ENOSYS;
+
+  int err = FlushCoalescedWrites();
+  if (err != 0)
+    return err;
+
+  // Don't jump the queue, queued writes have to go out first.
+  if (stream()->write_queue_size != 0)
+    return 0;
+
+  size_t sent = 0;
+  while (*length > 0) {
+    if (*cached == 0)
+      *cached = CachedLength(fd, *offset, *length);
+    if (*cached == 0)
+      break;
+
+    uv_fs_t req;
+    err = uv_fs_sendfile(env()->event_loop(),
+                         &req,
+                         out_fd,
+                         fd,
+                         *offset,
+                         *cached,
+                         nullptr);
+    uv_fs_req_cleanup(&req);
+    if (err == UV_EAGAIN) {
+      err = 0;
+      break;
+    }
+    if (err == 0)
+      err = UV_EOF;
+    if (err < 0)
+      break;
+
+    *offset += err;
+    *length -= err;
+    *cached -= err;
+    sent += err;
+    err = 0;
+  }
+
+  if (sent > 0) {
+    if (is_tcp()) {
+      NODE_COUNT_NET_BYTES_SENT(sent);
+    } else if (is_named_pipe()) {
+      NODE_COUNT_PIPE_BYTES_SENT(sent);
+    }
+  }
+
+  return err;
+}
+
+
+// The socket is full (or has writes queued up), or the file isn't cached, so
+// read the next chunk of the file and let uv_write() tell us when the socket
+// drains again. From then on sendfile() takes over until the socket fills up
+// again or it gets to data that has to come from disk.
+int StreamWrap::DoSendFile(WriteWrap* w,
+                           uv_file fd,
+                           int64_t offset,
+                           size_t length) {
+  SendFileReq* req = new(w->Extra()) SendFileReq();
+  req->fd = fd;
+  req->offset = offset;
+  req->length = length;
+  req->cached = 0;
+  req->chunk = nullptr;
+
+  int err = WriteSendFileChunk(w);
+  if (err != 0) {
+    free(req->chunk);
+    req->~SendFileReq();
+  }
+
+  w->Dispatched();
+  UpdateWriteQueueSize();
+
+  return err;
+}
+
+
+// Reads the next chunk and queues it for writing. Cached data is read right
+// away, anything else in the thread pool. Returns 0 when the request goes on
+// asynchronously.
+int StreamWrap::WriteSendFileChunk(WriteWrap* w) {
+  static const size_t kChunkSize = 64 * 1024;
+  SendFileReq* req = reinterpret_cast<SendFileReq*>(w->Extra());
+
+  if (req->chunk == nullptr) {
+    req->chunk = static_cast<char*>(malloc(kChunkSize));
+    if (req->chunk == nullptr)
+      return UV_ENOMEM;
+  }
+
+  uv_buf_t buf = uv_buf_init(req->chunk,
+                             req->length < kChunkSize ? req->length
+                                                      : kChunkSize);
+  if (req->cached < buf.len)
+    req->cached = CachedLength(req->fd, req->offset, req->length);
+  if (req->cached >= buf.len) {
+    uv_fs_t read_req;
+    int err = uv_fs_read(env()->event_loop(),
+                         &read_req,
+                         req->fd,
+                         &buf,
+                         1,
+                         req->offset,
+                         nullptr);
+    uv_fs_req_cleanup(&read_req);
+    return WriteSendFileData(w, err);
+  }
+
+  req->read_req.data = w;
+  int err = uv_fs_read(env()->event_loop(),
+                       &req->read_req,
+                       req->fd,
+                       &buf,
+                       1,
+                       req->offset,
+                       AfterSendFileRead);
+  if (err == 0)
+    sendfile_reads_.PushBack(req);
+  return err;
+}
+
+
+int StreamWrap::WriteSendFileData(WriteWrap* w, ssize_t nread) {
+  SendFileReq* req = reinterpret_cast<SendFileReq*>(w->Extra());
+  if (nread == 0)
+    return UV_EOF;
+  if (nread < 0)
+    return nread;
+
+  uv_buf_t buf = uv_buf_init(req->chunk, nread);
+  req->offset += nread;
+  req->length -= nread;
+  req->cached = req->cached > static_cast<size_t>(nread) ? req->cached - nread
+                                                         : 0;
+
+  int err = uv_write(&w->req_, stream(), &buf, 1, AfterSendFileWrite);
+  if (err == 0) {
+    if (is_tcp()) {
+      NODE_COUNT_NET_BYTES_SENT(buf.len);
+    } else if (is_named_pipe()) {
+      NODE_COUNT_PIPE_BYTES_SENT(buf.len);
+    }
+  }
+
+  return err;
+}
+
+
+void StreamWrap::AfterSendFileRead(uv_fs_t* req) {
+  WriteWrap* req_wrap = static_cast<WriteWrap*>(req->data);
+  SendFileReq* sf_req = ContainerOf(&SendFileReq::read_req, req);
+  Environment* env = req_wrap->env();
+  ssize_t nread = req->result;
+  uv_fs_req_cleanup(req);
+
+  HandleScope scope(env->isolate());
+  Context::Scope context_scope(env->context());
+
+  // ~StreamWrap() took the request off the list, the stream is gone. Tell
+  // the request object directly so that the caller can close the file.
+  if (sf_req->member.IsEmpty()) {
+    free(sf_req->chunk);
+    sf_req->~SendFileReq();
+    Local<Object> req_wrap_obj = req_wrap->object();
+    Local<Value> argv[] = {
+      Integer::New(env->isolate(), UV_ECANCELED),
+      Undefined(env->isolate()),
+      req_wrap_obj,
+      Undefined(env->isolate())
+    };
+    if (req_wrap_obj->Has(env->oncomplete_string()))
+      req_wrap->MakeCallback(env->oncomplete_string(), ARRAY_SIZE(argv), argv);
+    req_wrap->Dispose();
+    return;
+  }
+
+  sf_req->member.Remove();
+  StreamWrap* wrap = static_cast<StreamWrap*>(req_wrap->wrap());
+  int status = UV_ECANCELED;
+  if (!wrap->IsClosing())
+    status = wrap->WriteSendFileData(req_wrap, nread);
+
+  if (status == 0) {
+    wrap->UpdateWriteQueueSize();
+    return;
+  }
+
+  FinishSendFile(req_wrap, status);
+}
+
+
+void StreamWrap::AfterSendFileWrite(uv_write_t* req, int status) {
+  WriteWrap* req_wrap = ContainerOf(&WriteWrap::req_, req);
+  StreamWrap* wrap = static_cast<StreamWrap*>(req_wrap->wrap());
+  SendFileReq* sf_req = reinterpret_cast<SendFileReq*>(req_wrap->Extra());
+  HandleScope scope(req_wrap->env()->isolate());
+  Context::Scope context_scope(req_wrap->env()->context());
+
+  if (status == 0 && wrap->IsClosing())
+    status = UV_ECANCELED;
+  if (status == 0)
+    status = wrap->TrySendFile(sf_req->fd,
+                               &sf_req->offset,
+                               &sf_req->length,
+                               &sf_req->cached);
+
+  // Once a chunk is queued, its own AfterSendFileWrite() carries on, even
+  // when it is the last one.
+  if (status == 0 && sf_req->length > 0) {
+    status = wrap->WriteSendFileChunk(req_wrap);
+    if (status == 0) {
+      req_wrap->Dispatched();
+      wrap->UpdateWriteQueueSize();
+      return;
+    }
+  }
+
+  FinishSendFile(req_wrap, status);
+}
+
+
+void StreamWrap::FinishSendFile(WriteWrap* w, int status) {
+  SendFileReq* req = reinterpret_cast<SendFileReq*>(w->Extra());
+  free(req->chunk);
+  req->~SendFileReq();
+  w->Dispatched();
+  w->Done(status);
+}
+
+
 void StreamWrap::AfterWrite(uv_write_t* req, int status) {
   WriteWrap* req_wrap = ContainerOf(&WriteWrap::req_, req);
   HandleScope scope(req_wrap->env()->isolate());
@@ -36,6 +36,11 @@ class StreamWrap : public HandleWrap, public StreamBase {
               uv_buf_t* bufs,
               size_t count,
               uv_stream_t* send_handle) override;
+  int DoTrySendFile(uv_file fd, int64_t* offset, size_t* length) override;
+  int DoSendFile(WriteWrap* w,
+                 uv_file fd,
+                 int64_t offset,
+                 size_t length) override;
 
   inline uv_stream_t* stream() const {
     return stream_;
@@ -61,8 +66,7 @@ class StreamWrap : public HandleWrap, public StreamBase {
              AsyncWrap::ProviderType provider,
              AsyncWrap* parent = nullptr);
 
-  ~StreamWrap() {
-  }
+  ~StreamWrap();
 
   AsyncWrap* GetAsyncWrap() override;
   void UpdateWriteQueueSize();
@@ -73,6 +77,16 @@ class StreamWrap : public HandleWrap, public StreamBase {
 
  private:
   static void SetBlocking(const v8::FunctionCallbackInfo<v8::Value>& args);
+  static void SetWriteCoalescing(
+      const v8::FunctionCallbackInfo<v8::Value>& args);
+
+  // Write coalescing
+  void CoalesceWrite(uv_buf_t* bufs, size_t count, size_t size);
+  int FlushCoalescedWrites();
+  static void OnCoalesceCheck(uv_check_t* handle);
+  static void OnCoalesceIdle(uv_idle_t* handle);
+  static void AfterCoalescedWrite(uv_write_t* req, int status);
+  void OnCoalesceError(int err);
 
   // Callbacks for libuv
   static void OnAlloc(uv_handle_t* handle,
@@ -87,6 +101,12 @@ class StreamWrap : public HandleWrap, public StreamBase {
                            const uv_buf_t* buf,
                            uv_handle_type pending);
   static void AfterWrite(uv_write_t* req, int status);
+  static void AfterSendFileWrite(uv_write_t* req, int status);
+  static void AfterSendFileRead(uv_fs_t* req);
+  int TrySendFile(uv_file fd, int64_t* offset, size_t* length, size_t* cached);
+  int WriteSendFileChunk(WriteWrap* w);
+  int WriteSendFileData(WriteWrap* w, ssize_t nread);
+  static void FinishSendFile(WriteWrap* w, int status);
   static void AfterShutdown(uv_shutdown_t* req, int status);
 
   // Resource interface implementation
@@ -98,6 +118,19 @@ class StreamWrap : public HandleWrap, public StreamBase {
                          void* ctx);
 
   uv_stream_t* const stream_;
+
+  // Small writes are copied into coalesce_buf_ and written out in one go at
+  // the end of the loop iteration, or earlier when coalesce_limit_ is hit.
+  size_t coalesce_limit_;
+  char* coalesce_buf_;
+  size_t coalesce_size_;
+  size_t coalesce_count_;
+  int coalesce_error_;
+  uv_check_t* coalesce_check_;
+  uv_idle_t* coalesce_idle_;
+
+  // sendFile() requests that wait for a read from the thread pool.
+  ListHead<SendFileReq, &SendFileReq::member> sendfile_reads_;
 };
 
 
@@ -11,11 +11,19 @@
 #include "util.h"
 #include "util-inl.h"
 
+#include <errno.h>
+#include <fcntl.h>  // fcntl()
 #include <stdlib.h>
 
+#if !defined(_WIN32)
+#include <sys/socket.h>
+#include <unistd.h>  // close()
+#endif
+
 
 namespace node {
 
+using v8::Array;
 using v8::Boolean;
 using v8::Context;
 using v8::EscapableHandleScope;
@@ -101,6 +109,7 @@ void TCPWrap::Initialize(Handle<Object> target,
   env->SetProtoMethod(t, "getpeername", GetPeerName);
   env->SetProtoMethod(t, "setNoDelay", SetNoDelay);
   env->SetProtoMethod(t, "setKeepAlive", SetKeepAlive);
+  env->SetProtoMethod(t, "setAcceptBatchSize", SetAcceptBatchSize);
 
 #ifdef _WIN32
   env->SetProtoMethod(t, "setSimultaneousAccepts", SetSimultaneousAccepts);
@@ -148,7 +157,11 @@ TCPWrap::TCPWrap(Environment* env, Handle<Object> object, AsyncWrap* parent)
                  object,
                  reinterpret_cast<uv_stream_t*>(&handle_),
                  AsyncWrap::PROVIDER_TCPWRAP,
-                 parent) {
+                 parent),
+      accept_batch_size_(0),
+      accept_batch_count_(0),
+      accept_paused_(false),
+      accept_check_(nullptr) {
   int r = uv_tcp_init(env->event_loop(), &handle_);
   CHECK_EQ(r, 0);  // How do we proxy this error up to javascript?
                    // Suggestion: uv_tcp_init() returns void.
@@ -158,6 +171,12 @@ TCPWrap::TCPWrap(Environment* env, Handle<Object> object, AsyncWrap* parent)
 
 TCPWrap::~TCPWrap() {
   CHECK(persistent().IsEmpty());
+  if (accept_check_ != nullptr) {
+    accept_check_->data = nullptr;
+    uv_close(reinterpret_cast<uv_handle_t*>(accept_check_),
+             OnAcceptCheckClose);
+  }
+  accept_batch_.Reset();
 }
 
 
@@ -239,12 +258,82 @@ void TCPWrap::Open(const FunctionCallbackInfo<Value>& args) {
 }
 
 
+// libuv creates the socket inside uv_tcp_bind(), too late to set
+// SO_REUSEPORT. Create it here instead and hand it to libuv, uv_tcp_bind()
+// then binds the socket that is already open.
+static int SetReusePort(uv_tcp_t* handle, int family) {
+#if defined(SO_REUSEPORT) && !defined(_WIN32)
+  int on = 1;
+  int fd = handle->io_watcher.fd;
+  if (fd != -1) {
+    if (setsockopt(fd, SOL_SOCKET, SO_REUSEPORT, &on, sizeof(on)))
+      return -errno;
+    return 0;
+  }
+
+  // Like the sockets that libuv creates, don't leak it into child processes.
+  // Kernels that predate SOCK_CLOEXEC reject it, fall back to fcntl() then.
+  fd = -1;
+#ifdef SOCK_CLOEXEC
+  fd = socket(family, SOCK_STREAM | SOCK_CLOEXEC, 0);
+#endif
+  if (fd == -1) {
+    fd = socket(family, SOCK_STREAM, 0);
+    if (fd == -1)
+      return -errno;
+    if (fcntl(fd, F_SETFD, FD_CLOEXEC)) {
+      int err = -errno;
+      close(fd);
+      return err;
+    }
+  }
+
+  if (setsockopt(fd, SOL_SOCKET, SO_REUSEPORT, &on, sizeof(on))) {
+    int err = -errno;
+    close(fd);
+    return err;
+  }
+
+  int err = uv_tcp_open(handle, fd);
+  if (err)
+    close(fd);
+  return err;
+#else
+  return UV_ENOTSUP;
+#endif
+}
+
+
+// Switches the server to batched accept mode: up to `size` connections are
+// accepted per event loop iteration and delivered to onconnection as a single
+// array. Once the budget is used up the server stops accepting until the next
+// iteration, so a connection storm can't starve established connections.
+// A size of 0 restores the default of one callback per connection.
+void TCPWrap::SetAcceptBatchSize(const FunctionCallbackInfo<Value>& args) {
+  TCPWrap* wrap = Unwrap<TCPWrap>(args.Holder());
+  CHECK(args[0]->IsUint32());
+  unsigned int size = args[0]->Uint32Value();
+
+  if (size > 0 && wrap->accept_check_ == nullptr) {
+    wrap->accept_check_ = new uv_check_t;
+    uv_check_init(wrap->env()->event_loop(), wrap->accept_check_);
+    uv_unref(reinterpret_cast<uv_handle_t*>(wrap->accept_check_));
+    wrap->accept_check_->data = wrap;
+  }
+
+  wrap->accept_batch_size_ = size;
+}
+
+
 void TCPWrap::Bind(const FunctionCallbackInfo<Value>& args) {
   TCPWrap* wrap = Unwrap<TCPWrap>(args.Holder());
   node::Utf8Value ip_address(args.GetIsolate(), args[0]);
   int port = args[1]->Int32Value();
+  bool reuse_port = args[2]->IsTrue();
   sockaddr_in addr;
   int err = uv_ip4_addr(*ip_address, port, &addr);
+  if (err == 0 && reuse_port)
+    err = SetReusePort(&wrap->handle_, AF_INET);
   if (err == 0) {
     err = uv_tcp_bind(&wrap->handle_,
                       reinterpret_cast<const sockaddr*>(&addr),
@@ -258,8 +347,11 @@ void TCPWrap::Bind6(const FunctionCallbackInfo<Value>& args) {
   TCPWrap* wrap = Unwrap<TCPWrap>(args.Holder());
   node::Utf8Value ip6_address(args.GetIsolate(), args[0]);
   int port = args[1]->Int32Value();
+  bool reuse_port = args[2]->IsTrue();
   sockaddr_in6 addr;
   int err = uv_ip6_addr(*ip6_address, port, &addr);
+  if (err == 0 && reuse_port)
+    err = SetReusePort(&wrap->handle_, AF_INET6);
   if (err == 0) {
     err = uv_tcp_bind(&wrap->handle_,
                       reinterpret_cast<const sockaddr*>(&addr),
@@ -291,20 +383,26 @@ void TCPWrap::OnConnection(uv_stream_t* handle, int status) {
   // uv_close() on the handle.
   CHECK_EQ(tcp_wrap->persistent().IsEmpty(), false);
 
+  if (status == 0 && tcp_wrap->accept_batch_size_ > 0) {
+    // Budget used up. Leave the connection with libuv, that makes it stop
+    // watching the listen socket until OnAcceptBatchCheck() accepts it.
+    if (tcp_wrap->accept_batch_count_ >= tcp_wrap->accept_batch_size_) {
+      tcp_wrap->accept_paused_ = true;
+      uv_check_start(tcp_wrap->accept_check_, OnAcceptBatchCheck);
+      return;
+    }
+    tcp_wrap->AppendToAcceptBatch();
+    return;
+  }
+
   Local<Value> argv[2] = {
     Integer::New(env->isolate(), status),
     Undefined(env->isolate())
   };
 
   if (status == 0) {
-    // Instantiate the client javascript object and handle.
-    Local<Object> client_obj =
-        Instantiate(env, static_cast<AsyncWrap*>(tcp_wrap));
-
-    // Unwrap the client javascript object.
-    TCPWrap* wrap = Unwrap<TCPWrap>(client_obj);
-    uv_stream_t* client_handle = reinterpret_cast<uv_stream_t*>(&wrap->handle_);
-    if (uv_accept(handle, client_handle))
+    Local<Object> client_obj = tcp_wrap->AcceptClient();
+    if (client_obj.IsEmpty())
       return;
 
     // Successful accept. Call the onconnection callback in JavaScript land.
@@ -315,6 +413,87 @@ void TCPWrap::OnConnection(uv_stream_t* handle, int status) {
 }
 
 
+Local<Object> TCPWrap::AcceptClient() {
+  EscapableHandleScope scope(env()->isolate());
+
+  // Instantiate the client javascript object and handle.
+  Local<Object> client_obj = Instantiate(env(), static_cast<AsyncWrap*>(this));
+
+  // Unwrap the client javascript object.
+  TCPWrap* wrap = Unwrap<TCPWrap>(client_obj);
+  uv_stream_t* server_handle = reinterpret_cast<uv_stream_t*>(&handle_);
+  uv_stream_t* client_handle = reinterpret_cast<uv_stream_t*>(&wrap->handle_);
+  if (uv_accept(server_handle, client_handle))
+    return Local<Object>();
+
+  return scope.Escape(client_obj);
+}
+
+
+void TCPWrap::AppendToAcceptBatch() {
+  Local<Object> client_obj = AcceptClient();
+  if (client_obj.IsEmpty())
+    return;
+
+  Local<Array> batch;
+  if (accept_batch_.IsEmpty()) {
+    batch = Array::New(env()->isolate());
+    accept_batch_.Reset(env()->isolate(), batch);
+    uv_check_start(accept_check_, OnAcceptBatchCheck);
+  } else {
+    batch = PersistentToLocal(env()->isolate(), accept_batch_);
+  }
+
+  batch->Set(batch->Length(), client_obj);
+  accept_batch_count_ += 1;
+}
+
+
+void TCPWrap::OnAcceptBatchCheck(uv_check_t* handle) {
+  TCPWrap* wrap = static_cast<TCPWrap*>(handle->data);
+  Environment* env = wrap->env();
+
+  HandleScope handle_scope(env->isolate());
+  Context::Scope context_scope(env->context());
+
+  uv_check_stop(handle);
+  wrap->accept_batch_count_ = 0;
+
+  if (!wrap->accept_batch_.IsEmpty()) {
+    // Reset() frees the persistent's slot, take a real handle first.
+    Local<Value> argv[2] = {
+      Integer::New(env->isolate(), 0),
+      Local<Array>::New(env->isolate(), wrap->accept_batch_)
+    };
+    wrap->accept_batch_.Reset();
+    wrap->MakeCallback(env->onconnection_string(), ARRAY_SIZE(argv), argv);
+  }
+
+  // Pick up the connection that was left with libuv, uv_accept() makes it
+  // resume watching the listen socket. It counts towards the budget of the
+  // next iteration. Don't restart the check handle from inside its own
+  // callback, deliver the connection right away instead.
+  if (wrap->accept_paused_) {
+    wrap->accept_paused_ = false;
+    if (wrap->IsClosing())
+      return;
+    Local<Object> client_obj = wrap->AcceptClient();
+    if (client_obj.IsEmpty())
+      return;
+    Local<Array> batch = Array::New(env->isolate(), 1);
+    batch->Set(0, client_obj);
+    Local<Value> argv[2] = { Integer::New(env->isolate(), 0), batch };
+    wrap->accept_batch_count_ = 1;
+    wrap->MakeCallback(env->onconnection_string(), ARRAY_SIZE(argv), argv);
+  }
+}
+
+
+void TCPWrap::OnAcceptCheckClose(uv_handle_t* handle) {
+  delete reinterpret_cast<uv_check_t*>(handle);
+}
+
+
 void TCPWrap::AfterConnect(uv_connect_t* req, int status) {
   TCPConnectWrap* req_wrap = static_cast<TCPConnectWrap*>(req->data);
   TCPWrap* wrap = static_cast<TCPWrap*>(req->handle->data);
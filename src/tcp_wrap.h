@@ -31,6 +31,8 @@ class TCPWrap : public StreamWrap {
   static void Connect(const v8::FunctionCallbackInfo<v8::Value>& args);
   static void Connect6(const v8::FunctionCallbackInfo<v8::Value>& args);
   static void Open(const v8::FunctionCallbackInfo<v8::Value>& args);
+  static void SetAcceptBatchSize(
+      const v8::FunctionCallbackInfo<v8::Value>& args);
 
 #ifdef _WIN32
   static void SetSimultaneousAccepts(
@@ -39,8 +41,22 @@ class TCPWrap : public StreamWrap {
 
   static void OnConnection(uv_stream_t* handle, int status);
   static void AfterConnect(uv_connect_t* req, int status);
+  static void OnAcceptBatchCheck(uv_check_t* handle);
+  static void OnAcceptCheckClose(uv_handle_t* handle);
+
+  v8::Local<v8::Object> AcceptClient();
+  void AppendToAcceptBatch();
 
   uv_tcp_t handle_;
+
+  // Batched accept mode, see SetAcceptBatchSize(). Accepted connections are
+  // collected in accept_batch_ and handed to JS in one onconnection callback
+  // from the check phase of the event loop.
+  unsigned int accept_batch_size_;
+  unsigned int accept_batch_count_;
+  bool accept_paused_;
+  uv_check_t* accept_check_;
+  v8::Persistent<v8::Array> accept_batch_;
 };
 
 
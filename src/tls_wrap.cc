@@ -26,7 +26,9 @@ using v8::Function;
 using v8::FunctionCallbackInfo;
 using v8::FunctionTemplate;
 using v8::Handle;
+using v8::HandleScope;
 using v8::Integer;
+using v8::kExternalFloat64Array;
 using v8::Local;
 using v8::Null;
 using v8::Object;
@@ -54,7 +56,15 @@ TLSWrap::TLSWrap(Environment* env,
       shutdown_(false),
       error_(nullptr),
       cycle_depth_(0),
-      eof_(false) {
+      eof_(false),
+      async_private_key_(false),
+      key_job_state_(kKeyJobNone),
+      key_job_ret_(0),
+      key_job_info_(0),
+      key_job_destroy_(false),
+      key_job_read_error_(0),
+      key_job_in_(nullptr),
+      key_job_error_count_(0) {
   node::Wrap(object(), this);
   MakeWeak(this);
 
@@ -79,6 +89,8 @@ TLSWrap::~TLSWrap() {
   enc_out_ = nullptr;
   delete clear_in_;
   clear_in_ = nullptr;
+  delete key_job_in_;
+  key_job_in_ = nullptr;
 
   sc_ = nullptr;
 
@@ -150,7 +162,7 @@ void TLSWrap::InitSSL() {
 
   InitNPN(sc_);
 
-  SSL_set_cert_cb(ssl_, SSLWrap<TLSWrap>::SSLCertCallback, this);
+  SSL_set_cert_cb(ssl_, SSLCertCallback, this);
 
   if (is_server()) {
     SSL_set_accept_state(ssl_);
@@ -247,6 +259,13 @@ void TLSWrap::SSLInfoCallback(const SSL* ssl_, int where, int ret) {
   // a non-const SSL* in OpenSSL <= 0.9.7e.
   SSL* ssl = const_cast<SSL*>(ssl_);
   TLSWrap* c = static_cast<TLSWrap*>(SSL_get_app_data(ssl));
+
+  // Called from the thread pool, report it once the job is done
+  if (c->is_key_job_running()) {
+    c->key_job_info_ |= where;
+    return;
+  }
+
   Environment* env = c->env();
   Local<Object> object = c->object();
 
@@ -267,6 +286,165 @@ void TLSWrap::SSLInfoCallback(const SSL* ssl_, int where, int ret) {
 }
 
 
+int TLSWrap::SSLCertCallback(SSL* s, void* arg) {
+  TLSWrap* w = static_cast<TLSWrap*>(arg);
+
+  // Retried by the handshake that continues in the thread pool
+  if (w->is_key_job_running())
+    return 1;
+
+  int rv = SSLWrap<TLSWrap>::SSLCertCallback(s, arg);
+  if (rv != 1)
+    return rv;
+
+  if (w->key_job_state_ == kKeyJobPending)
+    return -1;
+
+  // The certificate is chosen, and this is a full handshake. Pause it here
+  // and let the rest of this handshake step, which generates the ephemeral
+  // key and signs it with the private key, run in the thread pool. The job
+  // is started as soon as OpenSSL has returned, see StartKeyJob().
+  if (w->async_private_key_ && w->CanStartKeyJob()) {
+    w->key_job_state_ = kKeyJobPending;
+    return -1;
+  }
+
+  return 1;
+}
+
+
+bool TLSWrap::CanStartKeyJob() {
+  // A write in progress would consume `enc_out_` concurrently
+  if (write_size_ != 0)
+    return false;
+
+#ifdef NODE__HAVE_TLSEXT_STATUS_CB
+  // Stapling the OCSP response needs V8
+  if (!ocsp_response_.IsEmpty())
+    return false;
+#endif  // NODE__HAVE_TLSEXT_STATUS_CB
+
+#ifdef OPENSSL_NPN_NEGOTIATED
+  // So does advertising NPN protocols
+  if (ssl_->s3->next_proto_neg_seen && !npn_protos_.IsEmpty())
+    return false;
+#endif  // OPENSSL_NPN_NEGOTIATED
+
+  return true;
+}
+
+
+void TLSWrap::StartKeyJob() {
+  CHECK_EQ(key_job_state_, kKeyJobPending);
+  key_job_state_ = kKeyJobRunning;
+  key_job_ret_ = 0;
+  key_job_info_ = 0;
+  key_job_error_count_ = 0;
+
+  // Nothing may call into V8 or touch `ssl_` and its BIOs on this thread
+  // until KeyJobAfter(). Reads are held back in `key_job_in_`, writes in
+  // `clear_in_`.
+  NodeBIO::FromBIO(enc_in_)->DeferAccounting();
+  NodeBIO::FromBIO(enc_out_)->DeferAccounting();
+  ClearWeak();
+
+  CHECK_EQ(0, uv_queue_work_class(env()->event_loop(),
+                                  &key_job_req_,
+                                  UV_WORK_CPU,
+                                  KeyJobWork,
+                                  KeyJobAfter));
+}
+
+
+void TLSWrap::KeyJobWork(uv_work_t* req) {
+  TLSWrap* w = ContainerOf(&TLSWrap::key_job_req_, req);
+
+  w->key_job_ret_ = SSL_do_handshake(w->ssl_);
+
+  // The error queue is per thread, hand it over to the loop thread
+  unsigned long code;
+  const char* file;
+  int line;
+  while ((code = ERR_get_error_line(&file, &line)) != 0) {
+    if (w->key_job_error_count_ == kMaxKeyJobErrors)
+      continue;
+    w->key_job_errors_[w->key_job_error_count_].code = code;
+    w->key_job_errors_[w->key_job_error_count_].file = file;
+    w->key_job_errors_[w->key_job_error_count_].line = line;
+    w->key_job_error_count_++;
+  }
+}
+
+
+void TLSWrap::KeyJobAfter(uv_work_t* req, int status) {
+  CHECK_EQ(status, 0);
+  TLSWrap* w = ContainerOf(&TLSWrap::key_job_req_, req);
+  Environment* env = w->env();
+  HandleScope handle_scope(env->isolate());
+  Context::Scope context_scope(env->context());
+
+  w->key_job_state_ = kKeyJobNone;
+  w->MakeWeak(w);
+  NodeBIO::FromBIO(w->enc_in_)->ResumeAccounting();
+  NodeBIO::FromBIO(w->enc_out_)->ResumeAccounting();
+
+  if (w->key_job_destroy_) {
+    w->SSLWrap<TLSWrap>::DestroySSL();
+    delete w->clear_in_;
+    w->clear_in_ = nullptr;
+    return;
+  }
+
+  // Move the data that was received meanwhile into place
+  if (w->key_job_in_ != nullptr) {
+    NodeBIO* enc_in = NodeBIO::FromBIO(w->enc_in_);
+    while (w->key_job_in_->Length() > 0) {
+      size_t avail = 0;
+      char* data = w->key_job_in_->Peek(&avail);
+      enc_in->Write(data, avail);
+      w->key_job_in_->Read(nullptr, avail);
+    }
+  }
+
+  if (w->key_job_info_ != 0) {
+    int where = w->key_job_info_;
+    w->key_job_info_ = 0;
+    SSLInfoCallback(w->ssl_, where, 1);
+  }
+
+  if (w->ssl_ != nullptr && w->key_job_ret_ <= 0) {
+    for (int i = 0; i < w->key_job_error_count_; i++) {
+      unsigned long code = w->key_job_errors_[i].code;
+      ERR_put_error(ERR_GET_LIB(code),
+                    ERR_GET_FUNC(code),
+                    ERR_GET_REASON(code),
+                    w->key_job_errors_[i].file,
+                    w->key_job_errors_[i].line);
+    }
+
+    int err;
+    Local<Value> arg = w->GetSSLError(w->key_job_ret_, &err, nullptr);
+    if (!arg.IsEmpty()) {
+      // Flush the alert before reporting the error
+      if (BIO_pending(w->enc_out_) != 0)
+        w->EncOut();
+
+      w->MakeCallback(env->onerror_string(), 1, &arg);
+      return;
+    }
+  }
+
+  // Send the server's flight and carry on with anything that came in
+  w->Cycle();
+
+  if (w->key_job_read_error_ != 0) {
+    ssize_t nread = w->key_job_read_error_;
+    w->key_job_read_error_ = 0;
+    w->DoRead(nread, nullptr, UV_UNKNOWN_HANDLE);
+  }
+}
+
+
 void TLSWrap::EncOut() {
   // Ignore cycling data if ClientHello wasn't yet parsed
   if (!hello_parser_.IsEnded())
@@ -276,6 +454,10 @@ void TLSWrap::EncOut() {
   if (write_size_ != 0)
     return;
 
+  // The thread pool is writing to `enc_out_`
+  if (is_key_job_running())
+    return;
+
   // Wait for `newSession` callback to be invoked
   if (is_waiting_new_session())
     return;
@@ -405,7 +587,7 @@ void TLSWrap::ClearOut() {
   if (eof_)
     return;
 
-  if (ssl_ == nullptr)
+  if (ssl_ == nullptr || is_key_job_running())
     return;
 
   char out[kClearOutChunkSize];
@@ -430,6 +612,10 @@ void TLSWrap::ClearOut() {
     }
   }
 
+  // Paused for the private key operations
+  if (key_job_state_ == kKeyJobPending)
+    return StartKeyJob();
+
   int flags = SSL_get_shutdown(ssl_);
   if (!eof_ && flags & SSL_RECEIVED_SHUTDOWN) {
     eof_ = true;
@@ -464,13 +650,21 @@ bool TLSWrap::ClearIn() {
   if (!hello_parser_.IsEnded())
     return false;
 
-  if (ssl_ == nullptr)
+  if (ssl_ == nullptr || is_key_job_running())
     return false;
 
+  char packed[kMaxRecordLength];
   int written = 0;
   while (clear_in_->Length() > 0) {
     size_t avail = 0;
     char* data = clear_in_->Peek(&avail);
+
+    // Don't end a record where one of the queue's buffers ends
+    if (avail < record_length() && avail < clear_in_->Length()) {
+      avail = PackClearIn(packed, record_length());
+      data = packed;
+    }
+
     written = SSL_write(ssl_, data, avail);
     CHECK(written == -1 || written == static_cast<int>(avail));
     if (written == -1)
@@ -484,6 +678,12 @@ bool TLSWrap::ClearIn() {
     return true;
   }
 
+  // Paused for the private key operations
+  if (key_job_state_ == kKeyJobPending) {
+    StartKeyJob();
+    return false;
+  }
+
   // Error or partial write
   int err;
   Local<Value> arg = GetSSLError(written, &err, &error_);
@@ -498,6 +698,24 @@ bool TLSWrap::ClearIn() {
 }
 
 
+size_t TLSWrap::PackClearIn(char* out, size_t size) {
+  char* data[kSimultaneousBufferCount];
+  size_t lengths[ARRAY_SIZE(data)];
+  size_t count = ARRAY_SIZE(data);
+  clear_in_->PeekMultiple(data, lengths, &count);
+
+  size_t packed = 0;
+  for (size_t i = 0; i < count && packed < size; i++) {
+    size_t avail = lengths[i];
+    if (avail > size - packed)
+      avail = size - packed;
+    memcpy(out + packed, data[i], avail);
+    packed += avail;
+  }
+  return packed;
+}
+
+
 void* TLSWrap::Cast() {
   return reinterpret_cast<void*>(this);
 }
@@ -568,7 +786,7 @@ int TLSWrap::DoWrite(WriteWrap* w,
     ClearOut();
     // However if there any data that should be written to socket,
     // callback should not be invoked immediately
-    if (BIO_pending(enc_out_) == 0)
+    if (!is_key_job_running() && BIO_pending(enc_out_) == 0)
       return stream_->DoWrite(w, bufs, count, send_handle);
   }
 
@@ -593,28 +811,74 @@ int TLSWrap::DoWrite(WriteWrap* w,
   if (ssl_ == nullptr)
     return UV_EPROTO;
 
+  // Every SSL_write() produces at least one record. Pack small buffers
+  // together so that each record carries as much data as it can, and pass
+  // the rest to OpenSSL as it is.
+  char packed[kMaxRecordLength];
+  size_t packed_len = 0;
+  size_t offset = 0;
   int written = 0;
-  for (i = 0; i < count; i++) {
-    written = SSL_write(ssl_, bufs[i].base, bufs[i].len);
-    CHECK(written == -1 || written == static_cast<int>(bufs[i].len));
-    if (written == -1)
-      break;
+  i = 0;
+  while (i < count) {
+    char* data = bufs[i].base + offset;
+    size_t avail = bufs[i].len - offset;
+
+    if (packed_len == 0 && (avail >= record_length() || i == count - 1)) {
+      written = SSL_write(ssl_, data, avail);
+      CHECK(written == -1 || written == static_cast<int>(avail));
+      if (written == -1)
+        break;
+      i++;
+      offset = 0;
+      continue;
+    }
+
+    if (avail > record_length() - packed_len)
+      avail = record_length() - packed_len;
+    memcpy(packed + packed_len, data, avail);
+    packed_len += avail;
+    offset += avail;
+    if (offset == bufs[i].len) {
+      i++;
+      offset = 0;
+    }
+
+    if (packed_len == record_length() || (i == count && packed_len != 0)) {
+      written = SSL_write(ssl_, packed, packed_len);
+      CHECK(written == -1 || written == static_cast<int>(packed_len));
+      if (written == -1)
+        break;
+      packed_len = 0;
+    }
   }
 
-  if (i != count) {
+  if (i != count || packed_len != 0) {
     int err;
     Local<Value> arg = GetSSLError(written, &err, &error_);
     if (!arg.IsEmpty())
       return UV_EPROTO;
 
     // No errors, queue rest
+    if (packed_len != 0)
+      clear_in_->Write(packed, packed_len);
+    if (i < count) {
+      clear_in_->Write(bufs[i].base + offset, bufs[i].len - offset);
+      i++;
+    }
     for (; i < count; i++)
       clear_in_->Write(bufs[i].base, bufs[i].len);
+
+    if (key_job_state_ == kKeyJobPending) {
+      StartKeyJob();
+      return 0;
+    }
   }
 
   // Try writing data immediately
   EncOut();
 
+  CountWriteQueueSize(clear_in_->Length() + BIO_pending(enc_out_));
+
   return 0;
 }
 
@@ -627,8 +891,17 @@ void TLSWrap::OnAfterWriteImpl(WriteWrap* w, void* ctx) {
 void TLSWrap::OnAllocImpl(size_t suggested_size, uv_buf_t* buf, void* ctx) {
   TLSWrap* wrap = static_cast<TLSWrap*>(ctx);
 
+  NodeBIO* bio = NodeBIO::FromBIO(wrap->enc_in_);
+  if (wrap->is_key_job_running()) {
+    if (wrap->key_job_in_ == nullptr) {
+      wrap->key_job_in_ = new NodeBIO();
+      wrap->key_job_in_->AssignEnvironment(wrap->env());
+    }
+    bio = wrap->key_job_in_;
+  }
+
   size_t size = 0;
-  buf->base = NodeBIO::FromBIO(wrap->enc_in_)->PeekWritable(&size);
+  buf->base = bio->PeekWritable(&size);
   buf->len = size;
 }
 
@@ -664,6 +937,17 @@ void TLSWrap::OnReadSelf(ssize_t nread,
 void TLSWrap::DoRead(ssize_t nread,
                      const uv_buf_t* buf,
                      uv_handle_type pending) {
+  // Hold everything back until the thread pool is done with `enc_in_`
+  if (is_key_job_running()) {
+    if (nread < 0) {
+      if (key_job_read_error_ == 0)
+        key_job_read_error_ = nread;
+    } else if (key_job_in_ != nullptr) {
+      key_job_in_->Commit(nread);
+    }
+    return;
+  }
+
   if (nread < 0)  {
     // Error should be emitted only after all data was read
     ClearOut();
@@ -703,7 +987,7 @@ void TLSWrap::DoRead(ssize_t nread,
 
 
 int TLSWrap::DoShutdown(ShutdownWrap* req_wrap) {
-  if (ssl_ != nullptr && SSL_shutdown(ssl_) == 0)
+  if (ssl_ != nullptr && !is_key_job_running() && SSL_shutdown(ssl_) == 0)
     SSL_shutdown(ssl_);
   shutdown_ = true;
   EncOut();
@@ -757,6 +1041,13 @@ void TLSWrap::EnableSessionCallbacks(
 
 void TLSWrap::DestroySSL(const FunctionCallbackInfo<Value>& args) {
   TLSWrap* wrap = Unwrap<TLSWrap>(args.Holder());
+
+  // The thread pool still uses it, KeyJobAfter() will destroy it
+  if (wrap->is_key_job_running()) {
+    wrap->key_job_destroy_ = true;
+    return;
+  }
+
   wrap->SSLWrap<TLSWrap>::DestroySSL();
   delete wrap->clear_in_;
   wrap->clear_in_ = nullptr;
@@ -769,6 +1060,12 @@ void TLSWrap::EnableCertCb(const FunctionCallbackInfo<Value>& args) {
 }
 
 
+void TLSWrap::EnableAsyncPrivateKey(const FunctionCallbackInfo<Value>& args) {
+  TLSWrap* wrap = Unwrap<TLSWrap>(args.Holder());
+  wrap->async_private_key_ = true;
+}
+
+
 void TLSWrap::OnClientHelloParseEnd(void* arg) {
   TLSWrap* c = static_cast<TLSWrap*>(arg);
   c->Cycle();
@@ -869,6 +1166,7 @@ void TLSWrap::Initialize(Handle<Object> target,
   env->SetProtoMethod(t, "enableSessionCallbacks", EnableSessionCallbacks);
   env->SetProtoMethod(t, "destroySSL", DestroySSL);
   env->SetProtoMethod(t, "enableCertCb", EnableCertCb);
+  env->SetProtoMethod(t, "enableAsyncPrivateKey", EnableAsyncPrivateKey);
 
   StreamBase::AddMethods<TLSWrap>(env, t, StreamBase::kFlagHasWritev);
   SSLWrap<TLSWrap>::AddMethods(env, t);
@@ -883,6 +1181,15 @@ void TLSWrap::Initialize(Handle<Object> target,
 
   target->Set(FIXED_ONE_BYTE_STRING(env->isolate(), "TLSWrap"),
               t->GetFunction());
+
+  // BIO buffer pool counters, see Environment::BIOBufferPool::Fields.
+  Environment::BIOBufferPool* pool = env->bio_buffer_pool();
+  Local<Object> pool_stats = Object::New(env->isolate());
+  pool_stats->SetIndexedPropertiesToExternalArrayData(pool->fields(),
+                                                      kExternalFloat64Array,
+                                                      pool->fields_count());
+  target->Set(FIXED_ONE_BYTE_STRING(env->isolate(), "bioBufferStats"),
+              pool_stats);
 }
 
 }  // namespace node
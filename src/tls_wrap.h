@@ -51,7 +51,7 @@ class TLSWrap : public crypto::SSLWrap<TLSWrap>,
   void NewSessionDoneCb();
 
  protected:
-  static const int kClearOutChunkSize = 1024;
+  static const int kClearOutChunkSize = 16384;
 
   // Maximum number of bytes for hello parser
   static const int kMaxHelloLength = 16384;
@@ -60,7 +60,21 @@ class TLSWrap : public crypto::SSLWrap<TLSWrap>,
   static const int kInitialClientBufferLength = 4096;
 
   // Maximum number of buffers passed to uv_write()
-  static const int kSimultaneousBufferCount = 10;
+  static const int kSimultaneousBufferCount = 32;
+
+  // Largest amount of clear text in a TLS record
+  static const int kMaxRecordLength = SSL3_RT_MAX_PLAIN_LENGTH;
+
+  // Maximum number of OpenSSL errors carried over from the thread pool
+  static const int kMaxKeyJobErrors = 8;
+
+  // Progress of the handshake step that is run in the thread pool when
+  // async private key operations are enabled, see SSLCertCallback.
+  enum KeyJobState {
+    kKeyJobNone,
+    kKeyJobPending,
+    kKeyJobRunning
+  };
 
   // Write callback queue's item
   class WriteItem {
@@ -81,14 +95,32 @@ class TLSWrap : public crypto::SSLWrap<TLSWrap>,
           crypto::SecureContext* sc);
 
   static void SSLInfoCallback(const SSL* ssl_, int where, int ret);
+  static int SSLCertCallback(SSL* s, void* arg);
   void InitSSL();
   void EncOut();
   static void EncOutCb(WriteWrap* req_wrap, int status);
   bool ClearIn();
   void ClearOut();
+  size_t PackClearIn(char* out, size_t size);
+
+  // Clear text that fills a record, see setMaxSendFragment()
+  inline size_t record_length() const {
+    return ssl_->max_send_fragment;
+  }
+
   void MakePending();
   bool InvokeQueued(int status);
 
+  bool CanStartKeyJob();
+  void StartKeyJob();
+  static void KeyJobWork(uv_work_t* req);
+  static void KeyJobAfter(uv_work_t* req, int status);
+
+  // While the thread pool owns `ssl_` and the BIOs, no cycling is done
+  inline bool is_key_job_running() const {
+    return key_job_state_ == kKeyJobRunning;
+  }
+
   inline void Cycle() {
     // Prevent recursion
     if (++cycle_depth_ > 1)
@@ -132,6 +164,8 @@ class TLSWrap : public crypto::SSLWrap<TLSWrap>,
       const v8::FunctionCallbackInfo<v8::Value>& args);
   static void EnableCertCb(
       const v8::FunctionCallbackInfo<v8::Value>& args);
+  static void EnableAsyncPrivateKey(
+      const v8::FunctionCallbackInfo<v8::Value>& args);
   static void DestroySSL(const v8::FunctionCallbackInfo<v8::Value>& args);
 
 #ifdef SSL_CTRL_SET_TLSEXT_SERVERNAME_CB
@@ -159,6 +193,23 @@ class TLSWrap : public crypto::SSLWrap<TLSWrap>,
   // If true - delivered EOF to the js-land, either after `close_notify`, or
   // after the `UV_EOF` on socket.
   bool eof_;
+
+  // Async private key operations
+  bool async_private_key_;
+  KeyJobState key_job_state_;
+  uv_work_t key_job_req_;
+  int key_job_ret_;
+  int key_job_info_;
+  bool key_job_destroy_;
+  ssize_t key_job_read_error_;
+  // Data received from the socket while the job runs
+  NodeBIO* key_job_in_;
+  struct {
+    unsigned long code;
+    const char* file;
+    int line;
+  } key_job_errors_[kMaxKeyJobErrors];
+  int key_job_error_count_;
 };
 
 }  // namespace node
@@ -11,6 +11,8 @@ using v8::FunctionCallbackInfo;
 using v8::FunctionTemplate;
 using v8::Handle;
 using v8::Integer;
+using v8::Local;
+using v8::Number;
 using v8::Object;
 using v8::String;
 using v8::Value;
@@ -26,6 +28,93 @@ void ErrName(const FunctionCallbackInfo<Value>& args) {
 }
 
 
+// Returns the counters of one threadpool work class, see
+// uv_threadpool_get_stats().  Times are in nanoseconds.
+void ThreadpoolStats(const FunctionCallbackInfo<Value>& args) {
+  Environment* env = Environment::GetCurrent(args);
+  uv_work_class work_class = static_cast<uv_work_class>(args[0]->Int32Value());
+  uv_threadpool_stats_t stats;
+  int err = uv_threadpool_get_stats(work_class, &stats);
+  if (err)
+    return env->ThrowUVException(err, "uv_threadpool_get_stats");
+
+  Local<Object> obj = Object::New(env->isolate());
+#define V(name, field)                                                        \
+  obj->Set(FIXED_ONE_BYTE_STRING(env->isolate(), name),                       \
+           Number::New(env->isolate(), static_cast<double>(stats.field)));
+  V("limit", limit)
+  V("queued", queued)
+  V("running", running)
+  V("submitted", submitted)
+  V("completed", completed)
+  V("cancelled", cancelled)
+  V("queueTime", queue_time)
+  V("maxQueueTime", max_queue_time)
+#undef V
+  args.GetReturnValue().Set(obj);
+}
+
+
+// Caps how many requests of a threadpool work class may run at the same
+// time, 0 lifts the cap.
+void SetThreadpoolLimit(const FunctionCallbackInfo<Value>& args) {
+  Environment* env = Environment::GetCurrent(args);
+  uv_work_class work_class = static_cast<uv_work_class>(args[0]->Int32Value());
+  if (!args[1]->IsUint32())
+    return env->ThrowTypeError("limit must be a positive integer");
+  int err = uv_threadpool_set_limit(work_class, args[1]->Uint32Value());
+  if (err)
+    return env->ThrowUVException(err, "uv_threadpool_set_limit");
+}
+
+
+// Returns the size and saturation of the threadpool, see
+// uv_threadpool_get_info().  Times are in nanoseconds.
+void ThreadpoolInfo(const FunctionCallbackInfo<Value>& args) {
+  Environment* env = Environment::GetCurrent(args);
+  uv_threadpool_info_t info;
+  int err = uv_threadpool_get_info(&info);
+  if (err)
+    return env->ThrowUVException(err, "uv_threadpool_get_info");
+
+  Local<Object> obj = Object::New(env->isolate());
+#define V(name, field)                                                        \
+  obj->Set(FIXED_ONE_BYTE_STRING(env->isolate(), name),                       \
+           Number::New(env->isolate(), static_cast<double>(info.field)));
+  V("threads", threads)
+  V("idleThreads", idle_threads)
+  V("minThreads", min_threads)
+  V("maxThreads", max_threads)
+  V("queued", queued)
+  V("running", running)
+  V("threadsCreated", threads_created)
+  V("threadsExited", threads_exited)
+  V("p50QueueTime", p50_queue_time)
+  V("p99QueueTime", p99_queue_time)
+#undef V
+  args.GetReturnValue().Set(obj);
+}
+
+
+// Makes the queue time percentiles of ThreadpoolInfo() start over.
+void ResetThreadpoolPercentiles(const FunctionCallbackInfo<Value>& args) {
+  uv_threadpool_reset_percentiles();
+}
+
+
+// Lets the threadpool grow and shrink between a minimum and maximum number
+// of threads.
+void SetThreadpoolSize(const FunctionCallbackInfo<Value>& args) {
+  Environment* env = Environment::GetCurrent(args);
+  if (!args[0]->IsUint32() || !args[1]->IsUint32())
+    return env->ThrowTypeError("min and max must be positive integers");
+  int err = uv_threadpool_set_size(args[0]->Uint32Value(),
+                                   args[1]->Uint32Value());
+  if (err)
+    return env->ThrowUVException(err, "uv_threadpool_set_size");
+}
+
+
 void Initialize(Handle<Object> target,
                 Handle<Value> unused,
                 Handle<Context> context) {
@@ -37,6 +126,21 @@ void Initialize(Handle<Object> target,
               Integer::New(env->isolate(), UV_ ## name));
   UV_ERRNO_MAP(V)
 #undef V
+
+  env->SetMethod(target, "threadpoolStats", ThreadpoolStats);
+  env->SetMethod(target, "setThreadpoolLimit", SetThreadpoolLimit);
+  env->SetMethod(target, "threadpoolInfo", ThreadpoolInfo);
+  env->SetMethod(target, "resetThreadpoolPercentiles",
+                 ResetThreadpoolPercentiles);
+  env->SetMethod(target, "setThreadpoolSize", SetThreadpoolSize);
+#define V(name)                                                               \
+  target->Set(FIXED_ONE_BYTE_STRING(env->isolate(), # name),                  \
+              Integer::New(env->isolate(), name));
+  V(UV_WORK_FS)
+  V(UV_WORK_USER)
+  V(UV_WORK_CPU)
+  V(UV_WORK_DNS)
+#undef V
 }
 
 
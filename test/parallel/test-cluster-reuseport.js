@@ -0,0 +1,54 @@
+var common = require('../common');
+var assert = require('assert');
+var cluster = require('cluster');
+var net = require('net');
+
+if (process.platform !== 'linux') {
+  console.log('1..0 # Skipped: SO_REUSEPORT load balancing is Linux-only');
+  return;
+}
+
+if (cluster.isMaster) {
+  cluster.schedulingPolicy = cluster.SCHED_REUSEPORT;
+
+  var workers = 2;
+  var listening = 0;
+  var pids = {};
+  var connections = 0;
+  var port;
+
+  for (var i = 0; i < workers; i++) {
+    cluster.fork().on('listening', function(address) {
+      if (port === undefined)
+        port = address.port;
+      // Port 0 resolves to the same port for all workers.
+      assert.equal(address.port, port);
+      if (++listening === workers)
+        connect();
+    });
+  }
+
+  function connect() {
+    var conn = net.connect(port, function() {
+      conn.on('data', function(pid) {
+        pids[pid] = true;
+      });
+      conn.on('end', function() {
+        if (++connections < 50)
+          return connect();
+        cluster.disconnect();
+      });
+    });
+  }
+
+  process.on('exit', function() {
+    assert.equal(connections, 50);
+    // Connections were accepted by the workers themselves.
+    assert.equal(pids[process.pid], undefined);
+    assert(Object.keys(pids).length > 0);
+  });
+} else {
+  net.createServer(function(conn) {
+    conn.end('' + process.pid);
+  }).listen(0);
+}
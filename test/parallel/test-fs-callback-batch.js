@@ -0,0 +1,49 @@
+var common = require('../common');
+var assert = require('assert');
+var fs = require('fs');
+
+// Completions that arrive together run their nextTick queue and microtasks
+// once at the end of the batch. They must still run, in order, before
+// anything from the next phase of the event loop.
+var N = 200;
+var order = [];
+var caught = 0;
+
+process.on('uncaughtException', function(err) {
+  assert.equal(err.message, 'boom');
+  caught++;
+});
+
+for (var i = 0; i < N; i++) {
+  fs.stat(__filename, function(i, err, stats) {
+    assert.ifError(err);
+    order.push('cb' + i);
+    process.nextTick(function() {
+      order.push('tick' + i);
+    });
+    Promise.resolve().then(function() {
+      order.push('micro' + i);
+    });
+    setImmediate(function() {
+      order.push('immediate' + i);
+    });
+    // The other callbacks of the batch still run.
+    if (i === 0)
+      throw new Error('boom');
+  }.bind(null, i));
+}
+
+process.on('exit', function() {
+  assert.equal(caught, 1);
+  assert.equal(order.length, 4 * N);
+  for (var i = 0; i < N; i++) {
+    var cb = order.indexOf('cb' + i);
+    var tick = order.indexOf('tick' + i);
+    var micro = order.indexOf('micro' + i);
+    var immediate = order.indexOf('immediate' + i);
+    assert(cb !== -1);
+    assert(cb < tick);
+    assert(tick < micro);
+    assert(micro < immediate);
+  }
+});
@@ -0,0 +1,45 @@
+var common = require('../common');
+var assert = require('assert');
+var constants = require('constants');
+var path = require('path');
+var fs = require('fs');
+
+var dir = path.join(common.tmpDir, 'readdir-types');
+try { fs.mkdirSync(dir); } catch (e) {}
+try { fs.mkdirSync(path.join(dir, 'subdir')); } catch (e) {}
+fs.writeFileSync(path.join(dir, 'file'), 'x');
+
+var expected = {
+  file: constants.S_IFREG,
+  subdir: constants.S_IFDIR
+};
+
+function check(files) {
+  assert.deepEqual(files.names.slice().sort(), ['file', 'subdir']);
+  assert.equal(files.types.length, files.names.length);
+  files.names.forEach(function(name, i) {
+    // Some file systems don't fill in d_type.
+    if (files.types[i] !== 0)
+      assert.equal(files.types[i], expected[name]);
+  });
+}
+
+// Without the option, nothing changes.
+assert.deepEqual(fs.readdirSync(dir).sort(), ['file', 'subdir']);
+check(fs.readdirSync(dir, { withTypes: true }));
+
+var called = 0;
+fs.readdir(dir, { withTypes: true }, function(err, files) {
+  assert.ifError(err);
+  check(files);
+  called++;
+});
+
+fs.readdir(path.join(dir, 'missing'), { withTypes: true }, function(err) {
+  assert.equal(err.code, 'ENOENT');
+  called++;
+});
+
+process.on('exit', function() {
+  assert.equal(called, 2);
+});
@@ -0,0 +1,108 @@
+var common = require('../common');
+var assert = require('assert');
+var fs = require('fs');
+var path = require('path');
+
+// fs.readFile() and fs.writeFile() run open, stat, read or write and close
+// in one thread pool request. Check the results and the errors that come
+// out of it.
+
+var empty = path.join(common.tmpDir, 'empty.txt');
+var large = path.join(common.tmpDir, 'large.bin');
+var appended = path.join(common.tmpDir, 'appended.txt');
+var missing = path.join(common.tmpDir, 'missing', 'file.txt');
+
+var data = new Buffer(10 * 1024 * 1024 + 13);
+for (var i = 0; i < data.length; i++)
+  data[i] = i % 251;
+
+var calls = 0;
+function done() {
+  calls++;
+}
+
+// Empty files
+fs.writeFile(empty, '', function(err) {
+  assert.ifError(err);
+  assert.equal(fs.statSync(empty).size, 0);
+  fs.readFile(empty, function(err, buffer) {
+    assert.ifError(err);
+    assert(buffer instanceof Buffer);
+    assert.equal(buffer.length, 0);
+    fs.readFile(empty, 'utf8', function(err, str) {
+      assert.ifError(err);
+      assert.strictEqual(str, '');
+      done();
+    });
+  });
+});
+
+// Large files
+fs.writeFile(large, data, function(err) {
+  assert.ifError(err);
+  assert.equal(fs.statSync(large).size, data.length);
+  fs.readFile(large, function(err, buffer) {
+    assert.ifError(err);
+    assert(buffer.equals(data));
+    done();
+  });
+});
+
+// Appending and encodings
+fs.writeFile(appended, '6869', 'hex', function(err) {
+  assert.ifError(err);
+  fs.writeFile(appended, ' there', { flag: 'a' }, function(err) {
+    assert.ifError(err);
+    fs.readFile(appended, 'utf8', function(err, str) {
+      assert.ifError(err);
+      assert.equal(str, 'hi there');
+      done();
+    });
+  });
+});
+
+// Errors carry the syscall that failed and the path
+fs.readFile(missing, function(err, buffer) {
+  assert.equal(err.code, 'ENOENT');
+  assert.equal(err.syscall, 'open');
+  assert.equal(err.path, missing);
+  assert.equal(buffer, undefined);
+  done();
+});
+
+fs.readFile(common.tmpDir, function(err) {
+  assert.equal(err.code, 'EISDIR');
+  assert.equal(err.syscall, 'read');
+  done();
+});
+
+fs.writeFile(missing, data, function(err) {
+  assert.equal(err.code, 'ENOENT');
+  assert.equal(err.syscall, 'open');
+  assert.equal(err.path, missing);
+  done();
+});
+
+fs.writeFile(path.join(common.tmpDir, 'exclusive.txt'), 'x', function(err) {
+  assert.ifError(err);
+  fs.writeFile(path.join(common.tmpDir, 'exclusive.txt'), 'y', { flag: 'wx' },
+               function(err) {
+    assert.equal(err.code, 'EEXIST');
+    done();
+  });
+});
+
+// Files that report a size of zero are read until EOF
+if (process.platform === 'linux') {
+  fs.readFile('/proc/self/status', 'utf8', function(err, str) {
+    assert.ifError(err);
+    assert(/^Name:/.test(str));
+    done();
+  });
+} else {
+  done();
+}
+
+process.on('exit', function() {
+  assert.equal(calls, 8);
+});
@@ -0,0 +1,73 @@
+var common = require('../common');
+var assert = require('assert');
+var fs = require('fs');
+
+var lazy = { lazy: true };
+
+function check(stats, expected) {
+  assert(stats instanceof fs.Stats);
+  ['dev', 'mode', 'nlink', 'uid', 'gid', 'rdev', 'blksize', 'ino', 'size',
+   'blocks'].forEach(function(key) {
+    assert.equal(stats[key], expected[key], key);
+  });
+  ['atime', 'mtime', 'ctime', 'birthtime'].forEach(function(key) {
+    assert.equal(stats[key + 'Ms'], expected[key].getTime(), key);
+    assert(stats[key] instanceof Date);
+    assert.equal(stats[key].getTime(), expected[key].getTime(), key);
+    // The Date is created once and then sticks around.
+    assert.strictEqual(stats[key], stats[key]);
+  });
+  assert.equal(stats.isFile(), expected.isFile());
+  assert.equal(stats.isDirectory(), expected.isDirectory());
+}
+
+check(fs.statSync(__filename, lazy), fs.statSync(__filename));
+check(fs.lstatSync(__dirname, lazy), fs.lstatSync(__dirname));
+
+var fd = fs.openSync(__filename, 'r');
+check(fs.fstatSync(fd, lazy), fs.fstatSync(fd));
+
+// Results of one call must not change when the next call comes in.
+var first = fs.statSync(__filename, lazy);
+fs.statSync(__dirname, lazy);
+assert(first.isFile());
+
+// Dates can still be replaced.
+var date = new Date(0);
+first.mtime = date;
+assert.strictEqual(first.mtime, date);
+
+assert.throws(function() {
+  fs.statSync(__filename + '.missing', lazy);
+}, /ENOENT/);
+
+var called = 0;
+
+fs.stat(__filename, lazy, function(err, stats) {
+  assert.ifError(err);
+  check(stats, fs.statSync(__filename));
+  called++;
+});
+
+fs.lstat(__dirname, lazy, function(err, stats) {
+  assert.ifError(err);
+  check(stats, fs.lstatSync(__dirname));
+  called++;
+});
+
+fs.fstat(fd, lazy, function(err, stats) {
+  assert.ifError(err);
+  check(stats, fs.fstatSync(fd));
+  fs.closeSync(fd);
+  called++;
+});
+
+fs.stat(__filename + '.missing', lazy, function(err, stats) {
+  assert.equal(err.code, 'ENOENT');
+  assert.equal(stats, undefined);
+  called++;
+});
+
+process.on('exit', function() {
+  assert.equal(called, 4);
+});
@@ -0,0 +1,63 @@
+var common = require('../common');
+var assert = require('assert');
+var path = require('path');
+var fs = require('fs');
+
+// Layout of the results, see fs.statMany() in doc/api/fs.markdown.
+var kFields = 15;
+var kResult = 0;
+var kMode = 2;
+var kIno = 8;
+var kSize = 9;
+var kMtime = 12;
+
+var file = path.join(common.tmpDir, 'stat-many.txt');
+var link = path.join(common.tmpDir, 'stat-many-link');
+fs.writeFileSync(file, 'hello');
+try { fs.unlinkSync(link); } catch (e) {}
+var canSymlink = true;
+try { fs.symlinkSync(file, link); } catch (e) { canSymlink = false; }
+
+var paths = [file, path.join(common.tmpDir, 'stat-many-missing'), __dirname];
+
+function check(results) {
+  assert(results instanceof Float64Array);
+  assert.equal(results.length, paths.length * kFields);
+
+  var st = fs.statSync(file);
+  assert.equal(results[kResult], 0);
+  assert.equal(results[kMode], st.mode);
+  assert.equal(results[kIno], st.ino);
+  assert.equal(results[kSize], 5);
+  assert.equal(results[kMtime], st.mtime.getTime());
+
+  assert(results[kFields + kResult] < 0);
+
+  assert.equal(results[2 * kFields + kResult], 0);
+  assert.equal(results[2 * kFields + kMode], fs.statSync(__dirname).mode);
+}
+
+check(fs.statManySync(paths));
+assert.equal(fs.statManySync([]).length, 0);
+assert.throws(function() {
+  fs.statManySync('not an array');
+}, TypeError);
+
+if (canSymlink) {
+  var st = fs.lstatSync(link);
+  var results = fs.statManySync([link], { lstat: true });
+  assert.equal(results[kMode], st.mode);
+  results = fs.statManySync([link]);
+  assert.equal(results[kMode], fs.statSync(file).mode);
+}
+
+var called = 0;
+fs.statMany(paths, function(err, results) {
+  assert.ifError(err);
+  check(results);
+  called++;
+});
+
+process.on('exit', function() {
+  assert.equal(called, 1);
+});
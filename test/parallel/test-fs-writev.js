@@ -0,0 +1,81 @@
+var common = require('../common');
+var assert = require('assert');
+var path = require('path');
+var fs = require('fs');
+
+var filename = path.join(common.tmpDir, 'writev.txt');
+
+function makeBuffers(count, prefix) {
+  var buffers = [];
+  for (var i = 0; i < count; i++)
+    buffers.push(new Buffer(prefix + i + '\n'));
+  return buffers;
+}
+
+// Sync, including positional writes and reads.
+var fd = fs.openSync(filename, 'w+');
+var buffers = makeBuffers(10, 'sync ');
+var expected = Buffer.concat(buffers);
+assert.equal(fs.writevSync(fd, buffers), expected.length);
+assert.equal(fs.writevSync(fd, [new Buffer('SYNC')], 0), 4);
+assert.equal(fs.writevSync(fd, []), 0);
+expected.write('SYNC', 0);
+
+var a = new Buffer(5);
+var b = new Buffer(expected.length - 5);
+assert.equal(fs.readvSync(fd, [a, b], 0), expected.length);
+assert.equal(Buffer.concat([a, b]).toString(), expected.toString());
+assert.throws(function() {
+  fs.writevSync(fd, ['not a buffer']);
+}, TypeError);
+fs.closeSync(fd);
+
+// Async, with more buffers than fit in a single writev() call.
+var writevCalled = 0;
+var readvCalled = 0;
+var streamClosed = 0;
+fd = fs.openSync(filename, 'w+');
+buffers = makeBuffers(2000, 'async ');
+expected = Buffer.concat(buffers);
+fs.writev(fd, buffers, 0, function(err, written, bufs) {
+  assert.ifError(err);
+  assert.ok(written > 0 && written <= expected.length);
+  assert.strictEqual(bufs, buffers);
+  writevCalled++;
+
+  var head = new Buffer(written - 1);
+  var tail = new Buffer(1);
+  fs.readv(fd, [head, tail], 0, function(err, bytesRead) {
+    assert.ifError(err);
+    assert.equal(bytesRead, written);
+    assert.equal(Buffer.concat([head, tail]).toString(),
+                 expected.slice(0, written).toString());
+    readvCalled++;
+    fs.closeSync(fd);
+    testWriteStream();
+  });
+});
+
+// Writes that queue up behind an in-flight write go out through _writev.
+function testWriteStream() {
+  var stream = fs.createWriteStream(filename);
+  var lines = makeBuffers(3000, 'stream ');
+  stream.on('open', function() {
+    lines.forEach(function(line) {
+      stream.write(line);
+    });
+    stream.end();
+  });
+  stream.on('close', function() {
+    var expected = Buffer.concat(lines);
+    assert.equal(stream.bytesWritten, expected.length);
+    assert.equal(fs.readFileSync(filename, 'utf8'), expected.toString());
+    streamClosed++;
+  });
+}
+
+process.on('exit', function() {
+  assert.equal(writevCalled, 1);
+  assert.equal(readvCalled, 1);
+  assert.equal(streamClosed, 1);
+});
@@ -0,0 +1,61 @@
+var common = require('../common');
+var assert = require('assert');
+var http = require('http');
+var net = require('net');
+
+// Requests with more headers than the parser has room for up front, followed
+// by a chunked body with trailers, on one keep-alive connection. The
+// trailers land in the header arrays that were grown for the headers.
+
+var REQUESTS = 3;
+var HEADERS = 40;
+
+var requests = 0;
+var server = http.createServer(function(req, res) {
+  var body = '';
+  req.setEncoding('utf8');
+  req.on('data', function(chunk) {
+    body += chunk;
+  });
+  req.on('end', function() {
+    assert.equal(body, 'hello');
+    assert.equal(req.headers['x-header-0'], '0');
+    assert.equal(req.headers['x-header-' + (HEADERS - 1)], String(HEADERS - 1));
+    assert.equal(req.trailers['x-trailer'], 'trailer ' + requests);
+    requests++;
+    res.end('ok');
+  });
+});
+
+server.listen(common.PORT, function() {
+  var request = '';
+  for (var i = 0; i < REQUESTS; i++) {
+    request += 'POST / HTTP/1.1\r\n' +
+               'Host: localhost\r\n' +
+               'Transfer-Encoding: chunked\r\n';
+    for (var j = 0; j < HEADERS; j++)
+      request += 'X-Header-' + j + ': ' + j + '\r\n';
+    request += '\r\n' +
+               '5\r\nhello\r\n' +
+               '0\r\n' +
+               'X-Trailer: trailer ' + i + '\r\n' +
+               '\r\n';
+  }
+
+  var responses = 0;
+  var client = net.connect(common.PORT, function() {
+    client.write(request);
+  });
+  client.setEncoding('utf8');
+  client.on('data', function(data) {
+    responses += data.split('HTTP/1.1 200 OK').length - 1;
+    if (responses === REQUESTS) {
+      client.end();
+      server.close();
+    }
+  });
+});
+
+process.on('exit', function() {
+  assert.equal(requests, REQUESTS);
+});
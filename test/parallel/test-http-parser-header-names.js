@@ -0,0 +1,50 @@
+var common = require('../common');
+var assert = require('assert');
+
+var HTTPParser = process.binding('http_parser').HTTPParser;
+
+var kOnHeadersComplete = HTTPParser.kOnHeadersComplete | 0;
+
+// Well-known header names come from a table of interned strings, make sure
+// that doesn't change the spelling that JS land gets to see.
+var names = [
+  'Host',
+  'content-length',
+  'CONTENT-TYPE',
+  'Accept-encoding',
+  'User-Agent',
+  'X-Unknown-Header',
+  'x-forwarded-for'
+];
+
+function parse(chunks) {
+  var headers = null;
+  var parser = new HTTPParser(HTTPParser.REQUEST);
+  parser[kOnHeadersComplete] = function(major, minor, h) {
+    headers = h;
+  };
+  chunks.forEach(function(chunk) {
+    var ret = parser.execute(new Buffer(chunk));
+    assert.equal(ret, chunk.length);
+  });
+  parser.close();
+  return headers;
+}
+
+var request = 'GET / HTTP/1.1\r\n';
+names.forEach(function(name, i) {
+  request += name + ': ' + i + '\r\n';
+});
+request += '\r\n';
+
+var expected = [];
+names.forEach(function(name, i) {
+  expected.push(name, '' + i);
+});
+
+assert.deepEqual(parse([request]), expected);
+
+// Header names that are split over several reads.
+var split = request.indexOf('ontent-length');
+assert.deepEqual(parse([request.slice(0, split), request.slice(split)]),
+                 expected);
@@ -274,6 +274,71 @@ function expectBody(expected) {
 })();
 
 
+//
+// Test that a few dozen headers are delivered in one go and that very
+// large numbers of headers still get flushed in batches.
+//
+(function() {
+  function test(count, expectFlush) {
+    var headers = '';
+    for (var i = 0; i < count; ++i) headers += 'X-Filler-' + i + ': 42' + CRLF;
+
+    var request = Buffer('GET / HTTP/1.0' + CRLF + headers + CRLF);
+
+    var onHeadersComplete = function(versionMajor, versionMinor, headers) {
+      assert.equal(headers === undefined, expectFlush);
+
+      headers = headers || parser.headers;
+
+      assert.equal(headers.length, 2 * count);
+      for (var i = 0; i < headers.length; i += 2) {
+        assert.equal(headers[i], 'X-Filler-' + i / 2);
+        assert.equal(headers[i + 1], '42');
+      }
+    };
+
+    var parser = newParser(REQUEST);
+    parser[kOnHeadersComplete] = mustCall(onHeadersComplete);
+    parser.execute(request, 0, request.length);
+  }
+
+  test(60, false);
+  test(2048, true);
+})();
+
+
+//
+// Test that the header arrays shrink back between messages without losing
+// headers, on a keep-alive connection and after reinitialize().
+//
+(function() {
+  var counts = [200, 5, 100];
+
+  function message(count) {
+    var headers = '';
+    for (var i = 0; i < count; ++i) headers += 'X-Filler-' + i + ': 42' + CRLF;
+    return 'GET / HTTP/1.1' + CRLF + headers + CRLF;
+  }
+
+  var onHeadersComplete = function(versionMajor, versionMinor, headers) {
+    var count = counts.shift();
+    assert.equal(headers.length, 2 * count);
+    for (var i = 0; i < headers.length; i += 2)
+      assert.equal(headers[i], 'X-Filler-' + i / 2);
+  };
+
+  var parser = newParser(REQUEST);
+  parser[kOnHeadersComplete] = mustCall(onHeadersComplete, 3);
+  var request = Buffer(message(200) + message(5));
+  parser.execute(request, 0, request.length);
+
+  parser.reinitialize(REQUEST);
+  request = Buffer(message(100));
+  parser.execute(request, 0, request.length);
+  assert.equal(counts.length, 0);
+})();
+
+
 //
 // Test request body
 //
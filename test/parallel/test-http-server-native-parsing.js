@@ -0,0 +1,63 @@
+var common = require('../common');
+var assert = require('assert');
+var http = require('http');
+var net = require('net');
+
+var bodies = [];
+var upgradeHead = null;
+
+var server = http.createServer(function(req, res) {
+  var body = '';
+  req.setEncoding('utf8');
+  req.on('data', function(chunk) {
+    body += chunk;
+  });
+  req.on('end', function() {
+    bodies.push(req.method + ' ' + req.url + ' ' + body);
+    res.end('ok');
+  });
+});
+server.nativeParsing = true;
+
+server.on('upgrade', function(req, socket, head) {
+  upgradeHead = head.toString();
+  // The socket is handed back to the user, more data arrives as events.
+  socket.once('data', function(data) {
+    assert.equal(data.toString(), 'after upgrade');
+    socket.end('HTTP/1.1 101 Switching Protocols\r\n\r\n');
+    server.close();
+  });
+});
+
+server.listen(common.PORT, function() {
+  var conn = net.connect(common.PORT, function() {
+    conn.write('GET /a HTTP/1.1\r\n\r\n' +
+               'POST /b HTTP/1.1\r\n' +
+               'Content-Length: 5\r\n\r\n' +
+               'hello' +
+               'GET /c HTTP/1.1\r\n' +
+               'Connection: Upgrade\r\n' +
+               'Upgrade: test\r\n\r\n' +
+               'head');
+  });
+
+  var response = '';
+  var sent = false;
+  conn.setEncoding('utf8');
+  conn.on('data', function(data) {
+    response += data;
+    // Wait for both responses before sending more data on the upgrade.
+    if (!sent && response.split('ok').length === 3 && upgradeHead !== null) {
+      sent = true;
+      conn.write('after upgrade');
+    }
+  });
+  conn.on('end', function() {
+    assert(/Switching Protocols/.test(response));
+  });
+});
+
+process.on('exit', function() {
+  assert.deepEqual(bodies, ['GET /a ', 'POST /b hello']);
+  assert.equal(upgradeHead, 'head');
+});
@@ -0,0 +1,127 @@
+var common = require('../common');
+var assert = require('assert');
+var net = require('net');
+var stream = require('stream');
+
+// socket.pipeNative() moves data between two sockets in C++. The proxy below
+// echoes through a backend while the client isn't reading for a while, so
+// the proxy has to stop reading instead of queueing everything.
+var SIZE = 16 * 1024 * 1024;
+var tests = [roundTrip, destinationError, fallback];
+var done = 0;
+
+function next() {
+  var test = tests.shift();
+  if (test)
+    test(function() {
+      done++;
+      next();
+    });
+}
+next();
+
+function roundTrip(cb) {
+  var maxQueued = 0;
+  var backend = net.createServer({ allowHalfOpen: true }, function(conn) {
+    conn.pipe(conn);
+  });
+  var proxy = net.createServer({ allowHalfOpen: true }, function(conn) {
+    var upstream = net.connect({ port: common.PORT, allowHalfOpen: true });
+    conn.pipeNative(upstream);
+    upstream.pipeNative(conn);
+    conn.on('end', function() {
+      maxQueued = conn._handle.stats[7];
+    });
+  });
+
+  backend.listen(common.PORT, function() {
+    proxy.listen(common.PORT + 1, function() {
+      var data = new Buffer(SIZE);
+      for (var i = 0; i < SIZE; i++)
+        data[i] = i % 251;
+
+      var received = [];
+      var client = net.connect(common.PORT + 1);
+      client.end(data);
+      client.pause();
+      setTimeout(function() {
+        client.resume();
+      }, 200);
+      client.on('data', function(chunk) {
+        received.push(chunk);
+      });
+      client.on('end', function() {
+        assert(Buffer.concat(received).equals(data));
+        assert(maxQueued < 1024 * 1024, 'queued ' + maxQueued + ' bytes');
+        backend.close();
+        proxy.close();
+        cb();
+      });
+    });
+  });
+}
+
+// The destination's peer goes away, the write error ends up on the
+// destination and the source is left alone.
+function destinationError(cb) {
+  var chunk = new Buffer(64 * 1024);
+  chunk.fill('x');
+
+  var backend = net.createServer(function(conn) {
+    conn.once('data', function() {
+      conn.destroy();
+    });
+  });
+  var proxy = net.createServer(function(conn) {
+    var upstream = net.connect({ port: common.PORT, allowHalfOpen: true });
+    conn.pipeNative(upstream);
+    upstream.on('error', function(err) {
+      assert.equal(err.syscall, 'write');
+      assert(!conn.destroyed);
+      conn.destroy();
+      backend.close();
+      proxy.close();
+      cb();
+    });
+  });
+
+  backend.listen(common.PORT, function() {
+    proxy.listen(common.PORT + 1, function() {
+      var client = net.connect(common.PORT + 1);
+      client.on('error', function() {});
+      (function write() {
+        if (client.destroyed)
+          return;
+        if (client.write(chunk))
+          setImmediate(write);
+        else
+          client.once('drain', write);
+      })();
+    });
+  });
+}
+
+// Anything that isn't a socket gets a regular pipe()
+function fallback(cb) {
+  var server = net.createServer(function(conn) {
+    conn.end('hello');
+  });
+  server.listen(common.PORT, function() {
+    var received = '';
+    var sink = new stream.PassThrough();
+    sink.setEncoding('utf8');
+    sink.on('data', function(data) {
+      received += data;
+    });
+    sink.on('end', function() {
+      assert.equal(received, 'hello');
+      server.close();
+      cb();
+    });
+    assert.strictEqual(net.connect(common.PORT).pipeNative(sink), sink);
+  });
+}
+
+process.on('exit', function() {
+  assert.equal(done, 3);
+});
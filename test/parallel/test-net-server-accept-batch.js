@@ -0,0 +1,38 @@
+var common = require('../common');
+var assert = require('assert');
+var net = require('net');
+
+var batchSize = 4;
+var clients = 20;
+var connections = 0;
+var batches = [];
+
+var server = net.createServer({ acceptBatchSize: batchSize }, function(c) {
+  c.end();
+  if (++connections === clients)
+    server.close();
+});
+
+assert.equal(server.acceptBatchSize, batchSize);
+
+server.listen(common.PORT, function() {
+  var onconnection = server._handle.onconnection;
+  server._handle.onconnection = function(err, handles) {
+    assert.equal(err, 0);
+    assert(Array.isArray(handles));
+    batches.push(handles.length);
+    return onconnection.apply(this, arguments);
+  };
+
+  for (var i = 0; i < clients; i++)
+    net.connect(common.PORT).resume();
+});
+
+process.on('exit', function() {
+  assert.equal(connections, clients);
+  assert(batches.length > 0);
+  assert.equal(batches.reduce(function(a, b) { return a + b; }), clients);
+  batches.forEach(function(n) {
+    assert(n > 0 && n <= batchSize);
+  });
+});
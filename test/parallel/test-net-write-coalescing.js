@@ -0,0 +1,83 @@
+var common = require('../common');
+var assert = require('assert');
+var net = require('net');
+
+// Indices into the counters, see Environment::WriteCoalescing::Fields.
+var kWrites = 0;
+var kBytes = 1;
+var kFlushes = 2;
+var kSyscallsSaved = 3;
+
+var stats = process.binding('stream_wrap').writeCoalescingStats;
+
+var expected = '';
+var received = '';
+var writes = 0;
+
+var server = net.createServer(function(conn) {
+  conn.setEncoding('utf8');
+  conn.on('data', function(data) {
+    received += data;
+  });
+  conn.on('end', function() {
+    server.close();
+  });
+});
+
+server.listen(common.PORT, function() {
+  var client = net.connect(common.PORT, function() {
+    client.setWriteCoalescing(1024);
+
+    // More than fits in one batch, the overflow gets flushed early.
+    for (var i = 0; i < 200; i++) {
+      var line = 'SET key' + i + ' ' + i + '\r\n';
+      client.write(line, function() {
+        writes++;
+      });
+      expected += line;
+    }
+
+    setImmediate(function() {
+      client.write('QUIT\r\n');
+      expected += 'QUIT\r\n';
+      client.end();
+    });
+  });
+});
+
+// The peer is gone. Sending the coalesced data fails after the write itself
+// has completed, and with no further write the error still shows up.
+var flushError = null;
+var closingServer = net.createServer(function(conn) {
+  conn.destroy();
+  closingServer.close();
+});
+
+closingServer.listen(common.PORT + 1, function() {
+  var client = net.connect({ port: common.PORT + 1, allowHalfOpen: true });
+  client.setWriteCoalescing(1024);
+  client.on('end', function() {
+    // The first write makes the peer reset the connection.
+    client.write('ping\r\n', function() {
+      setTimeout(function() {
+        client.write('ping\r\n');
+      }, 50);
+    });
+  });
+  client.on('error', function(err) {
+    flushError = err;
+  });
+  client.resume();
+});
+
+process.on('exit', function() {
+  assert(flushError);
+  assert.equal(flushError.syscall, 'write');
+  assert.equal(received, expected);
+  assert.equal(writes, 200);
+  assert(stats[kWrites] >= 200);
+  assert(stats[kBytes] > 0);
+  assert(stats[kFlushes] > 1);
+  assert(stats[kSyscallsSaved] > 0);
+  assert(stats[kFlushes] + stats[kSyscallsSaved] <= stats[kWrites]);
+});
@@ -0,0 +1,42 @@
+var common = require('../common');
+var assert = require('assert');
+var net = require('net');
+
+// Corked writes that consist of buffers only take the writev fast path,
+// mixed writes still go through the chunk/encoding pairs.
+var expected = '';
+var received = '';
+
+var server = net.createServer(function(conn) {
+  conn.setEncoding('utf8');
+  conn.on('data', function(data) {
+    received += data;
+  });
+  conn.on('end', function() {
+    server.close();
+  });
+});
+
+server.listen(common.PORT, function() {
+  var client = net.connect(common.PORT, function() {
+    client.cork();
+    for (var i = 0; i < 20; i++) {
+      client.write(new Buffer('buffer ' + i + '\n'));
+      expected += 'buffer ' + i + '\n';
+    }
+    client.uncork();
+
+    client.cork();
+    client.write(new Buffer('buffer\n'));
+    client.write('string\n', 'utf8');
+    client.write('aGV4Cg==', 'base64');
+    expected += 'buffer\nstring\nhex\n';
+    client.uncork();
+
+    client.end();
+  });
+});
+
+process.on('exit', function() {
+  assert.equal(received, expected);
+});
@@ -0,0 +1,44 @@
+var common = require('../common');
+var assert = require('assert');
+var net = require('net');
+
+// Indices into the counters, see Environment::ReadBufferPool::Fields.
+var kHits = 0;
+var kMisses = 1;
+var kCopies = 2;
+var kHandOffs = 3;
+
+var stats = process.binding('stream_wrap').readBufferPoolStats;
+var small = new Buffer(64);
+var large = new Buffer(256 * 1024);
+small.fill('a');
+large.fill('b');
+
+var received = 0;
+var server = net.createServer(function(conn) {
+  conn.on('data', function(chunk) {
+    received += chunk.length;
+  });
+  conn.on('end', function() {
+    server.close();
+  });
+});
+
+server.listen(common.PORT, function() {
+  var client = net.connect(common.PORT, function() {
+    var n = 0;
+    (function next() {
+      if (++n > 10)
+        return client.end(large);
+      client.write(small, next);
+    })();
+  });
+});
+
+process.on('exit', function() {
+  assert.equal(received, 10 * small.length + large.length);
+  assert(stats[kHits] > 0);
+  assert(stats[kMisses] > 0);
+  assert(stats[kCopies] > 0);
+  assert(stats[kHandOffs] > 0);
+});
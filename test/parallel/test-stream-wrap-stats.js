@@ -0,0 +1,70 @@
+var common = require('../common');
+var assert = require('assert');
+var net = require('net');
+
+// Indices into the counters, see StreamResource::StatsFields.
+var kReads = 0;
+var kBytesRead = 1;
+var kWrites = 2;
+var kBytesWritten = 3;
+var kTryWrites = 4;
+var kQueuedWrites = 5;
+var kMaxWriteQueueSize = 7;
+
+var chunk = new Buffer(1024);
+chunk.fill('x');
+var big = new Buffer(4 * 1024 * 1024);
+big.fill('y');
+var total = 3 * chunk.length + big.length;
+
+var serverStats;
+var clientStats;
+var received = 0;
+
+var server = net.createServer(function(conn) {
+  serverStats = conn._handle.stats;
+  assert.strictEqual(conn._handle.stats, serverStats);
+
+  conn.on('data', function(data) {
+    received += data.length;
+    assert.equal(serverStats[kBytesRead], received);
+  });
+  conn.on('end', function() {
+    assert(serverStats[kReads] > 0);
+    assert.equal(serverStats[kWrites], 0);
+    conn.end();
+    server.close();
+  });
+});
+
+server.listen(common.PORT, function() {
+  var client = net.connect(common.PORT, function() {
+    clientStats = client._handle.stats;
+    client.write(chunk);
+    client.write(chunk);
+    client.write(chunk);
+    client.end(big);
+  });
+  client.on('close', function() {
+    // The counters are gone along with the handle, which is freed right
+    // after the 'close' event.
+    setImmediate(function() {
+      assert.strictEqual(clientStats[kWrites], undefined);
+    });
+  });
+  client.resume();
+  client.on('end', function() {
+    // Writes that pile up behind the big one may be merged into a writev.
+    assert(clientStats[kWrites] >= 2 && clientStats[kWrites] <= 4);
+    assert.equal(clientStats[kBytesWritten], total);
+    assert.equal(clientStats[kTryWrites] + clientStats[kQueuedWrites],
+                 clientStats[kWrites]);
+    // 4 MB doesn't fit in the socket buffer in one go.
+    assert(clientStats[kQueuedWrites] > 0);
+    assert(clientStats[kMaxWriteQueueSize] > 0);
+  });
+});
+
+process.on('exit', function() {
+  assert.equal(received, total);
+});
@@ -0,0 +1,28 @@
+var common = require('../common');
+var assert = require('assert');
+var fs = require('fs');
+
+var TCP = process.binding('tcp_wrap').TCP;
+
+// The socket that bind() opens itself for SO_REUSEPORT must not be inherited
+// by child processes, just like the sockets that libuv opens.
+if (process.platform !== 'linux') {
+  console.log('1..0 # Skipped: needs /proc');
+  return;
+}
+
+var handle = new TCP();
+var err = handle.bind('127.0.0.1', common.PORT, true);
+if (err === process.binding('uv').UV_ENOTSUP) {
+  console.log('1..0 # Skipped: no SO_REUSEPORT');
+  return;
+}
+assert.equal(err, 0);
+assert(handle.fd > 0);
+
+var fdinfo = fs.readFileSync('/proc/self/fdinfo/' + handle.fd, 'utf8');
+var flags = parseInt(/^flags:\s*([0-7]+)/m.exec(fdinfo)[1], 8);
+var O_CLOEXEC = parseInt('2000000', 8);
+assert.equal(flags & O_CLOEXEC, O_CLOEXEC);
+
+handle.close();
@@ -0,0 +1,90 @@
+var common = require('../common');
+var assert = require('assert');
+var fs = require('fs');
+var net = require('net');
+
+var WriteWrap = process.binding('stream_wrap').WriteWrap;
+var uv = process.binding('uv');
+
+// sendFile() only uses sendfile() on the event loop for data that is in the
+// page cache, anything else is read in the thread pool. Files in /proc can't
+// be mapped, so they never look cached.
+if (process.platform !== 'linux') {
+  console.log('1..0 # Skipped: needs /proc');
+  return;
+}
+
+var filename = '/proc/version';
+var data = fs.readFileSync(filename);
+var tests = [send, close];
+var done = 0;
+
+function next() {
+  var test = tests.shift();
+  if (test)
+    test(function() {
+      done++;
+      next();
+    });
+}
+next();
+
+function send(cb) {
+  var fd = fs.openSync(filename, 'r');
+  var received = [];
+
+  var server = net.createServer(function(conn) {
+    var req = new WriteWrap();
+    req.async = false;
+    req.oncomplete = function(status) {
+      assert.equal(status, 0);
+      fs.closeSync(fd);
+      conn.end();
+    };
+
+    var err = conn._handle.sendFile(req, fd, 0, data.length);
+    assert.equal(err, 0);
+    assert.equal(req.async, true);
+  });
+
+  server.listen(common.PORT, function() {
+    var client = net.connect(common.PORT);
+    client.on('data', function(chunk) {
+      received.push(chunk);
+    });
+    client.on('end', function() {
+      assert.deepEqual(Buffer.concat(received), data);
+      server.close();
+      cb();
+    });
+  });
+}
+
+// The stream goes away while the file is read, the request still completes
+// so that the file can be closed.
+function close(cb) {
+  var fd = fs.openSync(filename, 'r');
+
+  var server = net.createServer(function(conn) {
+    var req = new WriteWrap();
+    req.async = false;
+    req.oncomplete = function(status) {
+      assert.equal(status, uv.UV_ECANCELED);
+      fs.closeSync(fd);
+      server.close();
+      cb();
+    };
+
+    var err = conn._handle.sendFile(req, fd, 0, data.length);
+    assert.equal(err, 0);
+    conn.destroy();
+  });
+
+  server.listen(common.PORT, function() {
+    net.connect(common.PORT).on('error', function() {});
+  });
+}
+
+process.on('exit', function() {
+  assert.equal(done, 2);
+});
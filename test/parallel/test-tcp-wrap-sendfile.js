@@ -0,0 +1,66 @@
+var common = require('../common');
+var assert = require('assert');
+var fs = require('fs');
+var net = require('net');
+var path = require('path');
+
+var WriteWrap = process.binding('stream_wrap').WriteWrap;
+
+if (process.platform === 'win32') {
+  console.log('1..0 # Skipped: sendFile is not supported on Windows');
+  return;
+}
+
+var filename = path.join(common.tmpDir, 'sendfile.txt');
+var offset = 1000;
+var data = new Buffer(4 * 1024 * 1024 + offset);
+for (var i = 0; i < data.length; i++)
+  data[i] = i % 251;
+fs.writeFileSync(filename, data);
+
+var fd = fs.openSync(filename, 'r');
+var length = data.length - offset;
+var completed = false;
+var received = [];
+
+var server = net.createServer(function(conn) {
+  var req = new WriteWrap();
+  req.async = false;
+  req.oncomplete = afterSendFile;
+
+  var err = conn._handle.sendFile(req, fd, offset, length);
+  assert.equal(err, 0);
+  assert.equal(req.bytes, length);
+  if (!req.async)
+    afterSendFile(0, conn._handle, req);
+
+  function afterSendFile(status, handle, req_, err) {
+    assert.equal(status, 0);
+    assert.equal(handle, conn._handle);
+    assert.equal(req_, req);
+    completed = true;
+    conn.end();
+  }
+});
+
+server.listen(common.PORT, function() {
+  var client = net.connect(common.PORT);
+  client.pause();
+  setTimeout(function() {
+    client.on('data', function(chunk) {
+      received.push(chunk);
+    });
+    client.on('end', function() {
+      server.close();
+    });
+    client.resume();
+  }, 50);
+});
+
+process.on('exit', function() {
+  fs.closeSync(fd);
+  assert(completed);
+  var result = Buffer.concat(received);
+  assert.equal(result.length, length);
+  assert.equal(result.toString('hex'), data.slice(offset).toString('hex'));
+});
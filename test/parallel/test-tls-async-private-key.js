@@ -0,0 +1,208 @@
+var common = require('../common');
+var assert = require('assert');
+
+if (!common.hasCrypto) {
+  console.log('1..0 # Skipped: missing crypto');
+  process.exit();
+}
+var tls = require('tls');
+var net = require('net');
+var fs = require('fs');
+
+// With `asyncPrivateKey` the server runs the part of full handshakes that
+// uses the private key in the thread pool. Everything else must behave as
+// before.
+var options = {
+  key: fs.readFileSync(common.fixturesDir + '/keys/agent1-key.pem'),
+  cert: fs.readFileSync(common.fixturesDir + '/keys/agent1-cert.pem'),
+  asyncPrivateKey: true
+};
+
+function extend(opts) {
+  var result = {};
+  Object.keys(options).forEach(function(key) {
+    result[key] = options[key];
+  });
+  Object.keys(opts).forEach(function(key) {
+    result[key] = opts[key];
+  });
+  return result;
+}
+
+var tests = [storm, resume, ocspRequest, npn, hangUp];
+var done = 0;
+
+function next() {
+  var test = tests.shift();
+  if (test)
+    test(function() {
+      done++;
+      next();
+    });
+}
+next();
+
+// Many handshakes at once, with data in both directions
+function storm(cb) {
+  var N = 20;
+  var closed = 0;
+  var server = tls.createServer(options, function(conn) {
+    conn.write('server ');
+    conn.pipe(conn);
+  });
+  server.listen(common.PORT, function() {
+    for (var i = 0; i < N; i++)
+      connect(i);
+  });
+
+  function connect(i) {
+    var received = '';
+    var client = tls.connect({
+      port: common.PORT,
+      rejectUnauthorized: false
+    }, function() {
+      client.end('client ' + i);
+    });
+    client.setEncoding('utf8');
+    client.on('data', function(data) {
+      received += data;
+    });
+    client.on('close', function() {
+      assert.equal(received, 'server client ' + i);
+      if (++closed === N) {
+        server.close();
+        cb();
+      }
+    });
+  }
+}
+
+// Resumed handshakes don't use the private key
+function resume(cb) {
+  var server = tls.createServer(options, function(conn) {
+    conn.end();
+  });
+  server.listen(common.PORT, function() {
+    var first = tls.connect({
+      port: common.PORT,
+      rejectUnauthorized: false
+    }, function() {
+      var session = first.getSession();
+      first.on('close', function() {
+        var second = tls.connect({
+          port: common.PORT,
+          rejectUnauthorized: false,
+          session: session
+        }, function() {
+          assert(second.isSessionReused());
+          second.on('close', function() {
+            server.close();
+            cb();
+          });
+        });
+      });
+    });
+  });
+}
+
+// The certificate callback runs first, then the job. A stapled OCSP response
+// makes the handshake complete synchronously.
+function ocspRequest(cb) {
+  var requests = 0;
+  var server = tls.createServer(options, function(conn) {
+    conn.end();
+  });
+  server.on('OCSPRequest', function(cert, issuer, callback) {
+    requests++;
+    setImmediate(function() {
+      callback(null, requests === 1 ? null : new Buffer('hello world'));
+    });
+  });
+  server.listen(common.PORT, function() {
+    connect(null, function() {
+      connect('hello world', function() {
+        assert.equal(requests, 2);
+        server.close();
+        cb();
+      });
+    });
+  });
+
+  function connect(expected, cb) {
+    var response = null;
+    var client = tls.connect({
+      port: common.PORT,
+      rejectUnauthorized: false,
+      requestOCSP: true
+    });
+    client.on('OCSPResponse', function(resp) {
+      response = resp && resp.toString();
+    });
+    client.on('close', function() {
+      assert.equal(response, expected);
+      cb();
+    });
+  }
+}
+
+// Advertising NPN protocols can't happen in the thread pool either
+function npn(cb) {
+  if (!process.features.tls_npn)
+    return cb();
+
+  var server = tls.createServer(extend({
+    NPNProtocols: ['a', 'b']
+  }), function(conn) {
+    assert.equal(conn.npnProtocol, 'b');
+    conn.end();
+  });
+  server.listen(common.PORT, function() {
+    var client = tls.connect({
+      port: common.PORT,
+      rejectUnauthorized: false,
+      NPNProtocols: ['b']
+    }, function() {
+      assert.equal(client.npnProtocol, 'b');
+    });
+    client.on('close', function() {
+      server.close();
+      cb();
+    });
+  });
+}
+
+// The client goes away while the server's flight is being prepared
+function hangUp(cb) {
+  var hello = null;
+  var recorder = net.createServer(function(conn) {
+    conn.once('data', function(data) {
+      hello = data;
+      conn.destroy();
+    });
+  });
+  recorder.listen(common.PORT, function() {
+    var client = tls.connect({
+      port: common.PORT,
+      rejectUnauthorized: false
+    });
+    client.on('error', function() {});
+    client.on('close', function() {
+      recorder.close(replay);
+    });
+  });
+
+  function replay() {
+    var server = tls.createServer(options, assert.fail);
+    server.on('clientError', function() {
+      server.close();
+      cb();
+    });
+    server.listen(common.PORT, function() {
+      net.connect(common.PORT).end(hello);
+    });
+  }
+}
+
+process.on('exit', function() {
+  assert.equal(done, 5);
+});
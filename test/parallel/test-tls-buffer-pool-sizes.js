@@ -0,0 +1,69 @@
+var common = require('../common');
+var assert = require('assert');
+
+if (!common.hasCrypto) {
+  console.log('1..0 # Skipped: missing crypto');
+  process.exit();
+}
+var tls = require('tls');
+var fs = require('fs');
+
+// Writes of all kinds of sizes still take their buffers from the pool once
+// it has warmed up, instead of each odd size claiming a free list of its own.
+var SIZES = [10, 700, 1500, 3000, 5000, 9000, 15000, 17000, 33000, 100000];
+var ROUNDS = 60;
+var WARMUP = 10;
+
+var server = tls.createServer({
+  key: fs.readFileSync(common.fixturesDir + '/keys/agent1-key.pem'),
+  cert: fs.readFileSync(common.fixturesDir + '/keys/agent1-cert.pem')
+}, function(conn) {
+  conn.pipe(conn);
+});
+
+var rounds = 0;
+var warm;
+
+server.listen(common.PORT, function() {
+  var client = tls.connect({
+    port: common.PORT,
+    rejectUnauthorized: false
+  }, write);
+
+  var expected = 0;
+  var received = 0;
+
+  function write() {
+    if (rounds === WARMUP)
+      warm = tls.getBufferStats();
+    if (rounds === ROUNDS) {
+      check(tls.getBufferStats());
+      client.destroy();
+      server.close();
+      return;
+    }
+    expected = SIZES[rounds % SIZES.length];
+    received = 0;
+    rounds++;
+    client.write(new Buffer(expected));
+  }
+
+  client.on('data', function(data) {
+    received += data.length;
+    if (received === expected)
+      setImmediate(write);
+  });
+});
+
+function check(stats) {
+  var hits = stats.hits - warm.hits;
+  var misses = stats.misses - warm.misses;
+  console.log('hits %d, misses %d, pooled %d', hits, misses, stats.pooled);
+  assert(hits > 0);
+  assert(hits >= 10 * misses);
+  assert(stats.pooled <= 4 * 1024 * 1024);
+}
+
+process.on('exit', function() {
+  assert.equal(rounds, ROUNDS);
+});
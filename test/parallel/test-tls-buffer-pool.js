@@ -0,0 +1,62 @@
+var common = require('../common');
+var assert = require('assert');
+
+if (!common.hasCrypto) {
+  console.log('1..0 # Skipped: missing crypto');
+  process.exit();
+}
+var tls = require('tls');
+var fs = require('fs');
+
+// Connections that have exchanged data and gone idle give their buffers back
+// to the pool, and later connections reuse them.
+var N = 10;
+var SIZE = 50000;
+var clients = [];
+
+var server = tls.createServer({
+  key: fs.readFileSync(common.fixturesDir + '/keys/agent1-key.pem'),
+  cert: fs.readFileSync(common.fixturesDir + '/keys/agent1-cert.pem')
+}, function(conn) {
+  conn.pipe(conn);
+});
+
+server.listen(common.PORT, function() {
+  var idle = 0;
+  for (var i = 0; i < N; i++)
+    connect(function() {
+      if (++idle === N)
+        setImmediate(check);
+    });
+});
+
+function connect(cb) {
+  var received = 0;
+  var client = tls.connect({
+    port: common.PORT,
+    rejectUnauthorized: false
+  }, function() {
+    client.write(new Buffer(SIZE));
+  });
+  client.on('data', function(data) {
+    received += data.length;
+    if (received === SIZE)
+      cb();
+  });
+  clients.push(client);
+}
+
+function check() {
+  var stats = tls.getBufferStats();
+  assert.equal(stats.inUse, 0);
+  assert(stats.pooled > 0);
+  assert(stats.hits > 0);
+  assert(stats.misses > 0);
+  assert(stats.idleReleases >= 2 * N);
+  assert(stats.pooled <= 4 * 1024 * 1024);
+
+  clients.forEach(function(client) {
+    client.destroy();
+  });
+  server.close();
+}
@@ -0,0 +1,75 @@
+var common = require('../common');
+var assert = require('assert');
+
+if (!common.hasCrypto) {
+  console.log('1..0 # Skipped: missing crypto');
+  process.exit();
+}
+var tls = require('tls');
+var net = require('net');
+var fs = require('fs');
+
+// A TLS terminating proxy that moves the data between the client and the
+// backend with socket.pipeNative(), to a plain TCP backend and to a TLS one.
+var SIZE = 4 * 1024 * 1024;
+var options = {
+  key: fs.readFileSync(common.fixturesDir + '/keys/agent1-key.pem'),
+  cert: fs.readFileSync(common.fixturesDir + '/keys/agent1-cert.pem')
+};
+var tests = [false, true];
+var done = 0;
+
+function echo(conn) {
+  conn.pipe(conn);
+}
+
+function next() {
+  if (tests.length === 0)
+    return;
+
+  var tlsBackend = tests.shift();
+  var backend = tlsBackend ? tls.createServer(options, echo) :
+                             net.createServer(echo);
+  var proxy = tls.createServer(options, function(conn) {
+    var upstream;
+    if (tlsBackend)
+      upstream = tls.connect({ port: common.PORT, rejectUnauthorized: false });
+    else
+      upstream = net.connect(common.PORT);
+    conn.pipeNative(upstream);
+    upstream.pipeNative(conn);
+  });
+
+  backend.listen(common.PORT, function() {
+    proxy.listen(common.PORT + 1, function() {
+      var data = new Buffer(SIZE);
+      for (var i = 0; i < SIZE; i++)
+        data[i] = i % 251;
+
+      var received = [];
+      var length = 0;
+      var client = tls.connect({
+        port: common.PORT + 1,
+        rejectUnauthorized: false
+      });
+      client.write(data);
+      client.on('data', function(chunk) {
+        received.push(chunk);
+        length += chunk.length;
+        if (length < SIZE)
+          return;
+        assert(Buffer.concat(received).equals(data));
+        client.destroy();
+        backend.close();
+        proxy.close();
+        done++;
+        next();
+      });
+    });
+  });
+}
+next();
+
+process.on('exit', function() {
+  assert.equal(done, 2);
+});
@@ -0,0 +1,169 @@
+var common = require('../common');
+var assert = require('assert');
+
+if (!common.hasCrypto) {
+  console.log('1..0 # Skipped: missing crypto');
+  process.exit();
+}
+var tls = require('tls');
+var constants = require('constants');
+var fs = require('fs');
+
+// Servers resume sessions by id without 'newSession'/'resumeSession'
+// handlers. Tickets are turned off so that only the session cache can do it.
+var options = {
+  key: fs.readFileSync(common.fixturesDir + '/keys/agent2-key.pem'),
+  cert: fs.readFileSync(common.fixturesDir + '/keys/agent2-cert.pem'),
+  secureOptions: constants.SSL_OP_NO_TICKET,
+  sessionIdContext: 'test-tls-session-cache-native'
+};
+
+function extend(opts) {
+  var result = {};
+  Object.keys(options).forEach(function(key) {
+    result[key] = options[key];
+  });
+  Object.keys(opts).forEach(function(key) {
+    result[key] = opts[key];
+  });
+  return result;
+}
+
+function listen(opts, cb) {
+  var server = tls.createServer(extend(opts), function(conn) {
+    conn.end();
+  });
+  server.listen(0, function() {
+    cb(server, server.address().port);
+  });
+}
+
+// Connects with session and calls back with whether it was reused and the
+// new session.
+function connect(port, session, cb) {
+  var client = tls.connect({
+    port: port,
+    rejectUnauthorized: false,
+    session: session
+  }, function() {
+    var reused = client.isSessionReused();
+    var session = client.getSession();
+    client.on('close', function() {
+      cb(reused, session);
+    });
+  });
+  client.resume();
+}
+
+assert.throws(function() {
+  tls.SessionCache({ size: 0 });
+}, TypeError);
+assert.throws(function() {
+  tls.SessionCache({ timeout: -1 });
+}, TypeError);
+assert.throws(function() {
+  tls.createSecureContext({ sessionCache: {} });
+}, TypeError);
+
+var tests = [
+  function defaultCache(next) {
+    listen({}, function(server, port) {
+      connect(port, null, function(reused, session) {
+        assert(!reused);
+        connect(port, session, function(reused) {
+          assert(reused);
+          var stats = server.sessionCache.getStats();
+          assert.equal(stats.entries, 1);
+          assert.equal(stats.hits, 1);
+          server.close(next);
+        });
+      });
+    });
+  },
+
+  function disabled(next) {
+    listen({ sessionCache: false }, function(server, port) {
+      connect(port, null, function(reused, session) {
+        connect(port, session, function(reused) {
+          assert(!reused);
+          server.close(next);
+        });
+      });
+    });
+  },
+
+  function sharedBetweenServers(next) {
+    var cache = tls.SessionCache();
+    listen({ sessionCache: cache }, function(a, portA) {
+      listen({ sessionCache: cache }, function(b, portB) {
+        connect(portA, null, function(reused, session) {
+          connect(portB, session, function(reused) {
+            assert(reused);
+            assert.equal(cache.getStats().hits, 1);
+            a.close();
+            b.close(next);
+          });
+        });
+      });
+    });
+  },
+
+  function eviction(next) {
+    var cache = tls.SessionCache({ size: 1 });
+    listen({ sessionCache: cache }, function(server, port) {
+      connect(port, null, function(reused, first) {
+        connect(port, null, function(reused, second) {
+          assert.equal(cache.getStats().evictions, 1);
+          connect(port, first, function(reused) {
+            assert(!reused);
+            server.close(next);
+          });
+        });
+      });
+    });
+  },
+
+  function expiry(next) {
+    var cache = tls.SessionCache({ timeout: 1 });
+    listen({ sessionCache: cache }, function(server, port) {
+      connect(port, null, function(reused, session) {
+        setTimeout(function() {
+          connect(port, session, function(reused) {
+            assert(!reused);
+            assert.equal(cache.getStats().misses, 1);
+            server.close(next);
+          });
+        }, 2100);
+      });
+    });
+  },
+
+  function flush(next) {
+    var cache = tls.SessionCache();
+    listen({ sessionCache: cache }, function(server, port) {
+      connect(port, null, function(reused, session) {
+        cache.flush();
+        assert.equal(cache.getStats().entries, 0);
+        connect(port, session, function(reused) {
+          assert(!reused);
+          server.close(next);
+        });
+      });
+    });
+  }
+];
+
+var done = 0;
+(function next() {
+  var test = tests[done];
+  if (!test)
+    return;
+  test(function() {
+    done++;
+    next();
+  });
+})();
+
+process.on('exit', function() {
+  assert.equal(done, tests.length);
+});
@@ -0,0 +1,110 @@
+var common = require('../common');
+var assert = require('assert');
+
+if (!common.hasCrypto) {
+  console.log('1..0 # Skipped: missing crypto');
+  process.exit();
+}
+var tls = require('tls');
+var net = require('net');
+var fs = require('fs');
+
+// Small writes that reach TLSWrap together are packed into records of up to
+// the maximum fragment size. A proxy counts the application data records
+// that the server sends.
+var tests = [
+  // fragment size, chunk sizes, expected records
+  [null, repeat(10, 100), 1],
+  [512, repeat(10, 100), 2],
+  [null, [10, 40000, 10, 10], 4],
+  [1024, repeat(100, 10).concat([5000]).concat(repeat(1, 10)), 7]
+];
+var done = 0;
+
+function repeat(size, times) {
+  var result = [];
+  for (var i = 0; i < times; i++)
+    result.push(size);
+  return result;
+}
+
+var current;
+var server = tls.createServer({
+  key: fs.readFileSync(common.fixturesDir + '/keys/agent1-key.pem'),
+  cert: fs.readFileSync(common.fixturesDir + '/keys/agent1-cert.pem'),
+  ciphers: 'AES128-GCM-SHA256'
+}, function(conn) {
+  if (current[0] !== null)
+    assert(conn.setMaxSendFragment(current[0]));
+
+  var c = 0;
+  conn.cork();
+  current[1].forEach(function(size) {
+    var chunk = new Buffer(size);
+    chunk.fill(c++ & 0xff);
+    conn.write(chunk);
+  });
+  conn.uncork();
+  conn.end();
+});
+
+var proxy = net.createServer(function(client) {
+  var upstream = net.connect(common.PORT);
+  var pending = new Buffer(0);
+  var records = 0;
+  client.pipe(upstream);
+  upstream.on('data', function(data) {
+    client.write(data);
+    pending = Buffer.concat([pending, data]);
+    while (pending.length >= 5 &&
+           pending.length >= 5 + pending.readUInt16BE(3)) {
+      if (pending[0] === 23)
+        records++;
+      pending = pending.slice(5 + pending.readUInt16BE(3));
+    }
+  });
+  upstream.on('end', function() {
+    client.end();
+    assert.equal(records, current[2]);
+  });
+});
+
+server.listen(common.PORT, function() {
+  proxy.listen(common.PORT + 1, next);
+});
+
+function next() {
+  current = tests.shift();
+  if (!current) {
+    proxy.close();
+    server.close();
+    return;
+  }
+
+  var expected = [];
+  var c = 0;
+  current[1].forEach(function(size) {
+    var chunk = new Buffer(size);
+    chunk.fill(c++ & 0xff);
+    expected.push(chunk);
+  });
+  expected = Buffer.concat(expected);
+
+  var received = [];
+  var client = tls.connect({
+    port: common.PORT + 1,
+    rejectUnauthorized: false
+  });
+  client.on('data', function(data) {
+    received.push(data);
+  });
+  client.on('end', function() {
+    assert.deepEqual(Buffer.concat(received), expected);
+    done++;
+  });
+  client.on('close', next);
+}
+
+process.on('exit', function() {
+  assert.equal(done, 4);
+});
@@ -0,0 +1,55 @@
+var common = require('../common');
+var assert = require('assert');
+var fs = require('fs');
+var uv = process.binding('uv');
+
+var info = uv.threadpoolInfo();
+assert(info.threads >= info.minThreads);
+assert(info.minThreads >= 1);
+assert(info.maxThreads >= info.minThreads);
+
+uv.setThreadpoolSize(2, 8);
+info = uv.threadpoolInfo();
+assert.equal(info.minThreads, 2);
+assert.equal(info.maxThreads, 8);
+assert(info.threads >= 2);
+
+assert.throws(function() {
+  uv.setThreadpoolSize(0, 1);
+}, /EINVAL/);
+assert.throws(function() {
+  uv.setThreadpoolSize(4, 2);
+}, /EINVAL/);
+assert.throws(function() {
+  uv.setThreadpoolSize('2', 4);
+}, TypeError);
+
+var pending = 50;
+for (var i = 0; i < 50; i++) {
+  fs.stat(__filename, function(err) {
+    assert.ifError(err);
+    if (--pending === 0)
+      check();
+  });
+}
+
+function check() {
+  var info = uv.threadpoolInfo();
+  assert.equal(info.queued, 0);
+  assert(info.p50QueueTime > 0);
+  assert(info.p99QueueTime >= info.p50QueueTime);
+  assert(info.threadsCreated >= info.threads);
+
+  // The percentiles don't change by looking at them, only when reset.
+  var again = uv.threadpoolInfo();
+  assert.equal(again.p50QueueTime, info.p50QueueTime);
+  assert.equal(again.p99QueueTime, info.p99QueueTime);
+  uv.resetThreadpoolPercentiles();
+  again = uv.threadpoolInfo();
+  assert.equal(again.p50QueueTime, 0);
+  assert.equal(again.p99QueueTime, 0);
+}
+
+process.on('exit', function() {
+  assert.equal(pending, 0);
+});
@@ -0,0 +1,55 @@
+var common = require('../common');
+var assert = require('assert');
+var fs = require('fs');
+var zlib = require('zlib');
+var uv = process.binding('uv');
+
+// File system requests and zlib end up in different threadpool classes,
+// each with its own counters.
+var fsBefore = uv.threadpoolStats(uv.UV_WORK_FS);
+var cpuBefore = uv.threadpoolStats(uv.UV_WORK_CPU);
+
+// CPU-bound work never gets all of the threads by default.
+assert(cpuBefore.limit > 0);
+assert.equal(uv.threadpoolStats(uv.UV_WORK_FS).limit, 0);
+
+uv.setThreadpoolLimit(uv.UV_WORK_CPU, 1);
+assert.equal(uv.threadpoolStats(uv.UV_WORK_CPU).limit, 1);
+
+assert.throws(function() {
+  uv.threadpoolStats(42);
+}, /EINVAL/);
+assert.throws(function() {
+  uv.setThreadpoolLimit(uv.UV_WORK_CPU, -1);
+}, TypeError);
+
+var pending = 2;
+
+fs.stat(__filename, function(err) {
+  assert.ifError(err);
+  done();
+});
+
+zlib.deflate(new Buffer(1024), function(err) {
+  assert.ifError(err);
+  done();
+});
+
+function done() {
+  if (--pending > 0)
+    return;
+
+  var fsAfter = uv.threadpoolStats(uv.UV_WORK_FS);
+  assert(fsAfter.submitted > fsBefore.submitted);
+  assert(fsAfter.completed > fsBefore.completed);
+  assert(fsAfter.queueTime >= fsBefore.queueTime);
+  assert(fsAfter.maxQueueTime >= 0);
+
+  var cpuAfter = uv.threadpoolStats(uv.UV_WORK_CPU);
+  assert(cpuAfter.completed > cpuBefore.completed);
+  assert.equal(cpuAfter.queued, 0);
+}
+
+process.on('exit', function() {
+  assert.equal(pending, 0);
+});
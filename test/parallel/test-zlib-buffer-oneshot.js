@@ -0,0 +1,103 @@
+var common = require('../common');
+var assert = require('assert');
+var zlib = require('zlib');
+
+// The convenience methods deflate and inflate a whole buffer in one go,
+// without a stream. The results must be interchangeable with the streams'.
+var text = new Array(2000).join('The quick brown fox jumps over the lazy dog. ');
+var input = new Buffer(text);
+// Compresses by far more than the initial guess of the inflated size.
+var zeroes = new Buffer(4 * 1024 * 1024);
+zeroes.fill(0);
+
+var pairs = [
+  ['deflate', 'inflate', 'Inflate'],
+  ['gzip', 'gunzip', 'Gunzip'],
+  ['deflateRaw', 'inflateRaw', 'InflateRaw'],
+  ['deflate', 'unzip', 'Unzip'],
+  ['gzip', 'unzip', 'Unzip']
+];
+
+var pending = 0;
+
+function inflateStream(Ctor, data, cb) {
+  var chunks = [];
+  var stream = new zlib[Ctor]();
+  stream.on('data', function(chunk) {
+    chunks.push(chunk);
+  });
+  stream.on('end', function() {
+    cb(Buffer.concat(chunks));
+  });
+  stream.end(data);
+}
+
+pairs.forEach(function(pair) {
+  var compress = pair[0];
+  var decompress = pair[1];
+
+  [input, zeroes, new Buffer(0)].forEach(function(data) {
+    var compressed = zlib[compress + 'Sync'](data);
+    assert(zlib[decompress + 'Sync'](compressed).equals(data));
+
+    pending++;
+    inflateStream(pair[2], compressed, function(result) {
+      assert(result.equals(data));
+      pending--;
+    });
+
+    pending++;
+    zlib[compress](data, function(err, compressed) {
+      assert.ifError(err);
+      zlib[decompress](compressed, function(err, result) {
+        assert.ifError(err);
+        assert(result.equals(data));
+        pending--;
+      });
+    });
+  });
+});
+
+// Strings are accepted too.
+assert.equal(zlib.gunzipSync(zlib.gzipSync(text)).toString(), text);
+
+// Options are passed through and validated.
+var opts = { level: 9, windowBits: 9, memLevel: 9, strategy: zlib.Z_RLE };
+var compressed = zlib.deflateRawSync(input, opts);
+assert(zlib.inflateRawSync(compressed, opts).equals(input));
+assert.throws(function() {
+  zlib.deflateSync(input, { level: 10 });
+}, /Invalid compression level/);
+assert.throws(function() {
+  zlib.inflate(input, { windowBits: 100 }, assert.fail);
+}, /Invalid windowBits/);
+
+// Errors carry the same properties as the ones of the streams.
+compressed = zlib.deflateSync(input);
+assert.throws(function() {
+  zlib.gunzipSync(compressed);
+}, function(err) {
+  return err instanceof Error &&
+         err.message === 'incorrect header check' &&
+         err.errno === zlib.Z_DATA_ERROR &&
+         err.code === 'Z_DATA_ERROR';
+});
+
+pending++;
+zlib.gunzip(compressed, function(err, result) {
+  assert(err instanceof Error);
+  assert.equal(err.message, 'incorrect header check');
+  assert.equal(err.errno, zlib.Z_DATA_ERROR);
+  assert.equal(err.code, 'Z_DATA_ERROR');
+  assert.equal(result, undefined);
+  pending--;
+});
+
+// Truncated input yields what could be decompressed, like the streams do.
+var truncated = zlib.inflateSync(compressed.slice(0, compressed.length >> 1));
+assert(truncated.length > 0);
+assert(truncated.equals(input.slice(0, truncated.length)));
+
+process.on('exit', function() {
+  assert.equal(pending, 0);
+});
@@ -0,0 +1,54 @@
+var common = require('../common');
+var assert = require('assert');
+var zlib = require('zlib');
+
+// A chunk whose output spans many chunkSize buffers is processed in a few
+// trips to the thread pool, each of which hands back a list of buffers.
+var input = new Buffer(8 * 1024 * 1024);
+for (var i = 0; i < input.length; i++)
+  input[i] = (i * 7919) % 251;
+var compressed = zlib.deflateSync(input);
+
+var inflate = zlib.createInflate({ chunkSize: 16 * 1024 });
+var writeAll = inflate._handle.writeAll;
+var trips = 0;
+inflate._handle.writeAll = function() {
+  trips++;
+  return writeAll.apply(this, arguments);
+};
+
+var chunks = [];
+inflate.on('data', function(chunk) {
+  assert(chunk.length > 0);
+  assert(chunk.length <= 16 * 1024);
+  chunks.push(chunk);
+});
+inflate.on('end', function() {
+  var output = Buffer.concat(chunks);
+  assert.equal(output.length, input.length);
+  assert(output.equals(input));
+  // 512 chunks of output, at most 128 per trip.
+  assert(trips < 16, trips + ' trips');
+});
+inflate.end(compressed);
+
+// The sync path goes through the same binding method.
+var output = zlib.inflateSync(compressed, { chunkSize: 1024 });
+assert(output.equals(input));
+
+// Errors are reported once and the output produced so far is dropped.
+var corrupt = Buffer.concat([compressed.slice(0, compressed.length >> 1),
+                             new Buffer(1024).fill(0xff)]);
+var errors = 0;
+zlib.inflate(corrupt, function(err, data) {
+  assert(err);
+  assert.equal(data, undefined);
+  errors++;
+});
+assert.throws(function() {
+  zlib.inflateSync(corrupt);
+}, /invalid/);
+
+process.on('exit', function() {
+  assert.equal(errors, 1);
+});